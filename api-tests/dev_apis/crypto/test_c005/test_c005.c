@@ -51,6 +51,9 @@ int32_t psa_destroy_key_test(caller_security_t caller __UNUSED)
     status = val->crypto_function(VAL_CRYPTO_INIT);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
+    /* Exercises the key destruction, the keys are not taken from the key cache */
+    val->crypto_function(VAL_CRYPTO_KEY_CACHE_DISABLE);
+
     /* Set the key data buffer to the input base on algorithm */
     for (i = 0; i < num_checks; i++)
     {
@@ -129,6 +132,9 @@ int32_t psa_destroy_key_test_invalid_key_identifier(caller_security_t caller __U
     status = val->crypto_function(VAL_CRYPTO_INIT);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
+    /* Exercises the key destruction, the keys are not taken from the key cache */
+    val->crypto_function(VAL_CRYPTO_KEY_CACHE_DISABLE);
+
     val->print(TEST, "[Check %d] ", g_test_count++);
     val->print(TEST, "Test psa_destroy_key with invalid key identifier\n", 0);
 
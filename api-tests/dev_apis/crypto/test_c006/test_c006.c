@@ -30,6 +30,20 @@ int32_t psa_hash_compute_test(caller_security_t caller __UNUSED)
     int32_t                 num_checks = sizeof(check1)/sizeof(check1[0]);
     int32_t                 i, status;
     size_t                  expected_hash_length;
+    val_vector_file_t       file;
+    test_data               vector;
+    const test_data        *check;
+    bool_t                  from_file = FALSE;
+
+    /* The vectors of the platform vector file replace the compiled in ones */
+    status = val->vector_open("test_c006", vector_fields,
+                              sizeof(vector_fields)/sizeof(vector_fields[0]), &file);
+    if (status != VAL_STATUS_NOT_FOUND)
+    {
+        TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(6));
+        from_file = TRUE;
+        num_checks = file.count;
+    }
 
     if (num_checks == 0)
     {
@@ -43,8 +57,19 @@ int32_t psa_hash_compute_test(caller_security_t caller __UNUSED)
 
     for (i = 0; i < num_checks; i++)
     {
+        if (from_file == TRUE)
+        {
+            status = val->vector_next(&file, &vector, &vector_defaults, sizeof(vector));
+            TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(7));
+            check = &vector;
+        }
+        else
+        {
+            check = &check1[i];
+        }
+
         val->print(TEST, "Check %d: ", i+1);
-        val->print(TEST, check1[i].test_desc, 0);
+        val->print(TEST, check->test_desc, 0);
 
         /* Setting up the watchdog timer for each check */
         status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
@@ -52,22 +77,22 @@ int32_t psa_hash_compute_test(caller_security_t caller __UNUSED)
 
         /* Calculate the hash (digest) of a message */
         status = val->crypto_function(VAL_CRYPTO_HASH_COMPUTE,
-                                      check1[i].alg,
-                                      check1[i].input,
-                                      check1[i].input_length,
-                                      check1[i].hash,
-                                      check1[i].hash_size,
+                                      check->alg,
+                                      check->input,
+                                      check->input_length,
+                                      check->hash,
+                                      check->hash_size,
                                       &expected_hash_length);
-        TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(3));
+        TEST_ASSERT_EQUAL(status, check->expected_status, TEST_CHECKPOINT_NUM(3));
 
-        if (check1[i].expected_status != PSA_SUCCESS)
+        if (check->expected_status != PSA_SUCCESS)
         {
             continue;
         }
 
-        TEST_ASSERT_EQUAL(expected_hash_length, check1[i].expected_hash_length,
+        TEST_ASSERT_EQUAL(expected_hash_length, check->expected_hash_length,
                           TEST_CHECKPOINT_NUM(4));
-        TEST_ASSERT_MEMCMP(check1[i].hash, check1[i].expected_hash, expected_hash_length,
+        TEST_ASSERT_MEMCMP(check->hash, check->expected_hash, expected_hash_length,
                                                           TEST_CHECKPOINT_NUM(5));
     }
 
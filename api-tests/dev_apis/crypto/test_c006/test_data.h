@@ -29,6 +29,22 @@ typedef struct {
     psa_status_t            expected_status;
 } test_data;
 
+/* Members filled by the vector file test_c006.vec, when the platform provides one */
+static const val_vector_field_t vector_fields[] = {
+    VAL_VECTOR_TEXT_FIELD(test_data, test_desc),
+    VAL_VECTOR_INT_FIELD(test_data, alg),
+    VAL_VECTOR_BYTES_FIELD(test_data, input, input_length),
+    VAL_VECTOR_INT_FIELD(test_data, hash_size),
+    VAL_VECTOR_BYTES_FIELD(test_data, expected_hash, expected_hash_length),
+    VAL_VECTOR_INT_FIELD(test_data, expected_status),
+};
+
+static const test_data vector_defaults = {
+    .hash                 = expected_output,
+    .hash_size            = BUFFER_SIZE,
+    .expected_status      = PSA_SUCCESS,
+};
+
 static const test_data check1[] = {
 #ifdef ARCH_TEST_MD2
 {
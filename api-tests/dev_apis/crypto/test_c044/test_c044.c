@@ -49,6 +49,9 @@ int32_t psa_copy_key_test(caller_security_t caller __UNUSED)
     status = val->crypto_function(VAL_CRYPTO_INIT);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
+    /* Exercises the key copy, the keys are not taken from the key cache */
+    val->crypto_function(VAL_CRYPTO_KEY_CACHE_DISABLE);
+
     /* Set the key data buffer to the input base on algorithm */
     for (i = 0; i < num_checks; i++)
     {
@@ -29,7 +29,7 @@ extern  uint32_t g_test_count;
 
 int32_t psa_mac_compute_test(caller_security_t caller __UNUSED)
 {
-    uint8_t               data[BUFFER_SIZE];
+    uint8_t              *data;
     int                   num_checks = sizeof(check1)/sizeof(check1[0]);
     int32_t               i, status;
     size_t                length;
@@ -46,11 +46,15 @@ int32_t psa_mac_compute_test(caller_security_t caller __UNUSED)
     status = val->crypto_function(VAL_CRYPTO_INIT);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
+    data = val->scratch_alloc(BUFFER_SIZE);
+    if (data == NULL)
+        return VAL_STATUS_INSUFFICIENT_SIZE;
+
     for (i = 0; i < num_checks; i++)
     {
         val->print(TEST, "Check %d: ", g_test_count++);
         val->print(TEST, check1[i].test_desc, 0);
-        memset(data, 0, sizeof(data));
+        memset(data, 0, BUFFER_SIZE);
 
         /* Setting up the watchdog timer for each check */
         status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
@@ -87,7 +91,7 @@ int32_t psa_mac_compute_test(caller_security_t caller __UNUSED)
         /* Check if the MAC data matches with the expected data */
         TEST_ASSERT_MEMCMP(check1[i].expected_data, data, length, TEST_CHECKPOINT_NUM(7));
 
-        memset(data, 0, sizeof(data));
+        memset(data, 0, BUFFER_SIZE);
 
         /* Destroy the key */
         status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
@@ -31,7 +31,7 @@ int32_t psa_aead_verify_test(caller_security_t caller __UNUSED)
 {
 #if (((defined(ARCH_TEST_CCM) || defined(ARCH_TEST_GCM)) && defined(ARCH_TEST_AES_128)) && \
 (!defined(ARCH_TEST_AEAD_MULTISTAGE_OFF)))
-    uint8_t  output[BUFFER_SIZE];
+    uint8_t *output;
     int32_t               i, status;
     size_t                length, verify_length;
     int                   num_checks = sizeof(check1)/sizeof(check1[0]);
@@ -49,6 +49,10 @@ int32_t psa_aead_verify_test(caller_security_t caller __UNUSED)
     status = val->crypto_function(VAL_CRYPTO_INIT);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
+    output = val->scratch_alloc(BUFFER_SIZE);
+    if (output == NULL)
+        return VAL_STATUS_INSUFFICIENT_SIZE;
+
     for (i = 0; i < num_checks; i++)
     {
         val->print(TEST, "Check %d: ", g_test_count++);
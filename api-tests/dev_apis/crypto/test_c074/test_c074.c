@@ -53,7 +53,7 @@ int32_t jpake_setup(psa_pake_operation_t *op, const uint8_t *user, const uint8_t
 {
    psa_status_t status;
 
-   val->print(DBG, "Starting with jpake setup \n", 0);
+   TEST_PRINT(DBG, "Starting with jpake setup \n", 0);
 
   /* Initialize PSA crypto library */
   status = val->crypto_function(VAL_CRYPTO_INIT);
@@ -100,7 +100,7 @@ int32_t spake2p_setup(psa_pake_operation_t *op, const uint8_t *user, const uint8
 {
   psa_status_t status;
 
-  val->print(DBG, "Starting with SPAKE2P setup...\n", 0);
+  TEST_PRINT(DBG, "Starting with SPAKE2P setup...\n", 0);
 
   /* Initialize PSA crypto library */
   status = val->crypto_function(VAL_CRYPTO_INIT);
@@ -53,7 +53,7 @@ int32_t jpake_setup_fun(psa_pake_operation_t *op, const uint8_t *user, const uin
                         psa_key_id_t pw_key, psa_pake_role_t role,
                         psa_pake_cipher_suite_t *cipher_suite)
 {
-   val->print(DBG, "Starting with JPAKE setup..\n", 0);
+   TEST_PRINT(DBG, "Starting with JPAKE setup..\n", 0);
 
    psa_status_t status;
 
@@ -99,7 +99,7 @@ int32_t spake2p_setup_fun(psa_pake_operation_t *op, const uint8_t *user, const u
                           const uint8_t *context, psa_key_id_t key, psa_pake_role_t role,
                           psa_pake_cipher_suite_t *cipher_suite)
 {
-  val->print(DBG, "Starting with spake2p setup...\n", 0);
+  TEST_PRINT(DBG, "Starting with spake2p setup...\n", 0);
 
   psa_status_t status;
 
@@ -295,7 +295,7 @@ int32_t psa_pake_input_test(caller_security_t caller __UNUSED)
                                               input, output_length);
                 TEST_ASSERT_EQUAL(status, check1[i].expected_status[1], TEST_CHECKPOINT_NUM(7));
 
-                val->print(DBG, "          JPAKE invalid signature check pass\n", 0);
+                TEST_PRINT(DBG, "          JPAKE invalid signature check pass\n", 0);
                 break;
               } else
                  {
@@ -385,7 +385,7 @@ int32_t psa_pake_input_test(caller_security_t caller __UNUSED)
                                                  input, output_length);
                    TEST_ASSERT_EQUAL(status, check1[i].expected_status[1], TEST_CHECKPOINT_NUM(16));
 
-                   val->print(DBG, "          spake2p Invalid signature check \n", 0);
+                   TEST_PRINT(DBG, "          spake2p Invalid signature check \n", 0);
                    break;
                   }
 
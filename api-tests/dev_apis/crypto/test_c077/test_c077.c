@@ -32,7 +32,7 @@ int32_t do_jpake_setup(psa_pake_operation_t *op, const uint8_t *user, const uint
 {
    psa_status_t status;
 
-   val->print(DBG, "Starting with jpake setup \n", 0);
+   TEST_PRINT(DBG, "Starting with jpake setup \n", 0);
 
   /* Initialize PSA crypto library */
   status = val->crypto_function(VAL_CRYPTO_INIT);
@@ -72,17 +72,22 @@ int32_t do_jpake_setup(psa_pake_operation_t *op, const uint8_t *user, const uint
    return VAL_STATUS_SUCCESS;
 }
 
+#define PAKE_MESSAGE_SIZE 1024
+
+/* Message buffer of the PAKE rounds, taken from the scratch arena by the test */
+static uint8_t *g_message;
+
 int32_t send_message(psa_pake_operation_t *from, psa_pake_operation_t *to, psa_pake_step_t step,
                      uint8_t n)
 {
   int32_t status;
-  uint8_t data[1024];
   size_t op_len;
 
-  status = val->crypto_function(VAL_CRYPTO_PAKE_OUTPUT, from, step, data, sizeof(data), &op_len);
+  status = val->crypto_function(VAL_CRYPTO_PAKE_OUTPUT, from, step, g_message, PAKE_MESSAGE_SIZE,
+                                &op_len);
   TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(n));
 
-  status = val->crypto_function(VAL_CRYPTO_PAKE_INPUT, to, step, data, op_len);
+  status = val->crypto_function(VAL_CRYPTO_PAKE_INPUT, to, step, g_message, op_len);
   TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(n + 1));
 
  return VAL_STATUS_SUCCESS;
@@ -120,7 +125,7 @@ int32_t do_jpake_rounds(psa_pake_operation_t *user, psa_pake_operation_t *peer,
 
     TEST_ASSERT_EQUAL(status, PSA_ERROR_BAD_STATE, TEST_CHECKPOINT_NUM(3));
 
-    val->print(DBG, "Check for bad state is successful \n", 0);
+    TEST_PRINT(DBG, "Check for bad state is successful \n", 0);
    } else {
 
   // Get and set g1
@@ -188,7 +193,7 @@ int32_t do_spake2p_setup(psa_pake_operation_t *op, const uint8_t *user, const ui
 {
   psa_status_t status;
 
-  val->print(DBG, "Starting with SPAKE2P setup...\n", 0);
+  TEST_PRINT(DBG, "Starting with SPAKE2P setup...\n", 0);
 
   /* Initialize PSA crypto library */
   status = val->crypto_function(VAL_CRYPTO_INIT);
@@ -267,7 +272,7 @@ int32_t do_spake2p_rounds(psa_pake_operation_t *client, psa_pake_operation_t *se
 
     TEST_ASSERT_EQUAL(status, PSA_ERROR_BAD_STATE, TEST_CHECKPOINT_NUM(3));
 
-    val->print(DBG, "Check for bad state is successful \n", 0);
+    TEST_PRINT(DBG, "Check for bad state is successful \n", 0);
    } else {
 
    /* Starting key exchange operation */
@@ -310,6 +315,10 @@ int32_t psa_pake_get_shared_key_test(caller_security_t caller __UNUSED)
     status = val->crypto_function(VAL_CRYPTO_INIT);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
+    g_message = val->scratch_alloc(PAKE_MESSAGE_SIZE);
+    if (g_message == NULL)
+        return VAL_STATUS_INSUFFICIENT_SIZE;
+
     for (i = 0; i < num_checks; i++)
      {
        val->print(TEST, "Check %d: ", g_test_count++);
@@ -82,16 +82,21 @@ int32_t psa_pake_jpake_setup(psa_pake_operation_t *op, const uint8_t *user, cons
    return status;
 }
 
+#define PAKE_MESSAGE_SIZE 1024
+
+/* Message buffer of the PAKE rounds, taken from the scratch arena by the test */
+static uint8_t *g_message;
+
 int32_t send_message_jpake(psa_pake_operation_t *from, psa_pake_operation_t *to,
                            psa_pake_step_t step)
 {
   int32_t status;
-  uint8_t data[1024];
   size_t op_len;
 
-  status = val->crypto_function(VAL_CRYPTO_PAKE_OUTPUT, from, step, data, sizeof(data), &op_len);
+  status = val->crypto_function(VAL_CRYPTO_PAKE_OUTPUT, from, step, g_message, PAKE_MESSAGE_SIZE,
+                                &op_len);
 
-  status = val->crypto_function(VAL_CRYPTO_PAKE_INPUT, to, step, data, op_len);
+  status = val->crypto_function(VAL_CRYPTO_PAKE_INPUT, to, step, g_message, op_len);
 
  return status;
 }
@@ -114,6 +119,10 @@ int32_t psa_pake_jpake_test(caller_security_t caller __UNUSED)
     status = val->crypto_function(VAL_CRYPTO_INIT);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
+    g_message = val->scratch_alloc(PAKE_MESSAGE_SIZE);
+    if (g_message == NULL)
+        return VAL_STATUS_INSUFFICIENT_SIZE;
+
     /* Setting up the watchdog timer for each check */
     status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
     TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
@@ -140,14 +149,14 @@ int32_t psa_pake_jpake_test(caller_security_t caller __UNUSED)
    /* setup Jpake operation for user */
     status = psa_pake_jpake_setup(&user, (const uint8_t *)"client", (const uint8_t *)"server",
                                    pw_key);
-    val->print(DBG, "Check 2: JPAKE operation setup for user done\n", 0);
+    TEST_PRINT(DBG, "Check 2: JPAKE operation setup for user done\n", 0);
 
     /* Setup jpake operation for peer */
     status = psa_pake_jpake_setup(&peer, (const uint8_t *)"server", (const uint8_t *)"client",
                                     pw_key);
-    val->print(DBG, "Check 3: JPAKE operation setup for peer done\n", 0);
+    TEST_PRINT(DBG, "Check 3: JPAKE operation setup for peer done\n", 0);
     /* Round 1 key exchange */
-    val->print(DBG, "Check 4: Starting Round1 Key Exchange from user to peer\n", 0);
+    TEST_PRINT(DBG, "Check 4: Starting Round1 Key Exchange from user to peer\n", 0);
     // Get and set g1
     status = send_message_jpake(&user, &peer, PSA_PAKE_STEP_KEY_SHARE);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
@@ -172,9 +181,9 @@ int32_t psa_pake_jpake_test(caller_security_t caller __UNUSED)
    status = send_message_jpake(&user, &peer, PSA_PAKE_STEP_ZK_PROOF);
    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(9));
 
-   val->print(DBG, "            Round1 Key Exchange from user to peer done\n", 0);
+   TEST_PRINT(DBG, "            Round1 Key Exchange from user to peer done\n", 0);
 
-   val->print(DBG, "Check 5: Starting Round1 Key Exchange from peer to user\n", 0);
+   TEST_PRINT(DBG, "Check 5: Starting Round1 Key Exchange from peer to user\n", 0);
    //Get and set g3
    status = send_message_jpake(&peer, &user, PSA_PAKE_STEP_KEY_SHARE);
    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(10));
@@ -199,11 +208,11 @@ int32_t psa_pake_jpake_test(caller_security_t caller __UNUSED)
    status = send_message_jpake(&peer, &user, PSA_PAKE_STEP_ZK_PROOF);
    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(15));
 
-   val->print(DBG, "            Round1 Key Exchange from peer to user done\n", 0);
+   TEST_PRINT(DBG, "            Round1 Key Exchange from peer to user done\n", 0);
 
   /* Round 2 Key exchange */
 
-    val->print(DBG, "Check 6: Starting Round2 Key Exchange from user to peer\n", 0);
+    TEST_PRINT(DBG, "Check 6: Starting Round2 Key Exchange from user to peer\n", 0);
 
    // Get and set A
    status = send_message_jpake(&user, &peer, PSA_PAKE_STEP_KEY_SHARE);
@@ -217,9 +226,9 @@ int32_t psa_pake_jpake_test(caller_security_t caller __UNUSED)
   status = send_message_jpake(&user, &peer, PSA_PAKE_STEP_ZK_PROOF);
   TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(18));
 
-   val->print(DBG, "            Round2 Key Exchange from user to peer done\n", 0);
+   TEST_PRINT(DBG, "            Round2 Key Exchange from user to peer done\n", 0);
 
-   val->print(DBG, "Check 7: Starting Round2 Key Exchange from peer to user\n", 0);
+   TEST_PRINT(DBG, "Check 7: Starting Round2 Key Exchange from peer to user\n", 0);
 
   // Get and Set B
   status = send_message_jpake(&peer, &user, PSA_PAKE_STEP_KEY_SHARE);
@@ -233,7 +242,7 @@ int32_t psa_pake_jpake_test(caller_security_t caller __UNUSED)
   status = send_message_jpake(&peer, &user, PSA_PAKE_STEP_ZK_PROOF);
   TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(21));
 
-  val->print(DBG, "            Round2 Key Exchange from peer to user done\n", 0);
+  TEST_PRINT(DBG, "            Round2 Key Exchange from peer to user done\n", 0);
 
   /* Setup the attributes for the key */
   val->crypto_function(VAL_CRYPTO_SET_KEY_TYPE,
@@ -246,7 +255,7 @@ int32_t psa_pake_jpake_test(caller_security_t caller __UNUSED)
                        &attributes,
                        PSA_ALG_TLS12_ECJPAKE_TO_PMS);
 
-  val->print(DBG, "Check 8: Derive shared secret from user \n", 0);
+  TEST_PRINT(DBG, "Check 8: Derive shared secret from user \n", 0);
 
   /* Setup Key Derivation for User */
   status = val->crypto_function(VAL_CRYPTO_PAKE_GET_SHARED_KEY, &user, &attributes, &key);
@@ -271,16 +280,16 @@ int32_t psa_pake_jpake_test(caller_security_t caller __UNUSED)
   status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_ABORT, &kdf);
   TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(27));
 
-  val->print(DBG, "[secret1] : ", 0);
+  TEST_PRINT(DBG, "[secret1] : ", 0);
   for (i = 0; i < 32; i++)
   {
-    val->print(DBG, "%x", secret1[i]);
+    TEST_PRINT(DBG, "%x", secret1[i]);
   }
 
   status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, key);
   TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(28));
 
-  val->print(DBG, "\nCheck 9: Derive shared secret from peer \n", 0);
+  TEST_PRINT(DBG, "\nCheck 9: Derive shared secret from peer \n", 0);
 
   /* Setup Key Derivation for Peer */
   status = val->crypto_function(VAL_CRYPTO_PAKE_GET_SHARED_KEY, &peer, &attributes, &key);
@@ -302,14 +311,14 @@ int32_t psa_pake_jpake_test(caller_security_t caller __UNUSED)
                                &kdf, secret2, sizeof(secret2));
   TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(33));
 
-  val->print(DBG, "[secret2] : ", 0);
+  TEST_PRINT(DBG, "[secret2] : ", 0);
 
   for (i = 0; i < 32; i++)
   {
-    val->print(DBG, "%x", secret2[i]);
+    TEST_PRINT(DBG, "%x", secret2[i]);
   }
 
-  val->print(DBG, "\n", 0);
+  TEST_PRINT(DBG, "\n", 0);
 
   status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_ABORT, &kdf);
   TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(34));
@@ -83,16 +83,21 @@ int32_t psa_pake_spake2p_setup(psa_pake_operation_t *op, const uint8_t *user, co
   return status;
 }
 
+#define PAKE_MESSAGE_SIZE 1024
+
+/* Message buffer of the PAKE rounds, taken from the scratch arena by the test */
+static uint8_t *g_message;
+
 int32_t send_message_spake2p(psa_pake_operation_t *from, psa_pake_operation_t *to,
                              psa_pake_step_t step)
 {
   int32_t status;
-  uint8_t data[1024];
   size_t op_len;
 
-  status = val->crypto_function(VAL_CRYPTO_PAKE_OUTPUT, from, step, data, sizeof(data), &op_len);
+  status = val->crypto_function(VAL_CRYPTO_PAKE_OUTPUT, from, step, g_message, PAKE_MESSAGE_SIZE,
+                                &op_len);
 
-  status = val->crypto_function(VAL_CRYPTO_PAKE_INPUT, to, step, data, op_len);
+  status = val->crypto_function(VAL_CRYPTO_PAKE_INPUT, to, step, g_message, op_len);
 
  return status;
 }
@@ -129,6 +134,10 @@ int32_t psa_pake_spake2p_test(caller_security_t caller __UNUSED)
     status = val->crypto_function(VAL_CRYPTO_INIT);
     TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
 
+    g_message = val->scratch_alloc(PAKE_MESSAGE_SIZE);
+    if (g_message == NULL)
+        return VAL_STATUS_INSUFFICIENT_SIZE;
+
     for (j = 0 ; j < num_checks ; j++) {
 
     val->print(TEST, "Check %d: ", g_test_count++);
@@ -186,12 +195,12 @@ int32_t psa_pake_spake2p_test(caller_security_t caller __UNUSED)
    /* Setup spake2p operation for prover/client */
     status = psa_pake_spake2p_setup(&client, (const uint8_t *)"client", (const uint8_t *)"server",
                             (const uint8_t *)"context", check1[j].alg, PSA_PAKE_ROLE_CLIENT, ckey);
-    val->print(DBG, "       1 : SPAKE2P operation setup for prover done \n", 0);
+    TEST_PRINT(DBG, "       1 : SPAKE2P operation setup for prover done \n", 0);
 
   /* Setup spake2p operation for verifier/server */
    status = psa_pake_spake2p_setup(&server, (const uint8_t *)"server", (const uint8_t *)"client",
                             (const uint8_t *)"context", check1[j].alg, PSA_PAKE_ROLE_SERVER, skey);
-   val->print(DBG, "       2 : SPAKE2P operation setup for verifier done \n", 0);
+   TEST_PRINT(DBG, "       2 : SPAKE2P operation setup for verifier done \n", 0);
 
    /* Starting key exchange operation */
 
@@ -211,7 +220,7 @@ int32_t psa_pake_spake2p_test(caller_security_t caller __UNUSED)
    status = send_message_spake2p(&client, &server, PSA_PAKE_STEP_CONFIRM);
    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(10));
 
-   val->print(DBG, "       3 : SPAKE2P key exchange between prover and verifier done\n", 0);
+   TEST_PRINT(DBG, "       3 : SPAKE2P key exchange between prover and verifier done\n", 0);
    /* Extract Shared Secret as a key derivation key */
 
    /* Setup the attributes for the key */
@@ -225,7 +234,7 @@ int32_t psa_pake_spake2p_test(caller_security_t caller __UNUSED)
                           &attributes,
                           PSA_ALG_HKDF(PSA_ALG_SHA_256));
 
-     val->print(DBG, "       4 : Derive shared secret from prover \n", 0);
+     TEST_PRINT(DBG, "       4 : Derive shared secret from prover \n", 0);
 
     /* Setup Key Derivation for prover/client */
      status = val->crypto_function(VAL_CRYPTO_PAKE_GET_SHARED_KEY,
@@ -256,17 +265,17 @@ int32_t psa_pake_spake2p_test(caller_security_t caller __UNUSED)
      status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_ABORT, &kdf);
      TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(17));
 
-     val->print(DBG, " secret1 : ", 0);
+     TEST_PRINT(DBG, " secret1 : ", 0);
      for (i = 0; i < 32; i++)
       {
-        val->print(DBG, "%x", secret1[i]);
+        TEST_PRINT(DBG, "%x", secret1[i]);
       }
-      val->print(DBG, "\n", 0);
+      TEST_PRINT(DBG, "\n", 0);
 
      status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, shared_key);
      TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(18));
 
-     val->print(DBG, "       5 : Derive shared secret from verifier \n", 0);
+     TEST_PRINT(DBG, "       5 : Derive shared secret from verifier \n", 0);
 
     /* Setup Key Derivation for prover/client */
      status = val->crypto_function(VAL_CRYPTO_PAKE_GET_SHARED_KEY,
@@ -297,13 +306,13 @@ int32_t psa_pake_spake2p_test(caller_security_t caller __UNUSED)
      status = val->crypto_function(VAL_CRYPTO_KEY_DERIVATION_ABORT, &kdf);
      TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(25));
 
-     val->print(DBG, " secret2 : ", 0);
+     TEST_PRINT(DBG, " secret2 : ", 0);
      for (i = 0; i < 32; i++)
       {
-        val->print(DBG, "%x", secret2[i]);
+        TEST_PRINT(DBG, "%x", secret2[i]);
       }
 
-       val->print(DBG, "\n", 0);
+       TEST_PRINT(DBG, "\n", 0);
 
        status = val->crypto_function(VAL_CRYPTO_DESTROY_KEY, shared_key);
        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(26));
@@ -0,0 +1,215 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "test_bench_common.h"
+
+uint8_t bench_input[BENCH_BUFFER_SIZE];
+uint8_t bench_output[BENCH_OUTPUT_SIZE];
+
+/* Latency of each sample in nano seconds, saturated to 4.29 seconds */
+static uint32_t bench_samples[PLATFORM_BENCH_LATENCY_SAMPLES];
+
+bool_t bench_timer_available(val_api_t *val_api)
+{
+    if (val_api->get_time_ns() == 0)
+    {
+        val_api->print(TEST, "No timestamp counter available on the platform\n", 0);
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+psa_status_t bench_import_key(val_api_t *val_api, psa_key_type_t type, psa_key_usage_t usage,
+                              psa_algorithm_t alg, const uint8_t *data, size_t data_length,
+                              psa_key_id_t *key)
+{
+    psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+
+    val_api->crypto->set_key_type(&attributes, type);
+    val_api->crypto->set_key_usage_flags(&attributes, usage);
+    val_api->crypto->set_key_algorithm(&attributes, alg);
+
+    return val_api->crypto->import_key(&attributes, data, data_length, key);
+}
+
+static void bench_report(val_api_t *val_api, size_t length, uint32_t ops, uint64_t elapsed_ns)
+{
+    uint64_t elapsed_us = (elapsed_ns / 1000) ? (elapsed_ns / 1000) : 1;
+    uint64_t latency_ns = elapsed_ns / ops;
+
+    val_api->print(TEST, "\t%d B: ", (int32_t)length);
+    val_api->print(TEST, "%d KiB/s, ",
+                   (int32_t)(((uint64_t)length * ops * 1000000 / 1024) / elapsed_us));
+    if (latency_ns < 1000000)
+        val_api->print(TEST, "%d ns/op\n", (int32_t)latency_ns);
+    else
+        val_api->print(TEST, "%d us/op\n", (int32_t)(latency_ns / 1000));
+}
+
+int32_t bench_sweep(val_api_t *val_api, const char *mode, bench_op_t op, const void *ctx)
+{
+    return bench_sweep_limit(val_api, mode, op, ctx, BENCH_MAX_MSG_SIZE);
+}
+
+int32_t bench_sweep_limit(val_api_t *val_api, const char *mode, bench_op_t op, const void *ctx,
+                          size_t max_length)
+{
+    int32_t  status;
+    size_t   length, next;
+    uint32_t i, batch, ops;
+    uint64_t start, elapsed;
+
+    val_api->print(TEST, "\t", 0);
+    val_api->print(TEST, mode, 0);
+    val_api->print(TEST, "\n", 0);
+
+    for (length = BENCH_MIN_MSG_SIZE; length <= MIN(max_length, BENCH_MAX_MSG_SIZE); length = next)
+    {
+        /* The sweep ends on the largest length of the operation */
+        next = length * BENCH_MSG_SIZE_STEP;
+        if ((length < max_length) && (next > max_length))
+            next = max_length;
+
+        if (length > PLATFORM_BENCH_MAX_MSG_SIZE)
+        {
+            val_api->print(TEST, "\t%d B: skipped, above PLATFORM_BENCH_MAX_MSG_SIZE\n",
+                           (int32_t)length);
+            continue;
+        }
+
+        status = val_api->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+        if (status != VAL_STATUS_SUCCESS)
+            return status;
+
+        /* Warm up the caches and the implementation, and check the operation works */
+        status = op(ctx, length);
+        if (status != PSA_SUCCESS)
+            return status;
+
+        /* Double the batch until it runs long enough for the timestamp resolution */
+        ops   = 0;
+        batch = 1;
+        start = val_api->get_time_ns();
+        do {
+            for (i = 0; i < batch; i++)
+            {
+                status = op(ctx, length);
+                if (status != PSA_SUCCESS)
+                    return status;
+            }
+
+            ops    += batch;
+            batch  *= 2;
+            elapsed = val_api->get_time_ns() - start;
+        } while ((elapsed < (uint64_t)BENCH_MIN_TIME_US * 1000) && (ops < BENCH_MAX_ITERATIONS));
+
+        bench_report(val_api, length, ops, elapsed);
+    }
+
+    return PSA_SUCCESS;
+}
+
+void bench_print_time(val_api_t *val_api, const char *label, uint32_t time_ns)
+{
+    val_api->print(TEST, label, 0);
+    if (time_ns < 1000000)
+        val_api->print(TEST, " %d ns", (int32_t)time_ns);
+    else
+        val_api->print(TEST, " %d us", (int32_t)(time_ns / 1000));
+}
+
+/* Shell sort, the samples are not worth pulling qsort into the MCU images */
+static void bench_sort(uint32_t *array, uint32_t count)
+{
+    uint32_t gap, i, j, value;
+
+    for (gap = count / 2; gap > 0; gap /= 2)
+    {
+        for (i = gap; i < count; i++)
+        {
+            value = array[i];
+            for (j = i; (j >= gap) && (array[j - gap] > value); j -= gap)
+                array[j] = array[j - gap];
+            array[j] = value;
+        }
+    }
+}
+
+int32_t bench_latency(val_api_t *val_api, const char *name, bench_sample_t op,
+                      bench_sample_t cleanup, void *ctx, uint32_t samples)
+{
+    return bench_latency_median(val_api, name, op, cleanup, ctx, samples, NULL);
+}
+
+int32_t bench_latency_median(val_api_t *val_api, const char *name, bench_sample_t op,
+                             bench_sample_t cleanup, void *ctx, uint32_t samples,
+                             uint32_t *median)
+{
+    int32_t  status;
+    uint32_t i;
+    uint64_t start, elapsed;
+
+    samples = MIN(MAX(samples, 1), PLATFORM_BENCH_LATENCY_SAMPLES);
+
+    for (i = 0; i < samples; i++)
+    {
+        status = val_api->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+        if (status != VAL_STATUS_SUCCESS)
+            return status;
+
+        start   = val_api->get_time_ns();
+        status  = op(ctx);
+        elapsed = val_api->get_time_ns() - start;
+        if (status != PSA_SUCCESS)
+            return status;
+
+        bench_samples[i] = (elapsed > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32_t)elapsed;
+
+        if (cleanup != NULL)
+        {
+            status = cleanup(ctx);
+            if (status != PSA_SUCCESS)
+                return status;
+        }
+    }
+
+    if (name != NULL)
+        bench_print_latency(val_api, name, bench_samples, samples);
+    else
+        bench_sort(bench_samples, samples);
+
+    if (median != NULL)
+        *median = bench_samples[(samples - 1) / 2];
+
+    return PSA_SUCCESS;
+}
+
+void bench_print_latency(val_api_t *val_api, const char *name, uint32_t *samples, uint32_t count)
+{
+    bench_sort(samples, count);
+
+    /* Nearest rank percentiles */
+    val_api->print(TEST, "\t", 0);
+    val_api->print(TEST, name, 0);
+    val_api->print(TEST, ": %d samples,", (int32_t)count);
+    bench_print_time(val_api, " min", samples[0]);
+    bench_print_time(val_api, ", median", samples[(count - 1) / 2]);
+    bench_print_time(val_api, ", p99", samples[(count * 99 + 99) / 100 - 1]);
+    bench_print_time(val_api, ", max", samples[count - 1]);
+    val_api->print(TEST, "\n", 0);
+}
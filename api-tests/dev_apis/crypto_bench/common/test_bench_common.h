@@ -0,0 +1,181 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _TEST_BENCH_COMMON_H_
+#define _TEST_BENCH_COMMON_H_
+
+#include "val_interfaces.h"
+#include "val_crypto.h"
+#include "test_crypto_common.h"
+
+/* Largest message of the benchmarks, sizes above it are skipped. Platforms with
+ * enough memory for the two 1 MiB message buffers can raise it in pal_config.h.
+ */
+#ifndef PLATFORM_BENCH_MAX_MSG_SIZE
+#define PLATFORM_BENCH_MAX_MSG_SIZE    (16 * 1024)
+#endif
+
+/* Message sizes of the sweep, from BENCH_MIN_MSG_SIZE to BENCH_MAX_MSG_SIZE */
+#define BENCH_MIN_MSG_SIZE             16
+#define BENCH_MAX_MSG_SIZE             (1024 * 1024)
+#define BENCH_MSG_SIZE_STEP            4
+
+/* Size of the updates of a multipart operation */
+#define BENCH_MULTIPART_SIZE           4096
+
+/* Room left in the output buffer for an IV, a padding block or a tag */
+#define BENCH_OUTPUT_OVERHEAD          64
+
+/* A size is measured for at least BENCH_MIN_TIME_US, or BENCH_MAX_ITERATIONS operations */
+#ifndef BENCH_MIN_TIME_US
+#define BENCH_MIN_TIME_US              50000
+#endif
+#define BENCH_MAX_ITERATIONS           (1 << 20)
+
+/* Number of samples of a latency distribution. The slow operations, e.g RSA key
+ * generation or the large FFDH groups, take BENCH_LATENCY_SLOW_SAMPLES samples.
+ */
+#ifndef PLATFORM_BENCH_LATENCY_SAMPLES
+#define PLATFORM_BENCH_LATENCY_SAMPLES 1000
+#endif
+#define BENCH_LATENCY_SAMPLES          PLATFORM_BENCH_LATENCY_SAMPLES
+#define BENCH_LATENCY_SLOW_SAMPLES     MAX(PLATFORM_BENCH_LATENCY_SAMPLES / 20, 1)
+
+/* Bytes streamed through a multipart operation for each update size. The stream is
+ * cut short to BENCH_STREAM_MAX_UPDATES updates for the small update sizes.
+ */
+#ifndef PLATFORM_BENCH_STREAM_SIZE
+#define PLATFORM_BENCH_STREAM_SIZE     (1024 * 1024)
+#endif
+#define BENCH_STREAM_MAX_UPDATES       (1 << 20)
+
+#define BENCH_BUFFER_SIZE              PLATFORM_BENCH_MAX_MSG_SIZE
+#define BENCH_OUTPUT_SIZE              (PLATFORM_BENCH_MAX_MSG_SIZE + BENCH_OUTPUT_OVERHEAD)
+
+/* Runs the benchmarked operation once on the first length bytes of bench_input */
+typedef psa_status_t (*bench_op_t)(const void *ctx, size_t length);
+
+/* Runs one sample of a latency distribution */
+typedef psa_status_t (*bench_sample_t)(void *ctx);
+
+/* Context of the benchmarks of a keyed algorithm */
+typedef struct {
+    const void             *data;
+    psa_key_id_t            key;
+} bench_key_ctx_t;
+
+extern uint8_t bench_input[BENCH_BUFFER_SIZE];
+extern uint8_t bench_output[BENCH_OUTPUT_SIZE];
+
+/**
+    @brief    - Tells if the platform can time the benchmarks
+    @param    - val_api : VAL API table of the calling test
+    @return   - TRUE if a timestamp counter is available, FALSE otherwise
+**/
+bool_t bench_timer_available(val_api_t *val_api);
+
+/**
+    @brief    - Imports the key of a benchmark
+    @param    - val_api     : VAL API table of the calling test
+                type        : Key type
+                usage       : Key usage flags
+                alg         : Permitted algorithm
+                data        : Key material
+                data_length : Size of the key material
+                key         : Returns the identifier of the imported key
+    @return   - PSA status
+**/
+psa_status_t bench_import_key(val_api_t *val_api, psa_key_type_t type, psa_key_usage_t usage,
+                              psa_algorithm_t alg, const uint8_t *data, size_t data_length,
+                              psa_key_id_t *key);
+
+/**
+    @brief    - Measures an operation over the message sizes of the sweep and prints
+                the throughput and latency of each size
+    @param    - val_api : VAL API table of the calling test
+                mode    : Name of the benchmarked mode, e.g "one-shot"
+                op      : Operation to run
+                ctx     : Context passed to the operation
+    @return   - PSA_SUCCESS, or the error status of the operation
+**/
+int32_t bench_sweep(val_api_t *val_api, const char *mode, bench_op_t op, const void *ctx);
+
+/**
+    @brief    - Same as bench_sweep, for an operation limited to max_length bytes, e.g a
+                key derivation of limited capacity. The sweep ends on max_length.
+    @param    - val_api    : VAL API table of the calling test
+                mode       : Name of the benchmarked mode, e.g "one-shot"
+                op         : Operation to run
+                ctx        : Context passed to the operation
+                max_length : Largest length the operation supports
+    @return   - PSA_SUCCESS, or the error status of the operation
+**/
+int32_t bench_sweep_limit(val_api_t *val_api, const char *mode, bench_op_t op, const void *ctx,
+                          size_t max_length);
+
+/**
+    @brief    - Times each run of an operation and prints the min, median, p99 and max
+                latency of the runs
+    @param    - val_api : VAL API table of the calling test
+                name    : Name of the operation, e.g "sign"
+                op      : Operation to time
+                cleanup : Untimed action run after each sample, e.g to destroy a
+                          generated key. NULL if not needed.
+                ctx     : Context passed to the operation and to the cleanup
+                samples : Number of samples, at most PLATFORM_BENCH_LATENCY_SAMPLES
+    @return   - PSA_SUCCESS, or the error status of the operation
+**/
+int32_t bench_latency(val_api_t *val_api, const char *name, bench_sample_t op,
+                      bench_sample_t cleanup, void *ctx, uint32_t samples);
+
+/**
+    @brief    - Same as bench_latency, also returning the median latency, e.g to compare
+                two operations
+    @param    - val_api : VAL API table of the calling test
+                name    : Name of the operation, NULL to only return the median
+                op      : Operation to time
+                cleanup : Untimed action run after each sample, NULL if not needed
+                ctx     : Context passed to the operation and to the cleanup
+                samples : Number of samples, at most PLATFORM_BENCH_LATENCY_SAMPLES
+                median  : Returns the median latency in nano seconds, NULL if not needed
+    @return   - PSA_SUCCESS, or the error status of the operation
+**/
+int32_t bench_latency_median(val_api_t *val_api, const char *name, bench_sample_t op,
+                             bench_sample_t cleanup, void *ctx, uint32_t samples,
+                             uint32_t *median);
+
+/**
+    @brief    - Sorts latency samples timed by the caller and prints their min, median,
+                p99 and max, the same way as bench_latency
+    @param    - val_api : VAL API table of the calling test
+                name    : Name of the operation, e.g "round 1"
+                samples : Latency of each sample in nano seconds, sorted in place
+                count   : Number of samples, at least 1
+    @return   - void
+**/
+void bench_print_latency(val_api_t *val_api, const char *name, uint32_t *samples, uint32_t count);
+
+/**
+    @brief    - Prints a label followed by a time, in ns below 1 ms and in us above
+    @param    - val_api : VAL API table of the calling test
+                label   : Label printed before the time, e.g " max"
+                time_ns : Time in nano seconds
+    @return   - void
+**/
+void bench_print_time(val_api_t *val_api, const char *label, uint32_t time_ns);
+
+#endif /* _TEST_BENCH_COMMON_H_ */
@@ -0,0 +1,92 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "test_b001.h"
+#include "test_data.h"
+
+const client_test_t test_b001_crypto_list[] = {
+    NULL,
+    psa_hash_bench_test,
+    NULL,
+};
+
+static psa_status_t hash_one_shot(const void *ctx, size_t length)
+{
+    const test_data *data = ctx;
+    size_t           hash_length;
+
+    return val->crypto->hash_compute(data->alg, bench_input, length,
+                                     bench_output, BENCH_OUTPUT_SIZE, &hash_length);
+}
+
+static psa_status_t hash_multipart(const void *ctx, size_t length)
+{
+    const test_data      *data      = ctx;
+    psa_hash_operation_t  operation = PSA_HASH_OPERATION_INIT;
+    psa_status_t          status;
+    size_t                offset, chunk, hash_length;
+
+    status = val->crypto->hash_setup(&operation, data->alg);
+    for (offset = 0; (status == PSA_SUCCESS) && (offset < length); offset += chunk)
+    {
+        chunk  = MIN(length - offset, BENCH_MULTIPART_SIZE);
+        status = val->crypto->hash_update(&operation, bench_input + offset, chunk);
+    }
+
+    if (status == PSA_SUCCESS)
+        status = val->crypto->hash_finish(&operation, bench_output, BENCH_OUTPUT_SIZE,
+                                          &hash_length);
+
+    if (status != PSA_SUCCESS)
+        val->crypto->hash_abort(&operation);
+
+    return status;
+}
+
+int32_t psa_hash_bench_test(caller_security_t caller __UNUSED)
+{
+    int32_t               i, status;
+    int32_t               num_checks = sizeof(check1)/sizeof(check1[0]);
+
+    if (num_checks == 0)
+    {
+        val->print(TEST, "No test available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    if (!bench_timer_available(val))
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto->crypto_init();
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    for (i = 0; i < num_checks; i++)
+    {
+        val->print(TEST, "Check %d: ", i+1);
+        val->print(TEST, check1[i].test_desc, 0);
+
+        status = bench_sweep(val, "one-shot", hash_one_shot, &check1[i]);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        status = bench_sweep(val, "multipart", hash_multipart, &check1[i]);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
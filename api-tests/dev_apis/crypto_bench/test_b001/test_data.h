@@ -0,0 +1,74 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "test_bench_common.h"
+
+typedef struct {
+    char                    test_desc[50];
+    psa_algorithm_t         alg;
+} test_data;
+
+static const test_data check1[] = {
+#ifdef ARCH_TEST_MD5
+{
+    .test_desc = "Benchmark hash - MD5\n",
+    .alg       = PSA_ALG_MD5,
+},
+#endif
+
+#ifdef ARCH_TEST_RIPEMD160
+{
+    .test_desc = "Benchmark hash - RIPEMD160\n",
+    .alg       = PSA_ALG_RIPEMD160,
+},
+#endif
+
+#ifdef ARCH_TEST_SHA1
+{
+    .test_desc = "Benchmark hash - SHA1\n",
+    .alg       = PSA_ALG_SHA_1,
+},
+#endif
+
+#ifdef ARCH_TEST_SHA224
+{
+    .test_desc = "Benchmark hash - SHA224\n",
+    .alg       = PSA_ALG_SHA_224,
+},
+#endif
+
+#ifdef ARCH_TEST_SHA256
+{
+    .test_desc = "Benchmark hash - SHA256\n",
+    .alg       = PSA_ALG_SHA_256,
+},
+#endif
+
+#ifdef ARCH_TEST_SHA384
+{
+    .test_desc = "Benchmark hash - SHA384\n",
+    .alg       = PSA_ALG_SHA_384,
+},
+#endif
+
+#ifdef ARCH_TEST_SHA512
+{
+    .test_desc = "Benchmark hash - SHA512\n",
+    .alg       = PSA_ALG_SHA_512,
+},
+#endif
+};
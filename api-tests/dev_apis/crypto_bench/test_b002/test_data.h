@@ -0,0 +1,62 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "test_bench_common.h"
+
+typedef struct {
+    char                    test_desc[50];
+    psa_key_type_t          type;
+    const uint8_t          *data;
+    size_t                  data_length;
+    psa_algorithm_t         alg;
+} test_data;
+
+static const test_data check1[] = {
+#ifdef ARCH_TEST_HMAC
+#ifdef ARCH_TEST_SHA256
+{
+    .test_desc   = "Benchmark MAC - HMAC SHA256\n",
+    .type        = PSA_KEY_TYPE_HMAC,
+    .data        = key_data,
+    .data_length = 32,
+    .alg         = PSA_ALG_HMAC(PSA_ALG_SHA_256),
+},
+#endif
+
+#ifdef ARCH_TEST_SHA512
+{
+    .test_desc   = "Benchmark MAC - HMAC SHA512\n",
+    .type        = PSA_KEY_TYPE_HMAC,
+    .data        = key_data,
+    .data_length = 64,
+    .alg         = PSA_ALG_HMAC(PSA_ALG_SHA_512),
+},
+#endif
+#endif
+
+#ifdef ARCH_TEST_CMAC
+#ifdef ARCH_TEST_AES_128
+{
+    .test_desc   = "Benchmark MAC - CMAC AES 128\n",
+    .type        = PSA_KEY_TYPE_AES,
+    .data        = key_data,
+    .data_length = AES_16B_KEY_SIZE,
+    .alg         = PSA_ALG_CMAC,
+},
+#endif
+#endif
+};
@@ -0,0 +1,122 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "test_b004.h"
+#include "test_data.h"
+
+const client_test_t test_b004_crypto_list[] = {
+    NULL,
+    psa_aead_bench_test,
+    NULL,
+};
+
+static psa_status_t aead_one_shot(const void *ctx, size_t length)
+{
+    const bench_key_ctx_t *bench = ctx;
+    const test_data       *data  = bench->data;
+    size_t                 output_length;
+
+    return val->crypto->aead_encrypt(bench->key, data->alg, data->nonce, data->nonce_length,
+                                     additional_data, BENCH_AD_LENGTH, bench_input, length,
+                                     bench_output, BENCH_OUTPUT_SIZE, &output_length);
+}
+
+static psa_status_t aead_multipart(const void *ctx, size_t length)
+{
+    const bench_key_ctx_t *bench     = ctx;
+    const test_data       *data      = bench->data;
+    psa_aead_operation_t   operation = PSA_AEAD_OPERATION_INIT;
+    psa_status_t           status;
+    size_t                 offset, chunk, output_length, tag_length;
+    size_t                 total_length = 0;
+    uint8_t                tag[PSA_AEAD_TAG_MAX_SIZE];
+
+    status = val->crypto->aead_encrypt_setup(&operation, bench->key, data->alg);
+
+    /* Required by CCM, which needs the lengths before processing any data */
+    if (status == PSA_SUCCESS)
+        status = val->crypto->aead_set_lengths(&operation, BENCH_AD_LENGTH, length);
+
+    if (status == PSA_SUCCESS)
+        status = val->crypto->aead_set_nonce(&operation, data->nonce, data->nonce_length);
+
+    if (status == PSA_SUCCESS)
+        status = val->crypto->aead_update_ad(&operation, additional_data, BENCH_AD_LENGTH);
+
+    for (offset = 0; (status == PSA_SUCCESS) && (offset < length); offset += chunk)
+    {
+        chunk  = MIN(length - offset, BENCH_MULTIPART_SIZE);
+        status = val->crypto->aead_update(&operation, bench_input + offset, chunk,
+                                          bench_output + total_length,
+                                          BENCH_OUTPUT_SIZE - total_length, &output_length);
+        total_length += output_length;
+    }
+
+    if (status == PSA_SUCCESS)
+        status = val->crypto->aead_finish(&operation, bench_output + total_length,
+                                          BENCH_OUTPUT_SIZE - total_length, &output_length,
+                                          tag, sizeof(tag), &tag_length);
+
+    if (status != PSA_SUCCESS)
+        val->crypto->aead_abort(&operation);
+
+    return status;
+}
+
+int32_t psa_aead_bench_test(caller_security_t caller __UNUSED)
+{
+    int32_t               i, status;
+    int32_t               num_checks = sizeof(check1)/sizeof(check1[0]);
+    bench_key_ctx_t       bench;
+
+    if (num_checks == 0)
+    {
+        val->print(TEST, "No test available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    if (!bench_timer_available(val))
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto->crypto_init();
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    for (i = 0; i < num_checks; i++)
+    {
+        val->print(TEST, "Check %d: ", i+1);
+        val->print(TEST, check1[i].test_desc, 0);
+
+        bench.data = &check1[i];
+        status = bench_import_key(val, check1[i].type, PSA_KEY_USAGE_ENCRYPT,
+                                  check1[i].alg, check1[i].data, check1[i].data_length,
+                                  &bench.key);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        status = bench_sweep(val, "one-shot", aead_one_shot, &bench);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
+
+        status = bench_sweep(val, "multipart", aead_multipart, &bench);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
+
+        status = val->crypto->destroy_key(bench.key);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
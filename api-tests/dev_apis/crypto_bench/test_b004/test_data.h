@@ -0,0 +1,84 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "test_bench_common.h"
+
+#define BENCH_AD_LENGTH        32
+
+typedef struct {
+    char                    test_desc[50];
+    psa_key_type_t          type;
+    const uint8_t          *data;
+    size_t                  data_length;
+    psa_algorithm_t         alg;
+    const uint8_t          *nonce;
+    size_t                  nonce_length;
+} test_data;
+
+static const test_data check1[] = {
+#ifdef ARCH_TEST_GCM
+#ifdef ARCH_TEST_AES_128
+{
+    .test_desc    = "Benchmark AEAD - AES 128 GCM\n",
+    .type         = PSA_KEY_TYPE_AES,
+    .data         = key_data,
+    .data_length  = AES_16B_KEY_SIZE,
+    .alg          = PSA_ALG_GCM,
+    .nonce        = nonce,
+    .nonce_length = 12,
+},
+#endif
+
+#ifdef ARCH_TEST_AES_256
+{
+    .test_desc    = "Benchmark AEAD - AES 256 GCM\n",
+    .type         = PSA_KEY_TYPE_AES,
+    .data         = key_data,
+    .data_length  = AES_32B_KEY_SIZE,
+    .alg          = PSA_ALG_GCM,
+    .nonce        = nonce,
+    .nonce_length = 12,
+},
+#endif
+#endif
+
+#ifdef ARCH_TEST_CCM
+#ifdef ARCH_TEST_AES_128
+{
+    .test_desc    = "Benchmark AEAD - AES 128 CCM\n",
+    .type         = PSA_KEY_TYPE_AES,
+    .data         = key_data,
+    .data_length  = AES_16B_KEY_SIZE,
+    .alg          = PSA_ALG_CCM,
+    .nonce        = nonce,
+    .nonce_length = 13,
+},
+#endif
+#endif
+
+#ifdef ARCH_TEST_CHACHA20
+{
+    .test_desc    = "Benchmark AEAD - CHACHA20_POLY1305\n",
+    .type         = PSA_KEY_TYPE_CHACHA20,
+    .data         = chacha20_key,
+    .data_length  = 32,
+    .alg          = PSA_ALG_CHACHA20_POLY1305,
+    .nonce        = aead_chacha20_poly1305_nonce,
+    .nonce_length = 12,
+},
+#endif
+};
@@ -0,0 +1,110 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "test_bench_common.h"
+
+typedef struct {
+    char                    test_desc[60];
+    psa_key_type_t          type;
+    const uint8_t          *data;
+    size_t                  data_length;
+    psa_algorithm_t         alg;
+    const uint8_t          *hash;
+    size_t                  hash_length;
+    uint32_t                samples;
+} test_data;
+
+static const test_data check1[] = {
+#ifdef ARCH_TEST_ECDSA
+#ifdef ARCH_TEST_ECC_CURVE_SECP256R1
+#ifdef ARCH_TEST_SHA256
+{
+    .test_desc   = "Latency sign/verify - ECDSA SECP256R1 SHA-256\n",
+    .type        = PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1),
+    .data        = ec_key_pair,
+    .data_length = 32,
+    .alg         = PSA_ALG_ECDSA(PSA_ALG_SHA_256),
+    .hash        = sha_256_hash,
+    .hash_length = 32,
+    .samples     = BENCH_LATENCY_SAMPLES,
+},
+#endif
+#endif
+
+#ifdef ARCH_TEST_ECC_CURVE_SECP384R1
+#ifdef ARCH_TEST_SHA384
+{
+    .test_desc   = "Latency sign/verify - ECDSA SECP384R1 SHA-384\n",
+    .type        = PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1),
+    .data        = ecdh_secp_384_r1_prv_key,
+    .data_length = ECDH_SECP_384_R1_PRV_KEY_LEN,
+    .alg         = PSA_ALG_ECDSA(PSA_ALG_SHA_384),
+    .hash        = sha_384_hash,
+    .hash_length = 48,
+    .samples     = BENCH_LATENCY_SAMPLES,
+},
+#endif
+#endif
+#endif
+
+#ifdef ARCH_TEST_DETERMINISTIC_ECDSA
+#ifdef ARCH_TEST_ECC_CURVE_SECP256R1
+#ifdef ARCH_TEST_SHA256
+{
+    .test_desc   = "Latency sign/verify - ECDSA_DETERMINISTIC SECP256R1 SHA-256\n",
+    .type        = PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1),
+    .data        = ec_keypair_deterministic,
+    .data_length = 32,
+    .alg         = PSA_ALG_DETERMINISTIC_ECDSA(PSA_ALG_SHA_256),
+    .hash        = sha_256_hash,
+    .hash_length = 32,
+    .samples     = BENCH_LATENCY_SAMPLES,
+},
+#endif
+#endif
+#endif
+
+#ifdef ARCH_TEST_RSA_PKCS1V15_SIGN
+#ifdef ARCH_TEST_SHA256
+#ifdef ARCH_TEST_RSA_1024
+{
+    .test_desc   = "Latency sign/verify - RSA 1024 PKCS1V15 SHA-256\n",
+    .type        = PSA_KEY_TYPE_RSA_KEY_PAIR,
+    .data        = rsa_128_key_pair,
+    .data_length = 610,
+    .alg         = PSA_ALG_RSA_PKCS1V15_SIGN(PSA_ALG_SHA_256),
+    .hash        = sha_256_hash,
+    .hash_length = 32,
+    .samples     = BENCH_LATENCY_SAMPLES,
+},
+#endif
+
+#ifdef ARCH_TEST_RSA_2048
+{
+    .test_desc   = "Latency sign/verify - RSA 2048 PKCS1V15 SHA-256\n",
+    .type        = PSA_KEY_TYPE_RSA_KEY_PAIR,
+    .data        = rsa_256_key_pair,
+    .data_length = 1193,
+    .alg         = PSA_ALG_RSA_PKCS1V15_SIGN(PSA_ALG_SHA_256),
+    .hash        = sha_256_hash,
+    .hash_length = 32,
+    .samples     = BENCH_LATENCY_SAMPLES,
+},
+#endif
+#endif
+#endif
+};
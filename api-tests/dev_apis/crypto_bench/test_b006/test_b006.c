@@ -0,0 +1,103 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "test_b006.h"
+#include "test_data.h"
+
+const client_test_t test_b006_crypto_list[] = {
+    NULL,
+    psa_asymmetric_encrypt_latency_test,
+    NULL,
+};
+
+typedef struct {
+    const test_data        *data;
+    psa_key_id_t            key;
+    uint8_t                 ciphertext[PSA_ASYMMETRIC_ENCRYPT_OUTPUT_MAX_SIZE];
+    size_t                  ciphertext_length;
+    uint8_t                 plaintext[PSA_ASYMMETRIC_DECRYPT_OUTPUT_MAX_SIZE];
+} bench_encrypt_ctx_t;
+
+static bench_encrypt_ctx_t bench;
+
+static psa_status_t encrypt_sample(void *ctx)
+{
+    bench_encrypt_ctx_t *encrypt = ctx;
+
+    return val->crypto->asymmetric_encrypt(encrypt->key, encrypt->data->alg, key_data,
+                                           BENCH_MESSAGE_LENGTH, NULL, 0,
+                                           encrypt->ciphertext, sizeof(encrypt->ciphertext),
+                                           &encrypt->ciphertext_length);
+}
+
+/* Decrypts the last ciphertext produced by encrypt_sample */
+static psa_status_t decrypt_sample(void *ctx)
+{
+    bench_encrypt_ctx_t *encrypt = ctx;
+    size_t               plaintext_length;
+
+    return val->crypto->asymmetric_decrypt(encrypt->key, encrypt->data->alg,
+                                           encrypt->ciphertext, encrypt->ciphertext_length,
+                                           NULL, 0, encrypt->plaintext,
+                                           sizeof(encrypt->plaintext), &plaintext_length);
+}
+
+int32_t psa_asymmetric_encrypt_latency_test(caller_security_t caller __UNUSED)
+{
+    int32_t               i, status;
+    int32_t               num_checks = sizeof(check1)/sizeof(check1[0]);
+
+    if (num_checks == 0)
+    {
+        val->print(TEST, "No test available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    if (!bench_timer_available(val))
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto->crypto_init();
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    for (i = 0; i < num_checks; i++)
+    {
+        val->print(TEST, "Check %d: ", i+1);
+        val->print(TEST, check1[i].test_desc, 0);
+
+        bench.data = &check1[i];
+        status = bench_import_key(val, check1[i].type,
+                                  PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT,
+                                  check1[i].alg, check1[i].data, check1[i].data_length,
+                                  &bench.key);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        status = bench_latency(val, "asymmetric_encrypt", encrypt_sample, NULL, &bench,
+                               check1[i].samples);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
+
+        status = bench_latency(val, "asymmetric_decrypt", decrypt_sample, NULL, &bench,
+                               check1[i].samples);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
+
+        status = val->crypto->destroy_key(bench.key);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
@@ -0,0 +1,82 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "test_bench_common.h"
+
+/* Size of the encrypted message, e.g a session key */
+#define BENCH_MESSAGE_LENGTH   32
+
+typedef struct {
+    char                    test_desc[60];
+    psa_key_type_t          type;
+    const uint8_t          *data;
+    size_t                  data_length;
+    psa_algorithm_t         alg;
+    uint32_t                samples;
+} test_data;
+
+static const test_data check1[] = {
+#ifdef ARCH_TEST_RSA_PKCS1V15_CRYPT
+#ifdef ARCH_TEST_RSA_1024
+{
+    .test_desc   = "Latency encrypt/decrypt - RSA 1024 PKCS1V15\n",
+    .type        = PSA_KEY_TYPE_RSA_KEY_PAIR,
+    .data        = rsa_128_key_pair,
+    .data_length = 610,
+    .alg         = PSA_ALG_RSA_PKCS1V15_CRYPT,
+    .samples     = BENCH_LATENCY_SAMPLES,
+},
+#endif
+
+#ifdef ARCH_TEST_RSA_2048
+{
+    .test_desc   = "Latency encrypt/decrypt - RSA 2048 PKCS1V15\n",
+    .type        = PSA_KEY_TYPE_RSA_KEY_PAIR,
+    .data        = rsa_256_key_pair,
+    .data_length = 1193,
+    .alg         = PSA_ALG_RSA_PKCS1V15_CRYPT,
+    .samples     = BENCH_LATENCY_SAMPLES,
+},
+#endif
+#endif
+
+#ifdef ARCH_TEST_RSA_OAEP
+#ifdef ARCH_TEST_SHA256
+#ifdef ARCH_TEST_RSA_1024
+{
+    .test_desc   = "Latency encrypt/decrypt - RSA 1024 OAEP SHA-256\n",
+    .type        = PSA_KEY_TYPE_RSA_KEY_PAIR,
+    .data        = rsa_128_key_pair,
+    .data_length = 610,
+    .alg         = PSA_ALG_RSA_OAEP(PSA_ALG_SHA_256),
+    .samples     = BENCH_LATENCY_SAMPLES,
+},
+#endif
+
+#ifdef ARCH_TEST_RSA_2048
+{
+    .test_desc   = "Latency encrypt/decrypt - RSA 2048 OAEP SHA-256\n",
+    .type        = PSA_KEY_TYPE_RSA_KEY_PAIR,
+    .data        = rsa_256_key_pair,
+    .data_length = 1193,
+    .alg         = PSA_ALG_RSA_OAEP(PSA_ALG_SHA_256),
+    .samples     = BENCH_LATENCY_SAMPLES,
+},
+#endif
+#endif
+#endif
+};
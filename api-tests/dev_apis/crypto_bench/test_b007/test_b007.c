@@ -0,0 +1,86 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "test_b007.h"
+#include "test_data.h"
+
+const client_test_t test_b007_crypto_list[] = {
+    NULL,
+    psa_generate_key_latency_test,
+    NULL,
+};
+
+typedef struct {
+    psa_key_attributes_t    attributes;
+    psa_key_id_t            key;
+} bench_generate_ctx_t;
+
+static psa_status_t generate_sample(void *ctx)
+{
+    bench_generate_ctx_t *generate = ctx;
+
+    return val->crypto->generate_key(&generate->attributes, &generate->key);
+}
+
+static psa_status_t destroy_sample(void *ctx)
+{
+    bench_generate_ctx_t *generate = ctx;
+
+    return val->crypto->destroy_key(generate->key);
+}
+
+int32_t psa_generate_key_latency_test(caller_security_t caller __UNUSED)
+{
+    int32_t               i, status;
+    int32_t               num_checks = sizeof(check1)/sizeof(check1[0]);
+    bench_generate_ctx_t  bench;
+
+    if (num_checks == 0)
+    {
+        val->print(TEST, "No test available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    if (!bench_timer_available(val))
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto->crypto_init();
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    for (i = 0; i < num_checks; i++)
+    {
+        val->print(TEST, "Check %d: ", i+1);
+        val->print(TEST, check1[i].test_desc, 0);
+
+        bench.attributes = val->crypto->key_attributes_init();
+        val->crypto->set_key_type(&bench.attributes, check1[i].type);
+        val->crypto->set_key_usage_flags(&bench.attributes, check1[i].usage_flags);
+        val->crypto->set_key_algorithm(&bench.attributes, check1[i].alg);
+        val->crypto->set_key_bits(&bench.attributes, check1[i].bits);
+
+        /* Each generated key is destroyed outside of the timed region */
+        status = bench_latency(val, "generate_key", generate_sample, destroy_sample, &bench,
+                               check1[i].samples);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        val->crypto->reset_key_attributes(&bench.attributes);
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
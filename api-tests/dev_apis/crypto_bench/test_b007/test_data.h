@@ -0,0 +1,85 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "test_bench_common.h"
+
+typedef struct {
+    char                    test_desc[60];
+    psa_key_type_t          type;
+    psa_key_usage_t         usage_flags;
+    psa_algorithm_t         alg;
+    size_t                  bits;
+    uint32_t                samples;
+} test_data;
+
+static const test_data check1[] = {
+#ifdef ARCH_TEST_ECDSA
+#ifdef ARCH_TEST_ECC_CURVE_SECP256R1
+#ifdef ARCH_TEST_SHA256
+{
+    .test_desc   = "Latency generate_key - ECC SECP256R1 key pair\n",
+    .type        = PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1),
+    .usage_flags = PSA_KEY_USAGE_SIGN_HASH,
+    .alg         = PSA_ALG_ECDSA(PSA_ALG_SHA_256),
+    .bits        = 256,
+    .samples     = BENCH_LATENCY_SAMPLES,
+},
+#endif
+#endif
+
+#ifdef ARCH_TEST_ECC_CURVE_SECP384R1
+#ifdef ARCH_TEST_SHA384
+{
+    .test_desc   = "Latency generate_key - ECC SECP384R1 key pair\n",
+    .type        = PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1),
+    .usage_flags = PSA_KEY_USAGE_SIGN_HASH,
+    .alg         = PSA_ALG_ECDSA(PSA_ALG_SHA_384),
+    .bits        = 384,
+    .samples     = BENCH_LATENCY_SAMPLES,
+},
+#endif
+#endif
+#endif
+
+#ifdef ARCH_TEST_RSA
+#ifdef ARCH_TEST_RSA_PKCS1V15_SIGN_RAW
+#ifdef ARCH_TEST_RSA_1024
+{
+    .test_desc   = "Latency generate_key - RSA 1024 key pair\n",
+    .type        = PSA_KEY_TYPE_RSA_KEY_PAIR,
+    .usage_flags = PSA_KEY_USAGE_SIGN_HASH,
+    .alg         = PSA_ALG_RSA_PKCS1V15_SIGN_RAW,
+    .bits        = 1024,
+    .samples     = BENCH_LATENCY_SLOW_SAMPLES,
+},
+#endif
+
+#ifdef ARCH_TEST_RSA_2048
+#ifndef ARCH_TEST_SKIP_RSA_2048_GEN_KEY
+{
+    .test_desc   = "Latency generate_key - RSA 2048 key pair\n",
+    .type        = PSA_KEY_TYPE_RSA_KEY_PAIR,
+    .usage_flags = PSA_KEY_USAGE_SIGN_HASH,
+    .alg         = PSA_ALG_RSA_PKCS1V15_SIGN_RAW,
+    .bits        = 2048,
+    .samples     = BENCH_LATENCY_SLOW_SAMPLES,
+},
+#endif
+#endif
+#endif
+#endif
+};
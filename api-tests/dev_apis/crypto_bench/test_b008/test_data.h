@@ -0,0 +1,100 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "test_bench_common.h"
+
+typedef struct {
+    char                    test_desc[60];
+    psa_key_type_t          type;
+    const uint8_t          *data;
+    size_t                  data_length;
+    psa_algorithm_t         alg;
+    const uint8_t          *peer_key;
+    size_t                  peer_key_length;
+    uint32_t                samples;
+} test_data;
+
+static const test_data check1[] = {
+#ifdef ARCH_TEST_ECDH
+#ifdef ARCH_TEST_ECC_CURVE_SECP256R1
+{
+    .test_desc       = "Latency raw_key_agreement - ECDH SECP256R1\n",
+    .type            = PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1),
+    .data            = ecdh_secp_256_r1_prv_key,
+    .data_length     = ECDH_SECP_256_R1_PRV_KEY_LEN,
+    .alg             = PSA_ALG_ECDH,
+    .peer_key        = ecdh_secp_256_r1_pub_key,
+    .peer_key_length = ECDH_SECP_256_R1_PUB_KEY_LEN,
+    .samples         = BENCH_LATENCY_SAMPLES,
+},
+#endif
+
+#ifdef ARCH_TEST_ECC_CURVE_SECP384R1
+{
+    .test_desc       = "Latency raw_key_agreement - ECDH SECP384R1\n",
+    .type            = PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1),
+    .data            = ecdh_secp_384_r1_prv_key,
+    .data_length     = ECDH_SECP_384_R1_PRV_KEY_LEN,
+    .alg             = PSA_ALG_ECDH,
+    .peer_key        = ecdh_secp_384_r1_pub_key,
+    .peer_key_length = ECDH_SECP_384_R1_PUB_KEY_LEN,
+    .samples         = BENCH_LATENCY_SAMPLES,
+},
+#endif
+#endif
+
+#ifdef ARCH_TEST_FFDH
+#ifdef ARCH_TEST_FFDHE2048
+{
+    .test_desc       = "Latency raw_key_agreement - FFDH FFDHE2048\n",
+    .type            = PSA_KEY_TYPE_DH_KEY_PAIR(PSA_DH_FAMILY_RFC7919),
+    .data            = ffdh_key_data_2048,
+    .data_length     = FFDH2048_PRV_KEY_LEN,
+    .alg             = PSA_ALG_FFDH,
+    .peer_key        = ffdh_peer_key_data_2048,
+    .peer_key_length = FFDH2048_PUB_KEY_LEN,
+    .samples         = BENCH_LATENCY_SAMPLES,
+},
+#endif
+
+#ifdef ARCH_TEST_FFDHE3072
+{
+    .test_desc       = "Latency raw_key_agreement - FFDH FFDHE3072\n",
+    .type            = PSA_KEY_TYPE_DH_KEY_PAIR(PSA_DH_FAMILY_RFC7919),
+    .data            = ffdh_key_data_3072,
+    .data_length     = FFDH3072_PRV_KEY_LEN,
+    .alg             = PSA_ALG_FFDH,
+    .peer_key        = ffdh_peer_key_data_3072,
+    .peer_key_length = FFDH3072_PUB_KEY_LEN,
+    .samples         = BENCH_LATENCY_SLOW_SAMPLES,
+},
+#endif
+
+#ifdef ARCH_TEST_FFDHE4096
+{
+    .test_desc       = "Latency raw_key_agreement - FFDH FFDHE4096\n",
+    .type            = PSA_KEY_TYPE_DH_KEY_PAIR(PSA_DH_FAMILY_RFC7919),
+    .data            = ffdh_key_data_4096,
+    .data_length     = FFDH4096_PRV_KEY_LEN,
+    .alg             = PSA_ALG_FFDH,
+    .peer_key        = ffdh_peer_key_data_4096,
+    .peer_key_length = FFDH4096_PUB_KEY_LEN,
+    .samples         = BENCH_LATENCY_SLOW_SAMPLES,
+},
+#endif
+#endif
+};
@@ -0,0 +1,211 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "test_b009.h"
+#include "test_data.h"
+
+#define BENCH_STRESS_MAX_THREADS    64
+#define BENCH_STRESS_MAX_CHECKS     8
+#define BENCH_STRESS_OUTPUT_SIZE    128
+
+/* Iterations of the operation mix run by each thread */
+#ifndef BENCH_STRESS_ITERATIONS
+#define BENCH_STRESS_ITERATIONS     200
+#endif
+
+const client_test_t test_b009_crypto_list[] = {
+    NULL,
+    psa_thread_scaling_test,
+    NULL,
+};
+
+typedef struct {
+    uint32_t                ops;
+    uint32_t                mismatches;
+    psa_status_t            status;
+} bench_thread_stats_t;
+
+static bench_thread_stats_t thread_stats[BENCH_STRESS_MAX_THREADS];
+
+/* Keys used concurrently by all the threads, for the BENCH_STRESS_SIGN checks */
+static psa_key_id_t shared_keys[BENCH_STRESS_MAX_CHECKS];
+
+static psa_status_t stress_op(const test_data *data, psa_key_id_t shared_key,
+                              uint8_t *output, size_t *output_length)
+{
+    psa_status_t status, destroy_status;
+    psa_key_id_t key;
+
+    switch (data->op)
+    {
+        case BENCH_STRESS_AEAD:
+            status = bench_import_key(val, data->type, data->usage_flags, data->alg, data->data,
+                                      data->data_length, &key);
+            if (status != PSA_SUCCESS)
+                return status;
+
+            status = val->crypto->aead_encrypt(key, data->alg, data->nonce, data->nonce_length,
+                                               data->additional_data,
+                                               data->additional_data_length, data->input,
+                                               data->input_length, output,
+                                               BENCH_STRESS_OUTPUT_SIZE, output_length);
+
+            destroy_status = val->crypto->destroy_key(key);
+            return (status != PSA_SUCCESS) ? status : destroy_status;
+
+        case BENCH_STRESS_HASH:
+            return val->crypto->hash_compute(data->alg, data->input, data->input_length, output,
+                                             BENCH_STRESS_OUTPUT_SIZE, output_length);
+
+        case BENCH_STRESS_SIGN:
+            return val->crypto->sign_hash(shared_key, data->alg, data->input, data->input_length,
+                                          output, BENCH_STRESS_OUTPUT_SIZE, output_length);
+
+        default:
+            return PSA_ERROR_NOT_SUPPORTED;
+    }
+}
+
+/* Body of a stress thread, must not print as the VAL print is not thread safe */
+static void stress_thread(void *arg __UNUSED, uint32_t index)
+{
+    int32_t      i, num_checks = sizeof(check1)/sizeof(check1[0]);
+    uint32_t     iteration, ops = 0, mismatches = 0;
+    psa_status_t status, first_error = PSA_SUCCESS;
+    uint8_t      output[BENCH_STRESS_OUTPUT_SIZE];
+    size_t       output_length;
+
+    for (iteration = 0; iteration < BENCH_STRESS_ITERATIONS; iteration++)
+    {
+        for (i = 0; i < num_checks; i++)
+        {
+            status = stress_op(&check1[i], shared_keys[i], output, &output_length);
+            if (status != PSA_SUCCESS)
+            {
+                if (first_error == PSA_SUCCESS)
+                    first_error = status;
+                continue;
+            }
+
+            ops++;
+            if ((output_length != check1[i].expected_output_length) ||
+                memcmp(output, check1[i].expected_output, output_length))
+                mismatches++;
+        }
+    }
+
+    /* Written once, so the threads don't share cache lines while running */
+    thread_stats[index].ops        = ops;
+    thread_stats[index].mismatches = mismatches;
+    thread_stats[index].status     = first_error;
+}
+
+int32_t psa_thread_scaling_test(caller_security_t caller __UNUSED)
+{
+    int32_t               i, status;
+    int32_t               num_checks = sizeof(check1)/sizeof(check1[0]);
+    uint32_t              threads, cpus, check = 0, ops, mismatches;
+    uint64_t              start, elapsed_us, ops_per_sec, single_ops_per_sec = 0;
+    psa_status_t          first_error;
+
+    if (num_checks == 0)
+    {
+        val->print(TEST, "No test available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    if (num_checks > BENCH_STRESS_MAX_CHECKS)
+        return RESULT_FAIL(VAL_STATUS_INSUFFICIENT_SIZE);
+
+    if (!bench_timer_available(val))
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto->crypto_init();
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    val->print(TEST, "Operation mix run by each thread:\n", 0);
+    for (i = 0; i < num_checks; i++)
+    {
+        val->print(TEST, "\t", 0);
+        val->print(TEST, check1[i].test_desc, 0);
+
+        if (check1[i].op != BENCH_STRESS_SIGN)
+            continue;
+
+        status = bench_import_key(val, check1[i].type, check1[i].usage_flags, check1[i].alg,
+                                  check1[i].data, check1[i].data_length, &shared_keys[i]);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+    }
+
+    cpus = MIN(val->get_cpu_count(), BENCH_STRESS_MAX_THREADS);
+
+    /* Double the threads up to the number of CPUs */
+    threads = 1;
+    while (1)
+    {
+        val->print(TEST, "Check %d: ", ++check);
+        val->print(TEST, "%d threads\n", threads);
+
+        status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+        TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(3));
+
+        start  = val->get_time_ns();
+        status = val->thread_run(threads, stress_thread, NULL);
+        elapsed_us = (val->get_time_ns() - start) / 1000;
+        TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(4));
+
+        ops         = 0;
+        mismatches  = 0;
+        first_error = PSA_SUCCESS;
+        for (i = 0; i < (int32_t)threads; i++)
+        {
+            ops        += thread_stats[i].ops;
+            mismatches += thread_stats[i].mismatches;
+            if (first_error == PSA_SUCCESS)
+                first_error = thread_stats[i].status;
+        }
+
+        ops_per_sec = ((uint64_t)ops * 1000000) / (elapsed_us ? elapsed_us : 1);
+        if (threads == 1)
+            single_ops_per_sec = ops_per_sec;
+
+        val->print(TEST, "\t%d ops/s, ", (int32_t)ops_per_sec);
+        val->print(TEST, "%d percent of linear scaling\n",
+                   (int32_t)((ops_per_sec * 100) / ((single_ops_per_sec ? single_ops_per_sec : 1) * threads)));
+
+        /* Every thread must see the results of the single threaded correctness suite */
+        TEST_ASSERT_EQUAL(first_error, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
+        TEST_ASSERT_EQUAL(mismatches, 0, TEST_CHECKPOINT_NUM(6));
+
+        if (threads == cpus)
+            break;
+        threads = MIN(threads * 2, cpus);
+    }
+
+    for (i = 0; i < num_checks; i++)
+    {
+        if (check1[i].op != BENCH_STRESS_SIGN)
+            continue;
+
+        status = val->crypto->destroy_key(shared_keys[i]);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(7));
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
@@ -0,0 +1,119 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "test_bench_common.h"
+
+/* Operations mixed by the threads, with the test vectors of the correctness suite */
+typedef enum {
+    BENCH_STRESS_AEAD = 1,   /* import key, psa_aead_encrypt, destroy key (test_c024) */
+    BENCH_STRESS_HASH = 2,   /* psa_hash_compute (test_c006) */
+    BENCH_STRESS_SIGN = 3,   /* psa_sign_hash with a key shared by the threads (test_c041) */
+} bench_stress_op_t;
+
+typedef struct {
+    char                    test_desc[60];
+    bench_stress_op_t       op;
+    psa_key_type_t          type;
+    const uint8_t          *data;
+    size_t                  data_length;
+    psa_key_usage_t         usage_flags;
+    psa_algorithm_t         alg;
+    const uint8_t          *nonce;
+    size_t                  nonce_length;
+    const uint8_t          *additional_data;
+    size_t                  additional_data_length;
+    const uint8_t          *input;
+    size_t                  input_length;
+    const uint8_t          *expected_output;
+    size_t                  expected_output_length;
+} test_data;
+
+static const test_data check1[] = {
+#ifdef ARCH_TEST_CCM
+#ifdef ARCH_TEST_AES_128
+{
+    .test_desc              = "psa_aead_encrypt - CCM - AES - 13B nonce & 8B add data\n",
+    .op                     = BENCH_STRESS_AEAD,
+    .type                   = PSA_KEY_TYPE_AES,
+    .data                   = key_data,
+    .data_length            = AES_16B_KEY_SIZE,
+    .usage_flags            = PSA_KEY_USAGE_ENCRYPT,
+    .alg                    = PSA_ALG_CCM,
+    .nonce                  = nonce,
+    .nonce_length           = 13,
+    .additional_data        = additional_data,
+    .additional_data_length = 8,
+    .input                  = plaintext,
+    .input_length           = 23,
+    .expected_output        = aead_ciphertext_1,
+    .expected_output_length = AEAD_CIPHERTEXT_LEN_1,
+},
+#endif
+#endif
+
+#ifdef ARCH_TEST_GCM
+#ifdef ARCH_TEST_AES_128
+{
+    .test_desc              = "psa_aead_encrypt - GCM - AES - 12B nonce & 12B add data\n",
+    .op                     = BENCH_STRESS_AEAD,
+    .type                   = PSA_KEY_TYPE_AES,
+    .data                   = key_data,
+    .data_length            = AES_16B_KEY_SIZE,
+    .usage_flags            = PSA_KEY_USAGE_ENCRYPT,
+    .alg                    = PSA_ALG_GCM,
+    .nonce                  = nonce,
+    .nonce_length           = 12,
+    .additional_data        = additional_data,
+    .additional_data_length = 12,
+    .input                  = plaintext,
+    .input_length           = 24,
+    .expected_output        = aead_ciphertext_6,
+    .expected_output_length = AEAD_CIPHERTEXT_LEN_6,
+},
+#endif
+#endif
+
+#ifdef ARCH_TEST_SHA256
+{
+    .test_desc              = "psa_hash_compute - SHA256\n",
+    .op                     = BENCH_STRESS_HASH,
+    .alg                    = PSA_ALG_SHA_256,
+    .input                  = &hash_input,
+    .input_length           = sizeof(hash_input),
+    .expected_output        = sha_256_hash,
+    .expected_output_length = 32,
+},
+
+#ifdef ARCH_TEST_DETERMINISTIC_ECDSA
+#ifdef ARCH_TEST_ECC_CURVE_SECP256R1
+{
+    .test_desc              = "psa_sign_hash - ECDSA_DETERMINISTIC SECP256R1 SHA-256\n",
+    .op                     = BENCH_STRESS_SIGN,
+    .type                   = PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1),
+    .data                   = ec_keypair_deterministic,
+    .data_length            = 32,
+    .usage_flags            = PSA_KEY_USAGE_SIGN_HASH,
+    .alg                    = PSA_ALG_DETERMINISTIC_ECDSA(PSA_ALG_SHA_256),
+    .input                  = sha_256_hash,
+    .input_length           = 32,
+    .expected_output        = signature_3,
+    .expected_output_length = 64,
+},
+#endif
+#endif
+#endif
+};
@@ -0,0 +1,466 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "test_b010.h"
+#include "test_data.h"
+
+/* Update sizes of the stream, the odd sizes straddle the blocks of the algorithms */
+static const size_t stream_update_sizes[] = {1, 13, 64, 1000, 4096, 65536};
+
+/* The stream repeats a generated pattern of BENCH_STREAM_PERIOD bytes. It is stored in
+ * bench_input followed by its first BENCH_STREAM_MAX_UPDATE bytes, so that every update
+ * reads one contiguous piece of bench_input.
+ */
+#define BENCH_STREAM_MAX_UPDATE        MIN(65536, BENCH_BUFFER_SIZE / 2)
+#define BENCH_STREAM_PERIOD            (BENCH_BUFFER_SIZE - BENCH_STREAM_MAX_UPDATE - 1)
+#define BENCH_STREAM_INPUT(offset)     (bench_input + ((offset) % BENCH_STREAM_PERIOD))
+
+/* Stream lengths are a multiple of the CBC block size */
+#define BENCH_STREAM_ALIGN             64
+
+/* Length of the stream checked against the one-shot functions */
+#define BENCH_STREAM_CHECK_LENGTH      (BENCH_STREAM_MAX_UPDATE & ~(BENCH_STREAM_ALIGN - 1))
+
+#define BENCH_STREAM_FINGERPRINT_SIZE  64
+
+const client_test_t test_b010_crypto_list[] = {
+    NULL,
+    psa_stream_bench_test,
+    NULL,
+};
+
+/* Order dependent checksum of an output stream, whatever the sizes of its pieces */
+typedef struct {
+    uint64_t                sum;
+    uint8_t                 partial[8];
+    size_t                  partial_length;
+} stream_checksum_t;
+
+typedef struct {
+    const test_data        *data;
+    psa_key_id_t            key;
+    size_t                  length;
+    size_t                  update_size;
+    uint8_t                 fingerprint[BENCH_STREAM_FINGERPRINT_SIZE];
+    size_t                  fingerprint_length;
+} stream_ctx_t;
+
+static void stream_generate(void)
+{
+    uint32_t state = 0x2545F491;
+    size_t   i;
+
+    /* xorshift32 */
+    for (i = 0; i < BENCH_STREAM_PERIOD; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        bench_input[i] = (uint8_t)state;
+    }
+
+    memcpy(bench_input + BENCH_STREAM_PERIOD, bench_input, BENCH_STREAM_MAX_UPDATE);
+}
+
+static void checksum_word(stream_checksum_t *checksum, const uint8_t *bytes)
+{
+    uint64_t word;
+
+    /* FNV-1a over 64-bit words */
+    memcpy(&word, bytes, sizeof(word));
+    checksum->sum = (checksum->sum ^ word) * 0x100000001B3ULL;
+}
+
+static void checksum_init(stream_checksum_t *checksum)
+{
+    checksum->sum            = 0xCBF29CE484222325ULL;
+    checksum->partial_length = 0;
+}
+
+static void checksum_update(stream_checksum_t *checksum, const uint8_t *data, size_t length)
+{
+    size_t n;
+
+    if (checksum->partial_length)
+    {
+        n = MIN(length, sizeof(checksum->partial) - checksum->partial_length);
+        memcpy(checksum->partial + checksum->partial_length, data, n);
+        checksum->partial_length += n;
+        data   += n;
+        length -= n;
+
+        if (checksum->partial_length < sizeof(checksum->partial))
+            return;
+
+        checksum_word(checksum, checksum->partial);
+        checksum->partial_length = 0;
+    }
+
+    for (; length >= sizeof(checksum->partial); data += 8, length -= 8)
+        checksum_word(checksum, data);
+
+    memcpy(checksum->partial, data, length);
+    checksum->partial_length = length;
+}
+
+static void checksum_finish(stream_checksum_t *checksum, stream_ctx_t *stream)
+{
+    if (checksum->partial_length)
+    {
+        memset(checksum->partial + checksum->partial_length, 0,
+               sizeof(checksum->partial) - checksum->partial_length);
+        checksum_word(checksum, checksum->partial);
+    }
+
+    memcpy(stream->fingerprint, &checksum->sum, sizeof(checksum->sum));
+    stream->fingerprint_length = sizeof(checksum->sum);
+}
+
+static psa_status_t stream_hash(stream_ctx_t *stream)
+{
+    psa_hash_operation_t operation = PSA_HASH_OPERATION_INIT;
+    psa_status_t         status;
+    size_t               offset, n;
+
+    status = val->crypto->hash_setup(&operation, stream->data->alg);
+
+    for (offset = 0; (status == PSA_SUCCESS) && (offset < stream->length); offset += n)
+    {
+        n      = MIN(stream->length - offset, stream->update_size);
+        status = val->crypto->hash_update(&operation, BENCH_STREAM_INPUT(offset), n);
+    }
+
+    if (status == PSA_SUCCESS)
+        status = val->crypto->hash_finish(&operation, stream->fingerprint,
+                                          sizeof(stream->fingerprint),
+                                          &stream->fingerprint_length);
+
+    if (status != PSA_SUCCESS)
+        val->crypto->hash_abort(&operation);
+
+    return status;
+}
+
+static psa_status_t stream_mac(stream_ctx_t *stream)
+{
+    psa_mac_operation_t operation = PSA_MAC_OPERATION_INIT;
+    psa_status_t        status;
+    size_t              offset, n;
+
+    status = val->crypto->mac_sign_setup(&operation, stream->key, stream->data->alg);
+
+    for (offset = 0; (status == PSA_SUCCESS) && (offset < stream->length); offset += n)
+    {
+        n      = MIN(stream->length - offset, stream->update_size);
+        status = val->crypto->mac_update(&operation, BENCH_STREAM_INPUT(offset), n);
+    }
+
+    if (status == PSA_SUCCESS)
+        status = val->crypto->mac_sign_finish(&operation, stream->fingerprint,
+                                              sizeof(stream->fingerprint),
+                                              &stream->fingerprint_length);
+
+    if (status != PSA_SUCCESS)
+        val->crypto->mac_abort(&operation);
+
+    return status;
+}
+
+/* Deciphers the stream, as a firmware update would. Random data is a valid
+ * ciphertext of all the modes, unlike the AEAD ciphertexts.
+ */
+static psa_status_t stream_cipher(stream_ctx_t *stream)
+{
+    psa_cipher_operation_t operation = PSA_CIPHER_OPERATION_INIT;
+    stream_checksum_t      checksum;
+    psa_status_t           status;
+    size_t                 offset, n, output_length;
+
+    checksum_init(&checksum);
+    status = val->crypto->cipher_decrypt_setup(&operation, stream->key, stream->data->alg);
+
+    if (status == PSA_SUCCESS)
+        status = val->crypto->cipher_set_iv(&operation, stream->data->iv,
+                                            stream->data->iv_length);
+
+    for (offset = 0; (status == PSA_SUCCESS) && (offset < stream->length); offset += n)
+    {
+        n      = MIN(stream->length - offset, stream->update_size);
+        status = val->crypto->cipher_update(&operation, BENCH_STREAM_INPUT(offset), n,
+                                            bench_output, BENCH_OUTPUT_SIZE, &output_length);
+        checksum_update(&checksum, bench_output, output_length);
+    }
+
+    if (status == PSA_SUCCESS)
+        status = val->crypto->cipher_finish(&operation, bench_output, BENCH_OUTPUT_SIZE,
+                                            &output_length);
+
+    if (status != PSA_SUCCESS)
+    {
+        val->crypto->cipher_abort(&operation);
+        return status;
+    }
+
+    checksum_update(&checksum, bench_output, output_length);
+    checksum_finish(&checksum, stream);
+    return PSA_SUCCESS;
+}
+
+/* The tag authenticates the whole ciphertext, it is the fingerprint of the stream */
+static psa_status_t stream_aead(stream_ctx_t *stream)
+{
+    psa_aead_operation_t operation = PSA_AEAD_OPERATION_INIT;
+    psa_status_t         status;
+    size_t               offset, n, output_length;
+
+    status = val->crypto->aead_encrypt_setup(&operation, stream->key, stream->data->alg);
+
+    /* Required by CCM, which needs the lengths before processing any data */
+    if (status == PSA_SUCCESS)
+        status = val->crypto->aead_set_lengths(&operation, 0, stream->length);
+
+    if (status == PSA_SUCCESS)
+        status = val->crypto->aead_set_nonce(&operation, stream->data->iv,
+                                             stream->data->iv_length);
+
+    for (offset = 0; (status == PSA_SUCCESS) && (offset < stream->length); offset += n)
+    {
+        n      = MIN(stream->length - offset, stream->update_size);
+        status = val->crypto->aead_update(&operation, BENCH_STREAM_INPUT(offset), n,
+                                          bench_output, BENCH_OUTPUT_SIZE, &output_length);
+    }
+
+    if (status == PSA_SUCCESS)
+        status = val->crypto->aead_finish(&operation, bench_output, BENCH_OUTPUT_SIZE,
+                                          &output_length, stream->fingerprint,
+                                          sizeof(stream->fingerprint),
+                                          &stream->fingerprint_length);
+
+    if (status != PSA_SUCCESS)
+        val->crypto->aead_abort(&operation);
+
+    return status;
+}
+
+static psa_status_t stream_run(stream_ctx_t *stream)
+{
+    switch (stream->data->op)
+    {
+        case BENCH_STREAM_HASH:
+            return stream_hash(stream);
+        case BENCH_STREAM_MAC:
+            return stream_mac(stream);
+        case BENCH_STREAM_CIPHER:
+            return stream_cipher(stream);
+        case BENCH_STREAM_AEAD:
+            return stream_aead(stream);
+        default:
+            return PSA_ERROR_NOT_SUPPORTED;
+    }
+}
+
+/* Fingerprint of the first BENCH_STREAM_CHECK_LENGTH bytes of the stream, given by the
+ * one-shot function of the algorithm
+ */
+static psa_status_t stream_one_shot(stream_ctx_t *stream)
+{
+    const test_data   *data   = stream->data;
+    const size_t       length = BENCH_STREAM_CHECK_LENGTH;
+    uint8_t           *plaintext;
+    stream_checksum_t  checksum;
+    psa_status_t       status;
+    size_t             output_length;
+
+    switch (data->op)
+    {
+        case BENCH_STREAM_HASH:
+            return val->crypto->hash_compute(data->alg, bench_input, length,
+                                             stream->fingerprint, sizeof(stream->fingerprint),
+                                             &stream->fingerprint_length);
+
+        case BENCH_STREAM_MAC:
+            return val->crypto->mac_compute(stream->key, data->alg, bench_input, length,
+                                            stream->fingerprint, sizeof(stream->fingerprint),
+                                            &stream->fingerprint_length);
+
+        case BENCH_STREAM_CIPHER:
+            /* The one-shot input is the IV followed by the ciphertext, the plaintext is
+             * written over the copy of the pattern start, restored afterwards.
+             */
+            memcpy(bench_output, data->iv, data->iv_length);
+            memcpy(bench_output + data->iv_length, bench_input, length);
+            plaintext = bench_input + BENCH_STREAM_PERIOD;
+
+            status = val->crypto->cipher_decrypt(stream->key, data->alg, bench_output,
+                                                 data->iv_length + length, plaintext,
+                                                 BENCH_STREAM_MAX_UPDATE, &output_length);
+            if (status == PSA_SUCCESS)
+            {
+                checksum_init(&checksum);
+                checksum_update(&checksum, plaintext, output_length);
+                checksum_finish(&checksum, stream);
+            }
+
+            memcpy(plaintext, bench_input, BENCH_STREAM_MAX_UPDATE);
+            return status;
+
+        case BENCH_STREAM_AEAD:
+            status = val->crypto->aead_encrypt(stream->key, data->alg, data->iv,
+                                               data->iv_length, NULL, 0, bench_input, length,
+                                               bench_output, BENCH_OUTPUT_SIZE, &output_length);
+            if (status != PSA_SUCCESS)
+                return status;
+
+            stream->fingerprint_length = output_length - length;
+            memcpy(stream->fingerprint, bench_output + length, stream->fingerprint_length);
+            return PSA_SUCCESS;
+
+        default:
+            return PSA_ERROR_NOT_SUPPORTED;
+    }
+}
+
+static psa_key_usage_t stream_key_usage(bench_stream_op_t op)
+{
+    switch (op)
+    {
+        case BENCH_STREAM_MAC:
+            return PSA_KEY_USAGE_SIGN_MESSAGE;
+        case BENCH_STREAM_CIPHER:
+            return PSA_KEY_USAGE_DECRYPT;
+        default:
+            return PSA_KEY_USAGE_ENCRYPT;
+    }
+}
+
+static void stream_report(size_t length, size_t update_size, uint64_t elapsed_ns)
+{
+    uint64_t updates = (length + update_size - 1) / update_size;
+
+    if (elapsed_ns == 0)
+        elapsed_ns = 1;
+
+    val->print(TEST, "\t%d B updates, ", (int32_t)update_size);
+    val->print(TEST, "%d KiB: ", (int32_t)(length / 1024));
+    val->print(TEST, "%d KiB/s, ", (int32_t)(((uint64_t)length * 1000000000) /
+                                             (1024 * elapsed_ns)));
+    val->print(TEST, "%d ns/update\n", (int32_t)(elapsed_ns / updates));
+}
+
+int32_t psa_stream_bench_test(caller_security_t caller __UNUSED)
+{
+    int32_t               i, j, status;
+    int32_t               num_checks  = sizeof(check1)/sizeof(check1[0]);
+    int32_t               num_updates = sizeof(stream_update_sizes)/sizeof(stream_update_sizes[0]);
+    stream_ctx_t          stream;
+    uint8_t               one_shot[BENCH_STREAM_FINGERPRINT_SIZE];
+    uint8_t               reference[BENCH_STREAM_FINGERPRINT_SIZE];
+    size_t                one_shot_length, reference_length = 0, length, reference_stream;
+    uint64_t              start;
+
+    if (num_checks == 0)
+    {
+        val->print(TEST, "No test available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    if (!bench_timer_available(val))
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto->crypto_init();
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    stream_generate();
+
+    for (i = 0; i < num_checks; i++)
+    {
+        val->print(TEST, "Check %d: ", i+1);
+        val->print(TEST, check1[i].test_desc, 0);
+
+        stream.data = &check1[i];
+        stream.key  = PSA_KEY_ID_NULL;
+        if (check1[i].op != BENCH_STREAM_HASH)
+        {
+            status = bench_import_key(val, check1[i].type, stream_key_usage(check1[i].op),
+                                      check1[i].alg, check1[i].data, check1[i].data_length,
+                                      &stream.key);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+        }
+
+        status = stream_one_shot(&stream);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
+        one_shot_length = stream.fingerprint_length;
+        memcpy(one_shot, stream.fingerprint, one_shot_length);
+
+        reference_stream = 0;
+        for (j = 0; j < num_updates; j++)
+        {
+            if (stream_update_sizes[j] > BENCH_STREAM_MAX_UPDATE)
+                break;
+
+            status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+            TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(4));
+
+            /* The updates give the result of the one-shot function */
+            stream.length      = BENCH_STREAM_CHECK_LENGTH;
+            stream.update_size = stream_update_sizes[j];
+            status = stream_run(&stream);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
+            TEST_ASSERT_EQUAL(stream.fingerprint_length, one_shot_length, TEST_CHECKPOINT_NUM(6));
+            TEST_ASSERT_MEMCMP(stream.fingerprint, one_shot, one_shot_length,
+                               TEST_CHECKPOINT_NUM(7));
+
+            length = (size_t)MIN((uint64_t)PLATFORM_BENCH_STREAM_SIZE,
+                                 (uint64_t)stream_update_sizes[j] * BENCH_STREAM_MAX_UPDATES);
+            length &= ~(size_t)(BENCH_STREAM_ALIGN - 1);
+
+            /* Reference of the full stream, in updates of a whole pattern period */
+            if (length != reference_stream)
+            {
+                stream.length      = length;
+                stream.update_size = BENCH_STREAM_PERIOD;
+                status = stream_run(&stream);
+                TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
+
+                reference_stream = length;
+                reference_length = stream.fingerprint_length;
+                memcpy(reference, stream.fingerprint, reference_length);
+            }
+
+            stream.length      = length;
+            stream.update_size = stream_update_sizes[j];
+            start  = val->get_time_ns();
+            status = stream_run(&stream);
+            stream_report(length, stream.update_size, val->get_time_ns() - start);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(9));
+            TEST_ASSERT_EQUAL(stream.fingerprint_length, reference_length,
+                              TEST_CHECKPOINT_NUM(10));
+            TEST_ASSERT_MEMCMP(stream.fingerprint, reference, reference_length,
+                               TEST_CHECKPOINT_NUM(11));
+        }
+
+        if (stream.key != PSA_KEY_ID_NULL)
+        {
+            status = val->crypto->destroy_key(stream.key);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(12));
+        }
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
@@ -0,0 +1,167 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "test_bench_common.h"
+
+typedef enum {
+    BENCH_STREAM_HASH   = 0x1,
+    BENCH_STREAM_MAC    = 0x2,
+    BENCH_STREAM_CIPHER = 0x3,
+    BENCH_STREAM_AEAD   = 0x4,
+} bench_stream_op_t;
+
+typedef struct {
+    char                    test_desc[50];
+    bench_stream_op_t       op;
+    psa_key_type_t          type;
+    const uint8_t          *data;
+    size_t                  data_length;
+    psa_algorithm_t         alg;
+    const uint8_t          *iv;
+    size_t                  iv_length;
+} test_data;
+
+static const test_data check1[] = {
+#ifdef ARCH_TEST_SHA256
+{
+    .test_desc   = "Stream hash - SHA256\n",
+    .op          = BENCH_STREAM_HASH,
+    .alg         = PSA_ALG_SHA_256,
+},
+#endif
+
+#ifdef ARCH_TEST_SHA512
+{
+    .test_desc   = "Stream hash - SHA512\n",
+    .op          = BENCH_STREAM_HASH,
+    .alg         = PSA_ALG_SHA_512,
+},
+#endif
+
+#ifdef ARCH_TEST_HMAC
+#ifdef ARCH_TEST_SHA256
+{
+    .test_desc   = "Stream MAC - HMAC SHA256\n",
+    .op          = BENCH_STREAM_MAC,
+    .type        = PSA_KEY_TYPE_HMAC,
+    .data        = key_data,
+    .data_length = 32,
+    .alg         = PSA_ALG_HMAC(PSA_ALG_SHA_256),
+},
+#endif
+#endif
+
+#ifdef ARCH_TEST_CMAC
+#ifdef ARCH_TEST_AES_128
+{
+    .test_desc   = "Stream MAC - CMAC AES 128\n",
+    .op          = BENCH_STREAM_MAC,
+    .type        = PSA_KEY_TYPE_AES,
+    .data        = key_data,
+    .data_length = AES_16B_KEY_SIZE,
+    .alg         = PSA_ALG_CMAC,
+},
+#endif
+#endif
+
+#ifdef ARCH_TEST_CIPHER_MODE_CTR
+#ifdef ARCH_TEST_AES_128
+{
+    .test_desc   = "Stream cipher - AES 128 CTR\n",
+    .op          = BENCH_STREAM_CIPHER,
+    .type        = PSA_KEY_TYPE_AES,
+    .data        = key_data,
+    .data_length = AES_16B_KEY_SIZE,
+    .alg         = PSA_ALG_CTR,
+    .iv          = iv,
+    .iv_length   = 16,
+},
+#endif
+#endif
+
+#ifdef ARCH_TEST_CBC_NO_PADDING
+#ifdef ARCH_TEST_AES_128
+{
+    .test_desc   = "Stream cipher - AES 128 CBC no padding\n",
+    .op          = BENCH_STREAM_CIPHER,
+    .type        = PSA_KEY_TYPE_AES,
+    .data        = key_data,
+    .data_length = AES_16B_KEY_SIZE,
+    .alg         = PSA_ALG_CBC_NO_PADDING,
+    .iv          = iv,
+    .iv_length   = 16,
+},
+#endif
+#endif
+
+#ifdef ARCH_TEST_CHACHA20
+{
+    .test_desc   = "Stream cipher - CHACHA20\n",
+    .op          = BENCH_STREAM_CIPHER,
+    .type        = PSA_KEY_TYPE_CHACHA20,
+    .data        = chacha20_key,
+    .data_length = 32,
+    .alg         = PSA_ALG_STREAM_CIPHER,
+    .iv          = chacha20_iv,
+    .iv_length   = 12,
+},
+#endif
+
+#ifdef ARCH_TEST_GCM
+#ifdef ARCH_TEST_AES_128
+{
+    .test_desc   = "Stream AEAD - AES 128 GCM\n",
+    .op          = BENCH_STREAM_AEAD,
+    .type        = PSA_KEY_TYPE_AES,
+    .data        = key_data,
+    .data_length = AES_16B_KEY_SIZE,
+    .alg         = PSA_ALG_GCM,
+    .iv          = nonce,
+    .iv_length   = 12,
+},
+#endif
+#endif
+
+/* The shortest CCM nonce, as its 8 byte length field allows the longest stream */
+#ifdef ARCH_TEST_CCM
+#ifdef ARCH_TEST_AES_128
+{
+    .test_desc   = "Stream AEAD - AES 128 CCM\n",
+    .op          = BENCH_STREAM_AEAD,
+    .type        = PSA_KEY_TYPE_AES,
+    .data        = key_data,
+    .data_length = AES_16B_KEY_SIZE,
+    .alg         = PSA_ALG_CCM,
+    .iv          = nonce,
+    .iv_length   = 7,
+},
+#endif
+#endif
+
+#ifdef ARCH_TEST_CHACHA20
+{
+    .test_desc   = "Stream AEAD - CHACHA20_POLY1305\n",
+    .op          = BENCH_STREAM_AEAD,
+    .type        = PSA_KEY_TYPE_CHACHA20,
+    .data        = chacha20_key,
+    .data_length = 32,
+    .alg         = PSA_ALG_CHACHA20_POLY1305,
+    .iv          = aead_chacha20_poly1305_nonce,
+    .iv_length   = 12,
+},
+#endif
+};
@@ -0,0 +1,394 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "test_b011.h"
+#include "test_data.h"
+
+const client_test_t test_b011_crypto_list[] = {
+    NULL,
+    psa_interruptible_sign_test,
+    psa_interruptible_key_agreement_test,
+    NULL,
+};
+
+#if defined(ARCH_TEST_INTERRUPTIBLE_SIGN_HASH) || defined(ARCH_TEST_INTERRUPTIBLE_KEY_AGREEMENT)
+/* Settings of psa_interruptible_set_max_ops, from a single slice to the finest slicing.
+ * The implementation may round the small values up to its smallest slice.
+ */
+static const uint32_t bench_max_ops[] = {PSA_INTERRUPTIBLE_MAX_OPS_UNLIMITED, 1000, 100, 10};
+
+#define BENCH_IOP_OUTPUT_SIZE  MAX(PSA_SIGNATURE_MAX_SIZE, PSA_RAW_KEY_AGREEMENT_OUTPUT_MAX_SIZE)
+
+typedef struct {
+    const test_data        *data;
+    psa_key_id_t            key;
+    psa_key_id_t            shared_key;
+    uint8_t                 output[BENCH_IOP_OUTPUT_SIZE];
+    size_t                  output_length;
+    uint8_t                 reference[BENCH_IOP_OUTPUT_SIZE];  /* Output of the blocking path */
+    size_t                  reference_length;
+    uint32_t                runs;       /* Operations run since bench_slice_reset */
+    uint32_t                slices;     /* Their calls of the _complete function */
+    uint32_t                worst_ns;   /* Their longest call of the _complete function */
+    uint32_t                num_ops;    /* Ops reported for the last operation */
+} bench_iop_ctx_t;
+
+static bench_iop_ctx_t bench;
+
+static void bench_slice_reset(bench_iop_ctx_t *ctx)
+{
+    ctx->runs     = 0;
+    ctx->slices   = 0;
+    ctx->worst_ns = 0;
+    ctx->num_ops  = 0;
+}
+
+static void bench_slice_add(bench_iop_ctx_t *ctx, uint64_t elapsed)
+{
+    ctx->slices++;
+    if (elapsed > ctx->worst_ns)
+        ctx->worst_ns = (elapsed > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32_t)elapsed;
+}
+
+static void bench_slice_print(const char *name, const bench_iop_ctx_t *ctx)
+{
+    val->print(TEST, "\t", 0);
+    val->print(TEST, name, 0);
+    val->print(TEST, ": %d ops,", (int32_t)ctx->num_ops);
+    val->print(TEST, " %d slices/op,", (int32_t)(ctx->slices / MAX(ctx->runs, 1)));
+    bench_print_time(val, " worst slice", ctx->worst_ns);
+    val->print(TEST, "\n", 0);
+}
+
+static void bench_print_max_ops(uint32_t max_ops)
+{
+    if (max_ops == PSA_INTERRUPTIBLE_MAX_OPS_UNLIMITED)
+        val->print(TEST, "\tmax_ops unlimited\n", 0);
+    else
+        val->print(TEST, "\tmax_ops %d\n", (int32_t)max_ops);
+}
+#endif
+
+#ifdef ARCH_TEST_INTERRUPTIBLE_SIGN_HASH
+/* Signs the hash of the check, timing each call of psa_sign_hash_complete */
+static psa_status_t sign_sample(void *ctx)
+{
+    bench_iop_ctx_t                          *sign = ctx;
+    psa_sign_hash_interruptible_operation_t   operation;
+    psa_status_t                              status;
+    uint64_t                                  start;
+
+    operation = val->crypto->sign_hash_interruptible_operation_init();
+    status    = val->crypto->sign_hash_start(&operation, sign->key, sign->data->alg,
+                                             sign->data->hash, sign->data->hash_length);
+    if (status == PSA_SUCCESS)
+    {
+        do {
+            start  = val->get_time_ns();
+            status = val->crypto->sign_hash_complete(&operation, sign->output,
+                                                     sizeof(sign->output),
+                                                     &sign->output_length);
+            bench_slice_add(sign, val->get_time_ns() - start);
+        } while (status == PSA_OPERATION_INCOMPLETE);
+    }
+
+    /* The ops count is kept after the completion, until the abort */
+    sign->num_ops = val->crypto->sign_hash_get_num_ops(&operation);
+    sign->runs++;
+    val->crypto->sign_hash_abort(&operation);
+    return status;
+}
+
+/* Verifies a signature of the hash of the check, timing each call of
+ * psa_verify_hash_complete
+ */
+static psa_status_t verify_run(bench_iop_ctx_t *verify, const uint8_t *signature,
+                               size_t signature_length)
+{
+    psa_verify_hash_interruptible_operation_t operation;
+    psa_status_t                              status;
+    uint64_t                                  start;
+
+    operation = val->crypto->verify_hash_interruptible_operation_init();
+    status    = val->crypto->verify_hash_start(&operation, verify->key, verify->data->alg,
+                                               verify->data->hash, verify->data->hash_length,
+                                               signature, signature_length);
+    if (status == PSA_SUCCESS)
+    {
+        do {
+            start  = val->get_time_ns();
+            status = val->crypto->verify_hash_complete(&operation);
+            bench_slice_add(verify, val->get_time_ns() - start);
+        } while (status == PSA_OPERATION_INCOMPLETE);
+    }
+
+    verify->num_ops = val->crypto->verify_hash_get_num_ops(&operation);
+    verify->runs++;
+    val->crypto->verify_hash_abort(&operation);
+    return status;
+}
+
+/* Verifies the signature of the blocking path */
+static psa_status_t verify_sample(void *ctx)
+{
+    bench_iop_ctx_t *verify = ctx;
+
+    return verify_run(verify, verify->reference, verify->reference_length);
+}
+
+static int32_t interruptible_sign_checks(void)
+{
+    int32_t               i, status;
+    int32_t               num_checks = sizeof(check1)/sizeof(check1[0]);
+    uint32_t              j;
+    const test_data      *data;
+
+    for (i = 0; i < num_checks; i++)
+    {
+        val->print(TEST, "Check %d: ", i+1);
+        val->print(TEST, check1[i].test_desc, 0);
+
+        data       = &check1[i];
+        bench.data = data;
+        status = bench_import_key(val, data->type,
+                                  PSA_KEY_USAGE_SIGN_HASH | PSA_KEY_USAGE_VERIFY_HASH,
+                                  data->alg, data->data, data->data_length, &bench.key);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        status = val->crypto->sign_hash(bench.key, data->alg, data->hash, data->hash_length,
+                                        bench.reference, sizeof(bench.reference),
+                                        &bench.reference_length);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
+
+        for (j = 0; j < sizeof(bench_max_ops)/sizeof(bench_max_ops[0]); j++)
+        {
+            val->crypto->interruptible_set_max_ops(bench_max_ops[j]);
+            bench_print_max_ops(bench_max_ops[j]);
+
+            bench_slice_reset(&bench);
+            status = bench_latency(val, "sign_hash_start/complete", sign_sample, NULL, &bench,
+                                   data->samples);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
+            bench_slice_print("sign_hash_complete", &bench);
+
+            /* A deterministic signature must match the blocking one, the others must
+             * pass the blocking verification
+             */
+            if (PSA_ALG_IS_DETERMINISTIC_ECDSA(data->alg))
+            {
+                TEST_ASSERT_EQUAL(bench.output_length, bench.reference_length,
+                                  TEST_CHECKPOINT_NUM(5));
+                TEST_ASSERT_MEMCMP(bench.output, bench.reference, bench.reference_length,
+                                   TEST_CHECKPOINT_NUM(6));
+            }
+            else
+            {
+                status = val->crypto->verify_hash(bench.key, data->alg, data->hash,
+                                                  data->hash_length, bench.output,
+                                                  bench.output_length);
+                TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(7));
+            }
+
+            bench_slice_reset(&bench);
+            status = bench_latency(val, "verify_hash_start/complete", verify_sample, NULL,
+                                   &bench, data->samples);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
+            bench_slice_print("verify_hash_complete", &bench);
+
+            /* A corrupted signature must be rejected, as by the blocking verification */
+            memcpy(bench.output, bench.reference, bench.reference_length);
+            bench.output[bench.reference_length - 1] ^= 0x01;
+            status = verify_run(&bench, bench.output, bench.reference_length);
+            TEST_ASSERT_EQUAL(status, PSA_ERROR_INVALID_SIGNATURE, TEST_CHECKPOINT_NUM(9));
+        }
+
+        status = val->crypto->destroy_key(bench.key);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(10));
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+#endif
+
+int32_t psa_interruptible_sign_test(caller_security_t caller __UNUSED)
+{
+#ifdef ARCH_TEST_INTERRUPTIBLE_SIGN_HASH
+    int32_t               status;
+    int32_t               num_checks = sizeof(check1)/sizeof(check1[0]);
+    uint32_t              max_ops;
+
+    if (num_checks == 0)
+    {
+        val->print(TEST, "No test available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    if (!bench_timer_available(val))
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto->crypto_init();
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    /* The max_ops setting is global, restore it whatever the result of the checks */
+    max_ops = val->crypto->interruptible_get_max_ops();
+    status  = interruptible_sign_checks();
+    val->crypto->interruptible_set_max_ops(max_ops);
+
+    return status;
+#else
+    val->print(TEST, "No test available for the selected crypto configuration\n", 0);
+    return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+#endif
+}
+
+#ifdef ARCH_TEST_INTERRUPTIBLE_KEY_AGREEMENT
+/* Agrees on the shared secret of the check, timing each call of
+ * psa_key_agreement_iop_complete
+ */
+static psa_status_t agreement_sample(void *ctx)
+{
+    bench_iop_ctx_t          *agreement = ctx;
+    const test_data          *data      = agreement->data;
+    psa_key_agreement_iop_t   operation;
+    psa_key_attributes_t      attributes = PSA_KEY_ATTRIBUTES_INIT;
+    psa_status_t              status;
+    uint64_t                  start;
+
+    /* Exportable, to compare the shared secret with the blocking path */
+    val->crypto->set_key_type(&attributes, PSA_KEY_TYPE_RAW_DATA);
+    val->crypto->set_key_usage_flags(&attributes, PSA_KEY_USAGE_EXPORT);
+
+    operation = val->crypto->key_agreement_iop_init();
+    status    = val->crypto->key_agreement_iop_setup(&operation, agreement->key, data->peer_key,
+                                                     data->peer_key_length, data->alg,
+                                                     &attributes);
+    if (status == PSA_SUCCESS)
+    {
+        do {
+            start  = val->get_time_ns();
+            status = val->crypto->key_agreement_iop_complete(&operation,
+                                                             &agreement->shared_key);
+            bench_slice_add(agreement, val->get_time_ns() - start);
+        } while (status == PSA_OPERATION_INCOMPLETE);
+    }
+
+    agreement->num_ops = val->crypto->key_agreement_iop_get_num_ops(&operation);
+    agreement->runs++;
+    val->crypto->key_agreement_iop_abort(&operation);
+    return status;
+}
+
+static psa_status_t agreement_cleanup(void *ctx)
+{
+    bench_iop_ctx_t *agreement = ctx;
+
+    return val->crypto->destroy_key(agreement->shared_key);
+}
+
+static int32_t interruptible_agreement_checks(void)
+{
+    int32_t               i, status;
+    int32_t               num_checks = sizeof(check2)/sizeof(check2[0]);
+    uint32_t              j;
+    const test_data      *data;
+
+    for (i = 0; i < num_checks; i++)
+    {
+        val->print(TEST, "Check %d: ", i+1);
+        val->print(TEST, check2[i].test_desc, 0);
+
+        data       = &check2[i];
+        bench.data = data;
+        status = bench_import_key(val, data->type, PSA_KEY_USAGE_DERIVE, data->alg,
+                                  data->data, data->data_length, &bench.key);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        status = val->crypto->raw_key_agreement(data->alg, bench.key, data->peer_key,
+                                                data->peer_key_length, bench.reference,
+                                                sizeof(bench.reference),
+                                                &bench.reference_length);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
+
+        for (j = 0; j < sizeof(bench_max_ops)/sizeof(bench_max_ops[0]); j++)
+        {
+            val->crypto->interruptible_set_max_ops(bench_max_ops[j]);
+            bench_print_max_ops(bench_max_ops[j]);
+
+            bench_slice_reset(&bench);
+            status = bench_latency(val, "key_agreement_iop_setup/complete", agreement_sample,
+                                   agreement_cleanup, &bench, data->samples);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
+            bench_slice_print("key_agreement_iop_complete", &bench);
+
+            /* The shared secret must match the one of the blocking path */
+            status = agreement_sample(&bench);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
+
+            status = val->crypto->export_key(bench.shared_key, bench.output,
+                                             sizeof(bench.output), &bench.output_length);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
+
+            status = val->crypto->destroy_key(bench.shared_key);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(7));
+
+            TEST_ASSERT_EQUAL(bench.output_length, bench.reference_length,
+                              TEST_CHECKPOINT_NUM(8));
+            TEST_ASSERT_MEMCMP(bench.output, bench.reference, bench.reference_length,
+                               TEST_CHECKPOINT_NUM(9));
+        }
+
+        status = val->crypto->destroy_key(bench.key);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(10));
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+#endif
+
+int32_t psa_interruptible_key_agreement_test(caller_security_t caller __UNUSED)
+{
+#ifdef ARCH_TEST_INTERRUPTIBLE_KEY_AGREEMENT
+    int32_t               status;
+    int32_t               num_checks = sizeof(check2)/sizeof(check2[0]);
+    uint32_t              max_ops;
+
+    if (num_checks == 0)
+    {
+        val->print(TEST, "No test available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    if (!bench_timer_available(val))
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto->crypto_init();
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    /* The max_ops setting is global, restore it whatever the result of the checks */
+    max_ops = val->crypto->interruptible_get_max_ops();
+    status  = interruptible_agreement_checks();
+    val->crypto->interruptible_set_max_ops(max_ops);
+
+    return status;
+#else
+    val->print(TEST, "No test available for the selected crypto configuration\n", 0);
+    return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+#endif
+}
@@ -0,0 +1,265 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "test_b012.h"
+#include "test_data.h"
+
+const client_test_t test_b012_crypto_list[] = {
+    NULL,
+    psa_random_throughput_test,
+    psa_random_quality_test,
+    NULL,
+};
+
+/* Counts of the statistical tests, updated as the sample is generated */
+typedef struct {
+    uint64_t                bits;
+    uint64_t                ones;
+    uint64_t                runs;           /* Runs of identical bits */
+    uint32_t                last_bit;
+    uint32_t                nibbles[16];    /* Poker test */
+    uint32_t                block_bits;     /* Bits of the current block */
+    uint32_t                run;            /* Current run of ones of the block */
+    uint32_t                longest;        /* Longest run of ones of the block */
+    uint32_t                longest_runs[RANDOM_LONGEST_RUN_CLASSES];
+    uint32_t                window;         /* Last bits of the sample */
+    uint8_t                 head;           /* First byte, the windows wrap around to it */
+    uint32_t                patterns[RANDOM_APEN_PATTERNS];
+} random_stats_t;
+
+static random_stats_t stats;
+
+static psa_status_t random_op(const void *ctx __UNUSED, size_t length)
+{
+    return val->crypto->generate_random(bench_output, length);
+}
+
+static psa_status_t random_sample(void *ctx __UNUSED)
+{
+    return val->crypto->generate_random(bench_output, RANDOM_LATENCY_SIZE);
+}
+
+int32_t psa_random_throughput_test(caller_security_t caller __UNUSED)
+{
+    int32_t               status;
+
+    if (!bench_timer_available(val))
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto->crypto_init();
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    val->print(TEST, "Check 1: Throughput generate_random\n", 0);
+    status = bench_sweep(val, "one-shot", random_op, NULL);
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+    val->print(TEST, "Check 2: Latency generate_random - %d B\n", RANDOM_LATENCY_SIZE);
+    status = bench_latency(val, "generate_random", random_sample, NULL, NULL,
+                           BENCH_LATENCY_SAMPLES);
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
+
+    return VAL_STATUS_SUCCESS;
+}
+
+/* Counts the pattern of the last m bits and the bit following them */
+static void random_pattern_add(random_stats_t *s, uint32_t bit)
+{
+    s->window = ((s->window << 1) | bit) & (RANDOM_APEN_PATTERNS - 1);
+    s->patterns[s->window]++;
+}
+
+static void random_stats_update(random_stats_t *s, const uint8_t *data, size_t length)
+{
+    size_t   i;
+    int32_t  j;
+    uint32_t bit;
+
+    if ((s->bits == 0) && (length > 0))
+        s->head = data[0];
+
+    for (i = 0; i < length; i++)
+    {
+        s->nibbles[data[i] >> 4]++;
+        s->nibbles[data[i] & 0xF]++;
+
+        for (j = 7; j >= 0; j--)
+        {
+            bit = (data[i] >> j) & 1;
+            s->ones     += bit;
+            s->runs     += (s->bits == 0) || (bit != s->last_bit);
+            s->last_bit  = bit;
+
+            s->run       = bit ? s->run + 1 : 0;
+            s->longest   = MAX(s->longest, s->run);
+            if (++s->block_bits == RANDOM_BLOCK_BITS)
+            {
+                s->longest_runs[MIN(MAX(s->longest, RANDOM_LONGEST_RUN_MIN),
+                                    RANDOM_LONGEST_RUN_MIN + RANDOM_LONGEST_RUN_CLASSES - 1)
+                                - RANDOM_LONGEST_RUN_MIN]++;
+                s->block_bits = 0;
+                s->run        = 0;
+                s->longest    = 0;
+            }
+
+            /* The first m bits only start the first pattern */
+            if (s->bits < RANDOM_APEN_BITS)
+                s->window = (s->window << 1) | bit;
+            else
+                random_pattern_add(s, bit);
+            s->bits++;
+        }
+    }
+}
+
+static uint64_t random_isqrt(uint64_t value)
+{
+    uint64_t root = 0, bit = (uint64_t)1 << 62;
+
+    while (bit > value)
+        bit >>= 2;
+
+    while (bit != 0)
+    {
+        if (value >= root + bit)
+        {
+            value -= root + bit;
+            root   = (root >> 1) + bit;
+        }
+        else
+            root >>= 1;
+        bit >>= 2;
+    }
+
+    return root;
+}
+
+/* Computes the statistics of the tests, multiplied by 100 */
+static void random_stats_compute(random_stats_t *s, uint64_t *value)
+{
+    uint64_t n = s->bits, root = random_isqrt(s->bits);
+    uint64_t nibbles = n / 4, blocks = n / RANDOM_BLOCK_BITS;
+    uint64_t q, mean, sum, expected;
+    int64_t  diff;
+    uint32_t i;
+
+    /* Frequency of the ones, z = |2 ones - n| / sqrt(n) */
+    diff  = (int64_t)(2 * s->ones) - (int64_t)n;
+    value[RANDOM_MONOBIT] = (uint64_t)(diff < 0 ? -diff : diff) * 100 / root;
+
+    /* Runs of identical bits, of mean 2 n p (1 - p) and standard deviation
+     * 2 sqrt(n) p (1 - p), p the frequency of the ones
+     */
+    q    = s->ones * (n - s->ones) / n;
+    mean = 2 * q;
+    diff = (int64_t)s->runs - (int64_t)mean;
+    value[RANDOM_RUNS] = (q == 0) ? UINT32_MAX :
+                         (uint64_t)(diff < 0 ? -diff : diff) * 100 * root / (2 * q);
+
+    /* 4 bit values, chi2 = sum((16 f - m)^2) / (16 m) for m values */
+    sum = 0;
+    for (i = 0; i < 16; i++)
+    {
+        diff = 16 * (int64_t)s->nibbles[i] - (int64_t)nibbles;
+        sum += (uint64_t)(diff * diff);
+    }
+    value[RANDOM_POKER] = sum * 100 / (16 * nibbles);
+
+    /* Longest runs of ones of the blocks, against their probabilities */
+    sum = 0;
+    for (i = 0; i < RANDOM_LONGEST_RUN_CLASSES; i++)
+    {
+        expected = blocks * random_longest_run_prob[i];
+        diff     = 10000 * (int64_t)s->longest_runs[i] - (int64_t)expected;
+        sum     += (uint64_t)(diff * diff) * 100 / (10000 * expected);
+    }
+    value[RANDOM_LONGEST_RUN] = sum;
+
+    /* Approximate entropy, as the Pearson chi-square of the bit following each m bit
+     * pattern. It is asymptotically equal to the 2 n (ln 2 - ApEn) statistic of
+     * SP 800-22 and needs no logarithm.
+     */
+    sum = 0;
+    for (i = 0; i < RANDOM_APEN_PATTERNS / 2; i++)
+    {
+        diff = (int64_t)s->patterns[2 * i + 1] - (int64_t)s->patterns[2 * i];
+        if (s->patterns[2 * i] + s->patterns[2 * i + 1] != 0)
+            sum += (uint64_t)(diff * diff) * 100 /
+                   (s->patterns[2 * i] + s->patterns[2 * i + 1]);
+    }
+    value[RANDOM_APPROXIMATE_ENTROPY] = sum;
+}
+
+static void random_print_fixed(const char *label, uint64_t value)
+{
+    val->print(TEST, label, 0);
+    val->print(TEST, " %d.", (int32_t)MIN(value / 100, 0x7FFFFFFF));
+    val->print(TEST, "%d", (int32_t)(value % 100 / 10));
+    val->print(TEST, "%d", (int32_t)(value % 10));
+}
+
+int32_t psa_random_quality_test(caller_security_t caller __UNUSED)
+{
+    int32_t               i, status, failures = 0;
+    uint32_t              size;
+    size_t                length;
+    uint64_t              value[RANDOM_TEST_COUNT];
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto->crypto_init();
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    val->print(TEST, "Check 1: Statistical tests generate_random - %d B\n",
+               PLATFORM_BENCH_RANDOM_SIZE);
+
+    memset(&stats, 0, sizeof(stats));
+    for (size = 0; size < PLATFORM_BENCH_RANDOM_SIZE; size += length)
+    {
+        status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+        TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        length = MIN(BENCH_OUTPUT_SIZE, PLATFORM_BENCH_RANDOM_SIZE - size);
+        status = val->crypto->generate_random(bench_output, length);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
+
+        random_stats_update(&stats, bench_output, length);
+    }
+
+    /* The last patterns wrap around to the first bits of the sample */
+    for (i = RANDOM_APEN_BITS - 1; i >= 0; i--)
+        random_pattern_add(&stats, (stats.head >> i) & 1);
+
+    random_stats_compute(&stats, value);
+    for (i = 0; i < RANDOM_TEST_COUNT; i++)
+    {
+        val->print(TEST, "\t", 0);
+        random_print_fixed(check1[i].test_desc, value[i]);
+        random_print_fixed(", bounds", check1[i].min);
+        random_print_fixed(" to", check1[i].max);
+        if ((value[i] < check1[i].min) || (value[i] > check1[i].max))
+        {
+            val->print(TEST, ", failed", 0);
+            failures++;
+        }
+        val->print(TEST, "\n", 0);
+    }
+
+    TEST_ASSERT_EQUAL(failures, 0, TEST_CHECKPOINT_NUM(4));
+
+    return VAL_STATUS_SUCCESS;
+}
@@ -0,0 +1,91 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "test_bench_common.h"
+
+/* Bytes drawn from the generator for the statistical tests. The sample is tested as it
+ * is generated, it is not kept in memory.
+ */
+#ifndef PLATFORM_BENCH_RANDOM_SIZE
+#define PLATFORM_BENCH_RANDOM_SIZE     (4 * 1024 * 1024)
+#endif
+
+/* Size of the requests timed one by one, the size of a key or a nonce */
+#define RANDOM_LATENCY_SIZE            32
+
+/* Statistical tests of NIST SP 800-22 and FIPS 140-2 */
+typedef enum {
+    RANDOM_MONOBIT = 0,
+    RANDOM_RUNS,
+    RANDOM_POKER,
+    RANDOM_LONGEST_RUN,
+    RANDOM_APPROXIMATE_ENTROPY,
+    RANDOM_TEST_COUNT,
+} random_test_t;
+
+typedef struct {
+    char                    test_desc[40];
+    uint32_t                min;    /* Bounds of the statistic, multiplied by 100 */
+    uint32_t                max;
+} test_data;
+
+/* The bounds reject a good generator with a probability of 1e-6 for each test: the
+ * z values of a normal distribution and the chi-square values of the degrees of
+ * freedom of the test.
+ */
+static const test_data check1[] = {
+    [RANDOM_MONOBIT] = {
+        .test_desc = "monobit: z",
+        .min       = 0,
+        .max       = 489,
+    },
+    [RANDOM_RUNS] = {
+        .test_desc = "runs: z",
+        .min       = 0,
+        .max       = 489,
+    },
+    [RANDOM_POKER] = {
+        .test_desc = "poker: chi2 (15 dof)",
+        .min       = 121,
+        .max       = 5649,
+    },
+    [RANDOM_LONGEST_RUN] = {
+        .test_desc = "longest run: chi2 (6 dof)",
+        .min       = 3,
+        .max       = 3826,
+    },
+    [RANDOM_APPROXIMATE_ENTROPY] = {
+        .test_desc = "approximate entropy: chi2 (256 dof)",
+        .min       = 16244,
+        .max       = 37829,
+    },
+};
+
+/* Longest run of ones test: blocks of 10^4 bits and the probabilities, in 1/10^4, of
+ * a longest run of at most 10, 11, .., 15 and at least 16 ones in a block
+ */
+#define RANDOM_BLOCK_BITS              10000
+#define RANDOM_LONGEST_RUN_MIN         10
+#define RANDOM_LONGEST_RUN_CLASSES     7
+
+static const uint32_t random_longest_run_prob[RANDOM_LONGEST_RUN_CLASSES] = {
+    882, 2092, 2483, 1933, 1208, 675, 727
+};
+
+/* Approximate entropy test: patterns of m = 8 bits and the bit following them */
+#define RANDOM_APEN_BITS               8
+#define RANDOM_APEN_PATTERNS           (1 << (RANDOM_APEN_BITS + 1))
@@ -0,0 +1,154 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "test_b013.h"
+#include "test_data.h"
+
+const client_test_t test_b013_crypto_list[] = {
+    NULL,
+    psa_kdf_bench_test,
+    psa_pbkdf2_cost_test,
+    NULL,
+};
+
+/* Runs a whole derivation of length bytes, cost being the PBKDF2 iteration count */
+static psa_status_t kdf_derive(const test_data *data, uint64_t cost, uint8_t *output,
+                               size_t length)
+{
+    psa_key_derivation_operation_t operation = PSA_KEY_DERIVATION_OPERATION_INIT;
+    psa_status_t                   status, abort_status;
+    uint32_t                       i;
+
+    status = val->crypto->key_derivation_setup(&operation, data->alg);
+    if (status == PSA_SUCCESS)
+        status = val->crypto->key_derivation_set_capacity(&operation, length);
+
+    for (i = 0; (i < BENCH_KDF_INPUTS) && (status == PSA_SUCCESS); i++)
+    {
+        if (data->inputs[i].step == PSA_KEY_DERIVATION_INPUT_COST)
+            status = val->crypto->key_derivation_input_integer(&operation, data->inputs[i].step,
+                                                               cost);
+        else
+            status = val->crypto->key_derivation_input_bytes(&operation, data->inputs[i].step,
+                                                             data->inputs[i].data,
+                                                             data->inputs[i].data_length);
+    }
+
+    if (status == PSA_SUCCESS)
+        status = val->crypto->key_derivation_output_bytes(&operation, output, length);
+
+    abort_status = val->crypto->key_derivation_abort(&operation);
+    return (status == PSA_SUCCESS) ? abort_status : status;
+}
+
+static psa_status_t kdf_one_shot(const void *ctx, size_t length)
+{
+    return kdf_derive(ctx, 0, bench_output, length);
+}
+
+int32_t psa_kdf_bench_test(caller_security_t caller __UNUSED)
+{
+    int32_t               i, status;
+    int32_t               num_checks = sizeof(check1)/sizeof(check1[0]);
+    size_t                length;
+    uint8_t               prefix[BENCH_KDF_PREFIX_SIZE];
+
+    if (num_checks == 0)
+    {
+        val->print(TEST, "No test available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    if (!bench_timer_available(val))
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto->crypto_init();
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    for (i = 0; i < num_checks; i++)
+    {
+        val->print(TEST, "Check %d: ", i+1);
+        val->print(TEST, check1[i].test_desc, 0);
+
+        status = bench_sweep_limit(val, "one-shot", kdf_one_shot, &check1[i],
+                                   check1[i].capacity);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        /* The output of the largest length measured must start with the short output */
+        status = kdf_derive(&check1[i], 0, prefix, sizeof(prefix));
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
+
+        length = MIN(check1[i].capacity, PLATFORM_BENCH_MAX_MSG_SIZE);
+        status = kdf_derive(&check1[i], 0, bench_output, length);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
+        TEST_ASSERT_MEMCMP(bench_output, prefix, sizeof(prefix), TEST_CHECKPOINT_NUM(5));
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+int32_t psa_pbkdf2_cost_test(caller_security_t caller __UNUSED)
+{
+    int32_t               i, status;
+    int32_t               num_checks = sizeof(check2)/sizeof(check2[0]);
+    uint64_t              cost, start, elapsed;
+
+    if (num_checks == 0)
+    {
+        val->print(TEST, "No test available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    if (!bench_timer_available(val))
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto->crypto_init();
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    for (i = 0; i < num_checks; i++)
+    {
+        val->print(TEST, "Check %d: ", i+1);
+        val->print(TEST, check2[i].test_desc, 0);
+
+        for (cost = BENCH_PBKDF2_MIN_COST; cost <= PLATFORM_BENCH_PBKDF2_MAX_COST;
+             cost *= BENCH_PBKDF2_COST_STEP)
+        {
+            status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+            TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+            start   = val->get_time_ns();
+            status  = kdf_derive(&check2[i], cost, bench_output, check2[i].capacity);
+            elapsed = val->get_time_ns() - start;
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
+
+            elapsed = (elapsed != 0) ? elapsed : 1;
+            val->print(TEST, "\t%d iterations:", (int32_t)cost);
+            if (elapsed <= 0xFFFFFFFF)
+                bench_print_time(val, "", (uint32_t)elapsed);
+            else
+                val->print(TEST, " %d ms", (int32_t)(elapsed / 1000000));
+            bench_print_time(val, ",", (uint32_t)(elapsed / cost));
+            val->print(TEST, "/iteration, %d iterations/s\n",
+                       (int32_t)MIN(cost * 1000000000 / elapsed, 0x7FFFFFFF));
+        }
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
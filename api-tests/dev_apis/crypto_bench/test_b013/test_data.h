@@ -0,0 +1,137 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "test_bench_common.h"
+
+/* Largest PBKDF2 iteration count measured, from 1000 in steps of 10. The platforms
+ * with a slow PRF can lower it in pal_config.h.
+ */
+#ifndef PLATFORM_BENCH_PBKDF2_MAX_COST
+#define PLATFORM_BENCH_PBKDF2_MAX_COST 1000000
+#endif
+#define BENCH_PBKDF2_MIN_COST          1000
+#define BENCH_PBKDF2_COST_STEP         10
+
+/* Size of the output compared between the lengths of the sweep */
+#define BENCH_KDF_PREFIX_SIZE          32
+
+#define BENCH_KDF_INPUTS               3
+
+/* Input of the derivation. The iteration count of PSA_KEY_DERIVATION_INPUT_COST is
+ * set by the test.
+ */
+typedef struct {
+    psa_key_derivation_step_t   step;
+    const uint8_t              *data;
+    size_t                      data_length;
+} bench_kdf_input_t;
+
+typedef struct {
+    char                        test_desc[50];
+    psa_algorithm_t             alg;
+    size_t                      capacity;   /* Largest output, or output of PBKDF2 */
+    bench_kdf_input_t           inputs[BENCH_KDF_INPUTS];
+} test_data;
+
+#define HKDF_INPUTS                                                                 \
+    {                                                                               \
+        {PSA_KEY_DERIVATION_INPUT_SALT,   input_salt,  INPUT_SALT_LEN},             \
+        {PSA_KEY_DERIVATION_INPUT_SECRET, key_data,    AES_32B_KEY_SIZE},           \
+        {PSA_KEY_DERIVATION_INPUT_INFO,   input_info,  INPUT_INFO_LEN},             \
+    }
+
+#define TLS12_PRF_INPUTS                                                            \
+    {                                                                               \
+        {PSA_KEY_DERIVATION_INPUT_SEED,   input_seed,  INPUT_SEED_LEN},             \
+        {PSA_KEY_DERIVATION_INPUT_SECRET, key_data,    AES_32B_KEY_SIZE},           \
+        {PSA_KEY_DERIVATION_INPUT_LABEL,  input_label, INPUT_LABEL_LEN},            \
+    }
+
+#define PBKDF2_INPUTS                                                               \
+    {                                                                               \
+        {PSA_KEY_DERIVATION_INPUT_COST,     NULL,           0},                     \
+        {PSA_KEY_DERIVATION_INPUT_SALT,     input_salt,     INPUT_SALT_LEN},        \
+        {PSA_KEY_DERIVATION_INPUT_PASSWORD, input_password, INPUT_PASSWORD_LEN},    \
+    }
+
+/* Output throughput, up to the capacity of the algorithm: 255 hash blocks */
+static const test_data check1[] = {
+#ifdef ARCH_TEST_HKDF
+#ifdef ARCH_TEST_SHA256
+{
+    .test_desc = "Throughput output_bytes - HKDF SHA-256\n",
+    .alg       = PSA_ALG_HKDF(PSA_ALG_SHA_256),
+    .capacity  = 255 * 32,
+    .inputs    = HKDF_INPUTS,
+},
+#endif
+
+#ifdef ARCH_TEST_SHA512
+{
+    .test_desc = "Throughput output_bytes - HKDF SHA-512\n",
+    .alg       = PSA_ALG_HKDF(PSA_ALG_SHA_512),
+    .capacity  = 255 * 64,
+    .inputs    = HKDF_INPUTS,
+},
+#endif
+#endif
+
+#ifdef ARCH_TEST_TLS12_PRF
+#ifdef ARCH_TEST_SHA256
+{
+    .test_desc = "Throughput output_bytes - TLS12_PRF SHA-256\n",
+    .alg       = PSA_ALG_TLS12_PRF(PSA_ALG_SHA_256),
+    .capacity  = 255 * 32,
+    .inputs    = TLS12_PRF_INPUTS,
+},
+#endif
+
+#ifdef ARCH_TEST_SHA384
+{
+    .test_desc = "Throughput output_bytes - TLS12_PRF SHA-384\n",
+    .alg       = PSA_ALG_TLS12_PRF(PSA_ALG_SHA_384),
+    .capacity  = 255 * 48,
+    .inputs    = TLS12_PRF_INPUTS,
+},
+#endif
+#endif
+};
+
+/* Cost of the iterations, deriving a single block of the PRF */
+static const test_data check2[] = {
+#ifdef ARCH_TEST_PBKDF2
+#ifdef ARCH_TEST_HMAC
+#ifdef ARCH_TEST_SHA256
+{
+    .test_desc = "Iteration cost - PBKDF2_HMAC SHA-256\n",
+    .alg       = PSA_ALG_PBKDF2_HMAC(PSA_ALG_SHA_256),
+    .capacity  = 32,
+    .inputs    = PBKDF2_INPUTS,
+},
+#endif
+#endif
+
+#ifdef ARCH_TEST_CMAC
+{
+    .test_desc = "Iteration cost - PBKDF2_AES_CMAC_PRF_128\n",
+    .alg       = PSA_ALG_PBKDF2_AES_CMAC_PRF_128,
+    .capacity  = 16,
+    .inputs    = PBKDF2_INPUTS,
+},
+#endif
+#endif
+};
@@ -0,0 +1,221 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "test_b014.h"
+#include "test_data.h"
+
+const client_test_t test_b014_crypto_list[] = {
+    NULL,
+    psa_pake_handshake_test,
+    NULL,
+};
+
+/* Latency of each phase of the handshakes in nano seconds. The rounds are phases 1 to
+ * num_rounds, psa_pake_get_shared_key() of both parties is the last phase.
+ */
+static uint32_t bench_pake_times[BENCH_PAKE_PHASES][BENCH_PAKE_HANDSHAKES];
+static uint32_t bench_pake_total[BENCH_PAKE_HANDSHAKES];
+
+static const char *const bench_pake_phase_names[BENCH_PAKE_PHASES] = {
+    "setup", "round 1", "round 2", "round 3", "get_shared_key",
+};
+
+/* Returns the time since last, saturated to 4.29 seconds, and moves last to now */
+static uint32_t pake_elapsed(uint64_t *last)
+{
+    uint64_t now     = val->get_time_ns();
+    uint64_t elapsed = now - *last;
+
+    *last = now;
+    return (elapsed > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32_t)elapsed;
+}
+
+/* Sets up the operation of one party, with the identities of both */
+static psa_status_t pake_setup(const test_data *data, uint32_t party, psa_key_id_t key,
+                               psa_pake_operation_t *operation)
+{
+    psa_pake_cipher_suite_t    cipher_suite = PSA_PAKE_CIPHER_SUITE_INIT;
+    const bench_pake_party_t  *self = &data->party[party];
+    const bench_pake_party_t  *peer = &data->party[party ^ 1];
+    psa_status_t               status;
+
+    val->crypto->pake_cs_set_algorithm(&cipher_suite, data->alg);
+    val->crypto->pake_cs_set_primitive(&cipher_suite, BENCH_PAKE_PRIMITIVE);
+    val->crypto->pake_cs_set_key_confirmation(&cipher_suite, data->key_confirmation);
+
+    status = val->crypto->pake_setup(operation, key, &cipher_suite);
+    if (status == PSA_SUCCESS)
+        status = val->crypto->pake_set_role(operation, self->role);
+    if (status == PSA_SUCCESS)
+        status = val->crypto->pake_set_user(operation, self->id, self->id_length);
+    if (status == PSA_SUCCESS)
+        status = val->crypto->pake_set_peer(operation, peer->id, peer->id_length);
+    if ((status == PSA_SUCCESS) && (data->context != NULL))
+        status = val->crypto->pake_set_context(operation, data->context, data->context_length);
+
+    return status;
+}
+
+/* Runs a whole handshake between the two parties, recording the latency of its phases
+ * as sample. The messages go through bench_output, as they would through a transport.
+ */
+static psa_status_t pake_handshake(const test_data *data, const psa_key_id_t *keys,
+                                   uint32_t sample, psa_key_id_t *shared)
+{
+    psa_pake_operation_t        operation[2] = {PSA_PAKE_OPERATION_INIT,
+                                                PSA_PAKE_OPERATION_INIT};
+    psa_key_attributes_t        attributes = PSA_KEY_ATTRIBUTES_INIT;
+    const bench_pake_message_t *message;
+    psa_status_t                status;
+    uint64_t                    start, last;
+    size_t                      length;
+    uint32_t                    i, party;
+
+    val->crypto->set_key_type(&attributes, PSA_KEY_TYPE_DERIVE);
+    val->crypto->set_key_usage_flags(&attributes, PSA_KEY_USAGE_DERIVE);
+    val->crypto->set_key_algorithm(&attributes, data->kdf_alg);
+
+    start = last = val->get_time_ns();
+
+    status = PSA_SUCCESS;
+    for (party = 0; (party < 2) && (status == PSA_SUCCESS); party++)
+        status = pake_setup(data, party, keys[party], &operation[party]);
+    bench_pake_times[0][sample] = pake_elapsed(&last);
+
+    for (i = 0; (i < data->num_messages) && (status == PSA_SUCCESS); i++)
+    {
+        message = &data->messages[i];
+        status  = val->crypto->pake_output(&operation[message->from], message->step,
+                                           bench_output, sizeof(bench_output), &length);
+        if (status == PSA_SUCCESS)
+            status = val->crypto->pake_input(&operation[message->from ^ 1], message->step,
+                                             bench_output, length);
+
+        /* A round ends on its last message */
+        if ((i + 1 == data->num_messages) || (data->messages[i + 1].round != message->round))
+            bench_pake_times[message->round][sample] = pake_elapsed(&last);
+    }
+
+    for (party = 0; (party < 2) && (status == PSA_SUCCESS); party++)
+        status = val->crypto->pake_get_shared_key(&operation[party], &attributes, &shared[party]);
+    bench_pake_times[BENCH_PAKE_PHASES - 1][sample] = pake_elapsed(&last);
+
+    bench_pake_total[sample] = (last - start > 0xFFFFFFFF) ? 0xFFFFFFFF
+                                                            : (uint32_t)(last - start);
+
+    /* The operations are already inactive, unless the handshake failed */
+    for (party = 0; party < 2; party++)
+        val->crypto->pake_abort(&operation[party]);
+
+    return status;
+}
+
+/* Derives the secret compared between the parties from a shared key */
+static psa_status_t pake_secret(const test_data *data, psa_key_id_t key, uint8_t *secret)
+{
+    psa_key_derivation_operation_t operation = PSA_KEY_DERIVATION_OPERATION_INIT;
+    psa_status_t                   status, abort_status;
+
+    status = val->crypto->key_derivation_setup(&operation, data->kdf_alg);
+    if (status == PSA_SUCCESS)
+        status = val->crypto->key_derivation_input_key(&operation,
+                                                       PSA_KEY_DERIVATION_INPUT_SECRET, key);
+    if ((status == PSA_SUCCESS) && (data->kdf_info != NULL))
+        status = val->crypto->key_derivation_input_bytes(&operation,
+                                                         PSA_KEY_DERIVATION_INPUT_INFO,
+                                                         data->kdf_info, data->kdf_info_length);
+    if (status == PSA_SUCCESS)
+        status = val->crypto->key_derivation_output_bytes(&operation, secret,
+                                                          BENCH_PAKE_SECRET_SIZE);
+
+    abort_status = val->crypto->key_derivation_abort(&operation);
+    return (status == PSA_SUCCESS) ? abort_status : status;
+}
+
+int32_t psa_pake_handshake_test(caller_security_t caller __UNUSED)
+{
+    int32_t               i, status;
+    int32_t               num_checks = sizeof(check1)/sizeof(check1[0]);
+    uint32_t              party, phase, sample;
+    psa_key_id_t          keys[2], shared[2];
+    uint8_t               secret[2][BENCH_PAKE_SECRET_SIZE];
+
+    if (num_checks == 0)
+    {
+        val->print(TEST, "No test available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    if (!bench_timer_available(val))
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto->crypto_init();
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    for (i = 0; i < num_checks; i++)
+    {
+        val->print(TEST, "Check %d: ", i+1);
+        val->print(TEST, check1[i].test_desc, 0);
+
+        for (party = 0; party < 2; party++)
+        {
+            status = bench_import_key(val, check1[i].party[party].type, PSA_KEY_USAGE_DERIVE,
+                                      check1[i].alg, check1[i].party[party].data,
+                                      check1[i].party[party].data_length, &keys[party]);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+        }
+
+        for (sample = 0; sample < BENCH_PAKE_HANDSHAKES; sample++)
+        {
+            status = val->wd_reprogram_timer(WD_CRYPTO_TIMEOUT);
+            TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(3));
+
+            status = pake_handshake(&check1[i], keys, sample, shared);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
+
+            /* Both parties must agree on the key of every handshake, checked untimed */
+            for (party = 0; party < 2; party++)
+            {
+                status = pake_secret(&check1[i], shared[party], secret[party]);
+                TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
+
+                status = val->crypto->destroy_key(shared[party]);
+                TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
+            }
+
+            TEST_ASSERT_MEMCMP(secret[BENCH_PAKE_CLIENT], secret[BENCH_PAKE_SERVER],
+                               BENCH_PAKE_SECRET_SIZE, TEST_CHECKPOINT_NUM(7));
+        }
+
+        for (phase = 0; phase <= check1[i].num_rounds; phase++)
+            bench_print_latency(val, bench_pake_phase_names[phase], bench_pake_times[phase],
+                                BENCH_PAKE_HANDSHAKES);
+        bench_print_latency(val, bench_pake_phase_names[BENCH_PAKE_PHASES - 1],
+                            bench_pake_times[BENCH_PAKE_PHASES - 1], BENCH_PAKE_HANDSHAKES);
+        bench_print_latency(val, "handshake", bench_pake_total, BENCH_PAKE_HANDSHAKES);
+
+        for (party = 0; party < 2; party++)
+        {
+            status = val->crypto->destroy_key(keys[party]);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(8));
+        }
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
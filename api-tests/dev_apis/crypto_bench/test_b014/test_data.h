@@ -0,0 +1,160 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+
+#include "test_bench_common.h"
+
+/* Handshakes timed for each cipher suite, every one involving several EC operations */
+#define BENCH_PAKE_HANDSHAKES          BENCH_LATENCY_SLOW_SAMPLES
+
+#define BENCH_PAKE_MAX_MESSAGES        18
+#define BENCH_PAKE_MAX_ROUNDS          3
+
+/* Phases of a handshake: setup, the rounds, then psa_pake_get_shared_key() */
+#define BENCH_PAKE_PHASES              (BENCH_PAKE_MAX_ROUNDS + 2)
+
+/* Primitive of all the suites, the curve of the SPAKE2+ test keys */
+#define BENCH_PAKE_PRIMITIVE                                                        \
+    PSA_PAKE_PRIMITIVE(PSA_PAKE_PRIMITIVE_TYPE_ECC, PSA_ECC_FAMILY_SECP_R1, 256)
+
+/* Parties of the handshake, index of their operation */
+#define BENCH_PAKE_CLIENT              0
+#define BENCH_PAKE_SERVER              1
+
+/* Size of the secret derived from the shared key by each party */
+#define BENCH_PAKE_SECRET_SIZE         32
+
+/* Message of the handshake, output by one party and input by the other */
+typedef struct {
+    uint8_t                     round;      /* Round of the message, from 1 */
+    uint8_t                     from;       /* BENCH_PAKE_CLIENT or BENCH_PAKE_SERVER */
+    psa_pake_step_t             step;
+} bench_pake_message_t;
+
+/* Key of one party */
+typedef struct {
+    psa_pake_role_t             role;
+    const uint8_t              *id;
+    size_t                      id_length;
+    psa_key_type_t              type;
+    const uint8_t              *data;
+    size_t                      data_length;
+} bench_pake_party_t;
+
+typedef struct {
+    char                        test_desc[75];
+    psa_algorithm_t             alg;
+    uint32_t                    key_confirmation;
+    bench_pake_party_t          party[2];
+    const uint8_t              *context;        /* NULL if the algorithm takes none */
+    size_t                      context_length;
+    psa_algorithm_t             kdf_alg;        /* Derivation of the secret from the key */
+    const uint8_t              *kdf_info;       /* NULL if the derivation takes none */
+    size_t                      kdf_info_length;
+    uint32_t                    num_rounds;
+    uint32_t                    num_messages;
+    bench_pake_message_t        messages[BENCH_PAKE_MAX_MESSAGES];
+} test_data;
+
+/* Pointer and length of a string, initialising two members */
+#define PAKE_STRING(str)               (const uint8_t *)(str), (sizeof(str) - 1)
+
+#define JPAKE_ZK_MESSAGES(round, from)                                              \
+    {round, from, PSA_PAKE_STEP_KEY_SHARE},                                         \
+    {round, from, PSA_PAKE_STEP_ZK_PUBLIC},                                         \
+    {round, from, PSA_PAKE_STEP_ZK_PROOF}
+
+#define SPAKE2P_SUITE(desc, algorithm)                                              \
+{                                                                                   \
+    .test_desc        = desc,                                                       \
+    .alg              = algorithm,                                                  \
+    .key_confirmation = PSA_PAKE_CONFIRMED_KEY,                                     \
+    .party            = {                                                           \
+        {PSA_PAKE_ROLE_CLIENT, PAKE_STRING("client"),                               \
+         PSA_KEY_TYPE_SPAKE2P_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1),                     \
+         spake2p_key_pair, 64},                                                     \
+        {PSA_PAKE_ROLE_SERVER, PAKE_STRING("server"),                               \
+         PSA_KEY_TYPE_SPAKE2P_PUBLIC_KEY(PSA_ECC_FAMILY_SECP_R1),                   \
+         spake2p_pub_key, 97},                                                      \
+    },                                                                              \
+    .context          = PAKE_STRING("context"),                                     \
+    .kdf_alg          = PSA_ALG_HKDF(PSA_ALG_SHA_256),                              \
+    .kdf_info         = input_bytes_data,                                           \
+    .kdf_info_length  = INPUT_BYTES_DATA_LEN,                                       \
+    .num_rounds       = 3,                                                          \
+    .num_messages     = 4,                                                          \
+    .messages         = {                                                           \
+        {1, BENCH_PAKE_CLIENT, PSA_PAKE_STEP_KEY_SHARE},    /* shareP */            \
+        {2, BENCH_PAKE_SERVER, PSA_PAKE_STEP_KEY_SHARE},    /* shareV */            \
+        {2, BENCH_PAKE_SERVER, PSA_PAKE_STEP_CONFIRM},      /* confirmV */          \
+        {3, BENCH_PAKE_CLIENT, PSA_PAKE_STEP_CONFIRM},      /* confirmP */          \
+    },                                                                              \
+}
+
+static const test_data check1[] = {
+#ifdef ARCH_TEST_JPAKE
+#ifdef ARCH_TEST_SHA256
+{
+    .test_desc        = "Handshake latency - J-PAKE SECP256R1 SHA-256\n",
+    .alg              = PSA_ALG_JPAKE(PSA_ALG_SHA_256),
+    .key_confirmation = PSA_PAKE_UNCONFIRMED_KEY,
+    .party            = {
+        {PSA_PAKE_ROLE_NONE, PAKE_STRING("client"), PSA_KEY_TYPE_PASSWORD,
+         input_password, INPUT_PASSWORD_LEN},
+        {PSA_PAKE_ROLE_NONE, PAKE_STRING("server"), PSA_KEY_TYPE_PASSWORD,
+         input_password, INPUT_PASSWORD_LEN},
+    },
+    .context          = NULL,
+    .context_length   = 0,
+    .kdf_alg          = PSA_ALG_TLS12_ECJPAKE_TO_PMS,
+    .kdf_info         = NULL,
+    .kdf_info_length  = 0,
+    .num_rounds       = 2,
+    .num_messages     = 18,
+    .messages         = {
+        /* Round 1: two key shares with their proof in each direction */
+        JPAKE_ZK_MESSAGES(1, BENCH_PAKE_CLIENT),
+        JPAKE_ZK_MESSAGES(1, BENCH_PAKE_CLIENT),
+        JPAKE_ZK_MESSAGES(1, BENCH_PAKE_SERVER),
+        JPAKE_ZK_MESSAGES(1, BENCH_PAKE_SERVER),
+        /* Round 2: one key share with its proof in each direction */
+        JPAKE_ZK_MESSAGES(2, BENCH_PAKE_CLIENT),
+        JPAKE_ZK_MESSAGES(2, BENCH_PAKE_SERVER),
+    },
+},
+#endif
+#endif
+
+#ifdef ARCH_TEST_SPAKE2P
+#ifdef ARCH_TEST_SHA256
+#ifdef ARCH_TEST_SPAKE2P_HMAC
+SPAKE2P_SUITE("Handshake latency - SPAKE2P HMAC SECP256R1 SHA-256\n",
+              PSA_ALG_SPAKE2P_HMAC(PSA_ALG_SHA_256)),
+#endif
+
+#ifdef ARCH_TEST_SPAKE2P_CMAC
+SPAKE2P_SUITE("Handshake latency - SPAKE2P CMAC SECP256R1 SHA-256\n",
+              PSA_ALG_SPAKE2P_CMAC(PSA_ALG_SHA_256)),
+#endif
+#endif
+
+#ifdef ARCH_TEST_SPAKE2P_MATTER
+SPAKE2P_SUITE("Handshake latency - SPAKE2P MATTER SECP256R1\n",
+              PSA_ALG_SPAKE2P_MATTER),
+#endif
+#endif
+};
@@ -0,0 +1,242 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "test_b015.h"
+#include "test_data.h"
+
+const client_test_t test_b015_crypto_list[] = {
+    NULL,
+    psa_hash_state_bench_test,
+    NULL,
+};
+
+/* State operations compared with re-hashing: clone, and suspend followed by resume */
+#define BENCH_HASH_STATE_OPS           2
+
+typedef struct {
+    const test_data        *data;
+    psa_hash_operation_t    source;     /* Operation after the prefix */
+    psa_hash_operation_t    target;     /* Clone, resumed or re-hashing operation */
+    size_t                  length;     /* Size of the re-hashed input */
+    uint8_t                 state[BENCH_HASH_STATE_SIZE];
+    size_t                  state_length;
+} bench_hash_ctx_t;
+
+/* Sets up the source operation and absorbs the prefix */
+static psa_status_t hash_prefix(void *ctx)
+{
+    bench_hash_ctx_t *hash = ctx;
+    psa_status_t      status;
+
+    status = val->crypto->hash_setup(&hash->source, hash->data->alg);
+    if (status == PSA_SUCCESS)
+        status = val->crypto->hash_update(&hash->source, bench_input, BENCH_HASH_PREFIX_SIZE);
+
+    return status;
+}
+
+static psa_status_t hash_abort_target(void *ctx)
+{
+    bench_hash_ctx_t *hash = ctx;
+
+    return val->crypto->hash_abort(&hash->target);
+}
+
+static psa_status_t hash_clone(void *ctx)
+{
+    bench_hash_ctx_t *hash = ctx;
+
+    return val->crypto->hash_clone(&hash->source, &hash->target);
+}
+
+#ifdef ARCH_TEST_HASH_SUSPEND
+static psa_status_t hash_suspend(void *ctx)
+{
+    bench_hash_ctx_t *hash = ctx;
+
+    return val->crypto->hash_suspend(&hash->source, hash->state, sizeof(hash->state),
+                                     &hash->state_length);
+}
+
+#ifdef ARCH_TEST_HASH_RESUME
+static psa_status_t hash_resume(void *ctx)
+{
+    bench_hash_ctx_t *hash = ctx;
+
+    return val->crypto->hash_resume(&hash->target, hash->state, hash->state_length);
+}
+#endif
+#endif
+
+/* Re-hashes length bytes from scratch, the alternative to keeping the state */
+static psa_status_t hash_rehash(void *ctx)
+{
+    bench_hash_ctx_t *hash = ctx;
+    psa_status_t      status;
+
+    status = val->crypto->hash_setup(&hash->target, hash->data->alg);
+    if (status == PSA_SUCCESS)
+        status = val->crypto->hash_update(&hash->target, bench_input, hash->length);
+
+    return status;
+}
+
+/* Re-hashes growing inputs until it costs more than each state operation, and prints
+ * the input size above which keeping the state is the cheaper option
+ */
+static int32_t hash_break_even(bench_hash_ctx_t *hash, const char *const *names,
+                               const uint32_t *cost_ns, uint32_t count)
+{
+    bool_t   found[BENCH_HASH_STATE_OPS] = {FALSE, FALSE};
+    size_t   break_even[BENCH_HASH_STATE_OPS];
+    size_t   length, next, last_length = 0;
+    uint32_t i, left = count, median, last_median = 0;
+    int32_t  status;
+
+    for (length = 0; (length <= PLATFORM_BENCH_MAX_MSG_SIZE) && (left > 0); length = next)
+    {
+        hash->length = length;
+        status = bench_latency_median(val, NULL, hash_rehash, hash_abort_target, hash,
+                                      BENCH_LATENCY_SAMPLES, &median);
+        if (status != PSA_SUCCESS)
+            return status;
+
+        val->print(TEST, "\tre-hash %d B:", (int32_t)length);
+        bench_print_time(val, " median", median);
+        val->print(TEST, "\n", 0);
+
+        for (i = 0; i < count; i++)
+        {
+            if (found[i] || (median < cost_ns[i]))
+                continue;
+
+            /* Linear interpolation between the two sizes around the crossing */
+            break_even[i] = (length == 0) ? 0 : last_length +
+                            (size_t)((uint64_t)(cost_ns[i] - last_median) *
+                                     (length - last_length) / (median - last_median));
+            found[i] = TRUE;
+            left--;
+        }
+
+        last_length = length;
+        last_median = median;
+        next        = (length == 0) ? BENCH_MIN_MSG_SIZE : length * BENCH_HASH_REHASH_STEP;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        val->print(TEST, "\t", 0);
+        val->print(TEST, names[i], 0);
+        if (found[i])
+            val->print(TEST, " break-even: %d B\n", (int32_t)break_even[i]);
+        else
+            val->print(TEST, " break-even: above %d B\n", (int32_t)last_length);
+    }
+
+    return PSA_SUCCESS;
+}
+
+int32_t psa_hash_state_bench_test(caller_security_t caller __UNUSED)
+{
+    static const char *const names[BENCH_HASH_STATE_OPS] = {"clone", "suspend + resume"};
+    int32_t               i, status;
+    int32_t               num_checks = sizeof(check1)/sizeof(check1[0]);
+    uint32_t              cost_ns[BENCH_HASH_STATE_OPS], count;
+    bench_hash_ctx_t      hash;
+    uint8_t               expected[PSA_HASH_MAX_SIZE], digest[PSA_HASH_MAX_SIZE];
+    size_t                expected_length, digest_length;
+#ifdef ARCH_TEST_HASH_SUSPEND
+    uint32_t              suspend_ns;
+#endif
+
+    if (num_checks == 0)
+    {
+        val->print(TEST, "No test available for the selected crypto configuration\n", 0);
+        return RESULT_SKIP(VAL_STATUS_NO_TESTS);
+    }
+
+    if (!bench_timer_available(val))
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+
+    /* Initialize the PSA crypto library*/
+    status = val->crypto->crypto_init();
+    TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+    for (i = 0; i < num_checks; i++)
+    {
+        val->print(TEST, "Check %d: ", i+1);
+        val->print(TEST, check1[i].test_desc, 0);
+
+        hash.data   = &check1[i];
+        hash.source = val->crypto->hash_operation_init();
+        hash.target = val->crypto->hash_operation_init();
+        count       = 0;
+
+        /* Hash of the prefix, which the clone and the resumed operation must give */
+        status = val->crypto->hash_compute(check1[i].alg, bench_input, BENCH_HASH_PREFIX_SIZE,
+                                           expected, sizeof(expected), &expected_length);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        status = hash_prefix(&hash);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
+
+        status = bench_latency_median(val, "clone", hash_clone, hash_abort_target, &hash,
+                                      BENCH_LATENCY_SAMPLES, &cost_ns[count++]);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
+
+        status = hash_clone(&hash);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
+        status = val->crypto->hash_finish(&hash.target, digest, sizeof(digest), &digest_length);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(6));
+        TEST_ASSERT_EQUAL(digest_length, expected_length, TEST_CHECKPOINT_NUM(7));
+        TEST_ASSERT_MEMCMP(digest, expected, digest_length, TEST_CHECKPOINT_NUM(8));
+
+#ifdef ARCH_TEST_HASH_SUSPEND
+        /* Each sample suspends the source, which is set up again untimed */
+        status = bench_latency_median(val, "suspend", hash_suspend, hash_prefix, &hash,
+                                      BENCH_LATENCY_SAMPLES, &suspend_ns);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(9));
+
+        status = hash_suspend(&hash);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(10));
+        val->print(TEST, "\tsuspended state: %d B\n", (int32_t)hash.state_length);
+
+#ifdef ARCH_TEST_HASH_RESUME
+        status = bench_latency_median(val, "resume", hash_resume, hash_abort_target, &hash,
+                                      BENCH_LATENCY_SAMPLES, &cost_ns[count]);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(11));
+        cost_ns[count++] += suspend_ns;
+
+        status = hash_resume(&hash);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(12));
+        status = val->crypto->hash_finish(&hash.target, digest, sizeof(digest), &digest_length);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(13));
+        TEST_ASSERT_EQUAL(digest_length, expected_length, TEST_CHECKPOINT_NUM(14));
+        TEST_ASSERT_MEMCMP(digest, expected, digest_length, TEST_CHECKPOINT_NUM(15));
+#endif
+#endif
+
+        status = val->crypto->hash_abort(&hash.source);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(16));
+
+        status = hash_break_even(&hash, names, cost_ns, count);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(17));
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
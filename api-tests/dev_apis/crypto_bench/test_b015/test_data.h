@@ -0,0 +1,91 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+
+#include "test_bench_common.h"
+
+/* Input absorbed before the state is cloned or suspended. It leaves a partial block
+ * buffered in the operation, as at the boundary of a record.
+ */
+#define BENCH_HASH_PREFIX_SIZE         100
+
+/* Room for the suspended state of any hash: algorithm, input length, hash state and
+ * a partially filled SHA-512 block
+ */
+#define BENCH_HASH_STATE_SIZE          256
+
+/* Re-hashed input sizes, from 0 and BENCH_MIN_MSG_SIZE in steps of 2 up to
+ * PLATFORM_BENCH_MAX_MSG_SIZE. The sweep stops once re-hashing costs more than all
+ * the state operations.
+ */
+#define BENCH_HASH_REHASH_STEP         2
+
+typedef struct {
+    char                    test_desc[50];
+    psa_algorithm_t         alg;
+} test_data;
+
+static const test_data check1[] = {
+#ifdef ARCH_TEST_MD5
+{
+    .test_desc = "Hash state cost - MD5\n",
+    .alg       = PSA_ALG_MD5,
+},
+#endif
+
+#ifdef ARCH_TEST_RIPEMD160
+{
+    .test_desc = "Hash state cost - RIPEMD160\n",
+    .alg       = PSA_ALG_RIPEMD160,
+},
+#endif
+
+#ifdef ARCH_TEST_SHA1
+{
+    .test_desc = "Hash state cost - SHA1\n",
+    .alg       = PSA_ALG_SHA_1,
+},
+#endif
+
+#ifdef ARCH_TEST_SHA224
+{
+    .test_desc = "Hash state cost - SHA224\n",
+    .alg       = PSA_ALG_SHA_224,
+},
+#endif
+
+#ifdef ARCH_TEST_SHA256
+{
+    .test_desc = "Hash state cost - SHA256\n",
+    .alg       = PSA_ALG_SHA_256,
+},
+#endif
+
+#ifdef ARCH_TEST_SHA384
+{
+    .test_desc = "Hash state cost - SHA384\n",
+    .alg       = PSA_ALG_SHA_384,
+},
+#endif
+
+#ifdef ARCH_TEST_SHA512
+{
+    .test_desc = "Hash state cost - SHA512\n",
+    .alg       = PSA_ALG_SHA_512,
+},
+#endif
+};
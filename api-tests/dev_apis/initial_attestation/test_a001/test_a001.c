@@ -34,7 +34,12 @@ int32_t psa_initial_attestation_get_token_test(caller_security_t caller __UNUSED
     int32_t     status;
     size_t      token_buffer_size, token_size;
     uint8_t     challenge[PSA_INITIAL_ATTEST_CHALLENGE_SIZE_64+1];
-    uint8_t     token_buffer[PSA_INITIAL_ATTEST_MAX_TOKEN_SIZE];
+    uint8_t     *token_buffer;
+
+    /* The token buffer is too large for the stack of the small platforms */
+    token_buffer = val->scratch_alloc(PSA_INITIAL_ATTEST_MAX_TOKEN_SIZE);
+    if (token_buffer == NULL)
+        return VAL_STATUS_INSUFFICIENT_SIZE;
 
 #ifdef PSA_ATTESTATION_PROFILE_1
     val->print(TEST, "[Info] The Attestation Profile being tested = 1\n", 0);
@@ -52,7 +57,7 @@ int32_t psa_initial_attestation_get_token_test(caller_security_t caller __UNUSED
         val->print(TEST, check1[i].test_desc, 0);
 
         memset(challenge, 0x2a, sizeof(challenge));
-        memset(token_buffer, 0, sizeof(token_buffer));
+        memset(token_buffer, 0, PSA_INITIAL_ATTEST_MAX_TOKEN_SIZE);
 
         status = val->attestation_function(VAL_INITIAL_ATTEST_GET_TOKEN_SIZE,
                      challenge_size, &token_buffer_size);
@@ -48,8 +48,8 @@ int32_t psa_sst_insufficient_space(storage_function_code_t fCode)
         val->print(TEST, &test_desc[i][0], 0);
         for (uid = TEST_BASE_UID_VALUE; status == PSA_SUCCESS; uid++)
         {
-            val->print(INFO, "Setting 0x%x bytes for ", ARCH_TEST_STORAGE_UID_MAX_SIZE);
-            val->print(INFO, "UID %d\n", (int32_t)uid);
+            TEST_PRINT(INFO, "Setting 0x%x bytes for ", ARCH_TEST_STORAGE_UID_MAX_SIZE);
+            TEST_PRINT(INFO, "UID %d\n", (int32_t)uid);
             status = STORAGE_FUNCTION(s003_data[VAL_TEST_IDX1].api[fCode], uid,
                                       ARCH_TEST_STORAGE_UID_MAX_SIZE, write_buff,
                                       PSA_STORAGE_FLAG_NONE);
@@ -71,7 +71,7 @@ int32_t psa_sst_insufficient_space(storage_function_code_t fCode)
         }
         for (uid = TEST_BASE_UID_VALUE; uid < (count + TEST_BASE_UID_VALUE); uid++)
         {
-            val->print(INFO, "Removing UID %d\n", (int32_t)uid);
+            TEST_PRINT(INFO, "Removing UID %d\n", (int32_t)uid);
             status = STORAGE_FUNCTION(s003_data[VAL_TEST_IDX2].api[fCode], uid);
             if (status != PSA_SUCCESS)
                 break;
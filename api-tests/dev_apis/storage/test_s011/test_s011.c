@@ -117,7 +117,7 @@ static int32_t psa_sst_optional_api_uid_not_found(storage_function_code_t fCode)
 
     if (status == s011_data[VAL_TEST_IDX0].status)
     {
-       val->print(INFO, "Optional PS APIs are supported.\n", 0);
+       TEST_PRINT(INFO, "Optional PS APIs are supported.\n", 0);
        test_status = psa_sst_uid_not_found(fCode);
        if (test_status != VAL_STATUS_SUCCESS)
           return test_status;
@@ -138,7 +138,7 @@ static int32_t psa_sst_optional_api_offset_invalid(storage_function_code_t fCode
 
     if (status == s012_data[VAL_TEST_IDX0].status)
     {
-       val->print(INFO, "Optional PS APIs are supported.\n", 0);
+       TEST_PRINT(INFO, "Optional PS APIs are supported.\n", 0);
        test_status = psa_sst_offset_invalid(fCode);
        if (test_status != VAL_STATUS_SUCCESS)
           return test_status;
@@ -145,7 +145,7 @@ int32_t psa_sst_optional_api_success_check(storage_function_code_t fCode)
 
     if (status == s013_data[VAL_TEST_IDX0].status)
     {
-       val->print(INFO, "Optional PS APIs are supported.\n", 0);
+       TEST_PRINT(INFO, "Optional PS APIs are supported.\n", 0);
        test_status = psa_sst_set_extended_create_success(fCode);
        if (test_status != VAL_STATUS_SUCCESS)
           return test_status;
@@ -83,7 +83,7 @@ static int32_t psa_sst_optional_api_not_supported_check(storage_function_code_t
 
     if (status == s014_data[VAL_TEST_IDX0].status)
     {
-       val->print(INFO, "Test Case skipped as Optional PS APIs are supported.\n", 0);
+       TEST_PRINT(INFO, "Test Case skipped as Optional PS APIs are supported.\n", 0);
        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
     }
     else
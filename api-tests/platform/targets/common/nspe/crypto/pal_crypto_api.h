@@ -0,0 +1,533 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _PAL_CRYPTO_API_H_
+#define _PAL_CRYPTO_API_H_
+
+#include "pal_interfaces_ns.h"
+
+/*
+ * Description of the typed crypto API, the single place a crypto function is listed.
+ * It expands into the pal_crypto_api_t function table and into the prototypes of
+ * the PAL wrappers, so that the table, the wrappers and the PSA headers are kept
+ * consistent by the compiler.
+ *
+ * DIRECT(ret, name, args, code, kind, names)  : Calls psa_<name> itself, straight
+ *                                               to the PSA implementation.
+ * WRAPPED(ret, name, args, code, kind, names) : Calls pal_crypto_<name>. Used for the
+ *                                               calls that create or destroy keys
+ *                                               (tracked for the cleanup of a test),
+ *                                               for optional functions compiled out
+ *                                               through pal_crypto_config.h, and for
+ *                                               the functions the PSA spec allows to
+ *                                               be provided as macros or static inlines.
+ *
+ * code is the function code without its PAL_CRYPTO_ prefix and names the names of the
+ * arguments, in the order of args. kind tells how the table entry brackets the call
+ * with the hooks of pal_crypto_function, while the calls are traced or profiled, see
+ * pal_crypto_intf.c:
+ *
+ *   STATUS VOID VALUE    : Returns a psa_status_t, nothing or a value
+ *   STATUS_NOARGS VOID_NOARGS VALUE_NOARGS
+ *                        : Same, for a function without argument
+ *   NONE                 : Not bracketed, the initializers of the operations and of the
+ *                          key attributes, which return a constant
+ *   PLAIN_VOID PLAIN_VALUE
+ *                        : Not bracketed, the setters and getters of the key
+ *                          attributes, which return nothing or a value. The trace
+ *                          records the attributes by value in the calls using them.
+ */
+/* Interruptible operations, listed only when enabled in pal_crypto_config.h: the PSA
+ * headers of the implementations without them do not declare their operation types.
+ */
+#if defined(ARCH_TEST_INTERRUPTIBLE_SIGN_HASH) || defined(ARCH_TEST_INTERRUPTIBLE_KEY_AGREEMENT)
+#define PAL_CRYPTO_API_INTERRUPTIBLE(DIRECT, WRAPPED)                                    \
+    DIRECT(void, interruptible_set_max_ops, (uint32_t max_ops),                          \
+           INTERRUPTIBLE_SET_MAX_OPS, VOID, (max_ops))                                   \
+    DIRECT(uint32_t, interruptible_get_max_ops, (void),                                  \
+           INTERRUPTIBLE_GET_MAX_OPS, VALUE_NOARGS, ())
+#else
+#define PAL_CRYPTO_API_INTERRUPTIBLE(DIRECT, WRAPPED)
+#endif
+
+#ifdef ARCH_TEST_INTERRUPTIBLE_SIGN_HASH
+#define PAL_CRYPTO_API_INTERRUPTIBLE_SIGN_HASH(DIRECT, WRAPPED)                          \
+    WRAPPED(psa_sign_hash_interruptible_operation_t,                                     \
+            sign_hash_interruptible_operation_init, (void),                              \
+            SIGN_HASH_INTERRUPTIBLE_OPERATION_INIT, NONE, ())                            \
+    DIRECT(psa_status_t, sign_hash_start,                                                \
+           (psa_sign_hash_interruptible_operation_t *operation, psa_key_id_t key,        \
+            psa_algorithm_t alg, const uint8_t *hash, size_t hash_length),               \
+           SIGN_HASH_START, STATUS, (operation, key, alg, hash, hash_length))            \
+    DIRECT(psa_status_t, sign_hash_complete,                                             \
+           (psa_sign_hash_interruptible_operation_t *operation, uint8_t *signature,      \
+            size_t signature_size, size_t *signature_length),                            \
+           SIGN_HASH_COMPLETE, STATUS, (operation, signature, signature_size,            \
+                                        signature_length))                               \
+    DIRECT(uint32_t, sign_hash_get_num_ops,                                              \
+           (const psa_sign_hash_interruptible_operation_t *operation),                   \
+           SIGN_HASH_GET_NUM_OPS, VALUE, (operation))                                    \
+    DIRECT(psa_status_t, sign_hash_abort,                                                \
+           (psa_sign_hash_interruptible_operation_t *operation),                         \
+           SIGN_HASH_ABORT, STATUS, (operation))                                         \
+    WRAPPED(psa_verify_hash_interruptible_operation_t,                                   \
+            verify_hash_interruptible_operation_init, (void),                            \
+            VERIFY_HASH_INTERRUPTIBLE_OPERATION_INIT, NONE, ())                          \
+    DIRECT(psa_status_t, verify_hash_start,                                              \
+           (psa_verify_hash_interruptible_operation_t *operation, psa_key_id_t key,      \
+            psa_algorithm_t alg, const uint8_t *hash, size_t hash_length,                \
+            const uint8_t *signature, size_t signature_length),                          \
+           VERIFY_HASH_START, STATUS, (operation, key, alg, hash, hash_length,           \
+                                       signature, signature_length))                     \
+    DIRECT(psa_status_t, verify_hash_complete,                                           \
+           (psa_verify_hash_interruptible_operation_t *operation),                       \
+           VERIFY_HASH_COMPLETE, STATUS, (operation))                                    \
+    DIRECT(uint32_t, verify_hash_get_num_ops,                                            \
+           (const psa_verify_hash_interruptible_operation_t *operation),                 \
+           VERIFY_HASH_GET_NUM_OPS, VALUE, (operation))                                  \
+    DIRECT(psa_status_t, verify_hash_abort,                                              \
+           (psa_verify_hash_interruptible_operation_t *operation),                       \
+           VERIFY_HASH_ABORT, STATUS, (operation))
+#else
+#define PAL_CRYPTO_API_INTERRUPTIBLE_SIGN_HASH(DIRECT, WRAPPED)
+#endif
+
+#ifdef ARCH_TEST_INTERRUPTIBLE_KEY_AGREEMENT
+#define PAL_CRYPTO_API_INTERRUPTIBLE_KEY_AGREEMENT(DIRECT, WRAPPED)                      \
+    WRAPPED(psa_key_agreement_iop_t, key_agreement_iop_init, (void),                     \
+            KEY_AGREEMENT_IOP_INIT, NONE, ())                                            \
+    DIRECT(psa_status_t, key_agreement_iop_setup,                                        \
+           (psa_key_agreement_iop_t *operation, psa_key_id_t private_key,                \
+            const uint8_t *peer_key, size_t peer_key_length, psa_algorithm_t alg,        \
+            const psa_key_attributes_t *attributes),                                     \
+           KEY_AGREEMENT_IOP_SETUP, STATUS, (operation, private_key, peer_key,           \
+                                             peer_key_length, alg, attributes))          \
+    WRAPPED(psa_status_t, key_agreement_iop_complete,                                    \
+            (psa_key_agreement_iop_t *operation, psa_key_id_t *key),                     \
+            KEY_AGREEMENT_IOP_COMPLETE, STATUS, (operation, key))                        \
+    DIRECT(uint32_t, key_agreement_iop_get_num_ops, (psa_key_agreement_iop_t *operation), \
+           KEY_AGREEMENT_IOP_GET_NUM_OPS, VALUE, (operation))                            \
+    DIRECT(psa_status_t, key_agreement_iop_abort, (psa_key_agreement_iop_t *operation),  \
+           KEY_AGREEMENT_IOP_ABORT, STATUS, (operation))
+#else
+#define PAL_CRYPTO_API_INTERRUPTIBLE_KEY_AGREEMENT(DIRECT, WRAPPED)
+#endif
+
+#define PAL_CRYPTO_API(DIRECT, WRAPPED)                                                  \
+    DIRECT(psa_status_t, crypto_init, (void),                                            \
+           INIT, STATUS_NOARGS, ())                                                      \
+    /* Key attributes */                                                                 \
+    WRAPPED(psa_key_attributes_t, key_attributes_init, (void),                           \
+            KEY_ATTRIBUTES_INIT, NONE, ())                                               \
+    WRAPPED(void, set_key_id, (psa_key_attributes_t *attributes, psa_key_id_t id),       \
+            SET_KEY_ID, PLAIN_VOID, (attributes, id))                                          \
+    WRAPPED(psa_key_id_t, get_key_id, (const psa_key_attributes_t *attributes),          \
+            GET_KEY_ID, PLAIN_VALUE, (attributes))                                             \
+    WRAPPED(void, set_key_lifetime, (psa_key_attributes_t *attributes,                   \
+                                     psa_key_lifetime_t lifetime),                       \
+            SET_KEY_LIFETIME, PLAIN_VOID, (attributes, lifetime))                              \
+    WRAPPED(psa_key_lifetime_t, get_key_lifetime, (const psa_key_attributes_t *attributes), \
+            GET_KEY_LIFETIME, PLAIN_VALUE, (attributes))                                       \
+    WRAPPED(void, set_key_usage_flags, (psa_key_attributes_t *attributes,                \
+                                        psa_key_usage_t usage_flags),                    \
+            SET_KEY_USAGE_FLAGS, PLAIN_VOID, (attributes, usage_flags))                        \
+    WRAPPED(psa_key_usage_t, get_key_usage_flags, (const psa_key_attributes_t *attributes), \
+            GET_KEY_USAGE_FLAGS, PLAIN_VALUE, (attributes))                                    \
+    WRAPPED(void, set_key_algorithm, (psa_key_attributes_t *attributes,                  \
+                                      psa_algorithm_t alg),                              \
+            SET_KEY_ALGORITHM, PLAIN_VOID, (attributes, alg))                                  \
+    WRAPPED(psa_algorithm_t, get_key_algorithm, (const psa_key_attributes_t *attributes), \
+            GET_KEY_ALGORITHM, PLAIN_VALUE, (attributes))                                      \
+    WRAPPED(void, set_key_type, (psa_key_attributes_t *attributes, psa_key_type_t type), \
+            SET_KEY_TYPE, PLAIN_VOID, (attributes, type))                                      \
+    WRAPPED(psa_key_type_t, get_key_type, (const psa_key_attributes_t *attributes),      \
+            GET_KEY_TYPE, PLAIN_VALUE, (attributes))                                           \
+    WRAPPED(void, set_key_bits, (psa_key_attributes_t *attributes, size_t bits),         \
+            SET_KEY_BITS, PLAIN_VOID, (attributes, bits))                                      \
+    WRAPPED(size_t, get_key_bits, (const psa_key_attributes_t *attributes),              \
+            GET_KEY_BITS, PLAIN_VALUE, (attributes))                                           \
+    WRAPPED(void, reset_key_attributes, (psa_key_attributes_t *attributes),              \
+            RESET_KEY_ATTRIBUTES, PLAIN_VOID, (attributes))                                    \
+    DIRECT(psa_status_t, get_key_attributes, (psa_key_id_t key,                          \
+                                              psa_key_attributes_t *attributes),         \
+           GET_KEY_ATTRIBUTES, STATUS, (key, attributes))                                \
+    /* Key management */                                                                 \
+    WRAPPED(psa_status_t, import_key, (const psa_key_attributes_t *attributes,           \
+                                       const uint8_t *data, size_t data_length,          \
+                                       psa_key_id_t *key),                               \
+            IMPORT_KEY, STATUS, (attributes, data, data_length, key))                    \
+    WRAPPED(psa_status_t, generate_key, (const psa_key_attributes_t *attributes,         \
+                                         psa_key_id_t *key),                             \
+            GENERATE_KEY, STATUS, (attributes, key))                                     \
+    WRAPPED(psa_status_t, copy_key, (psa_key_id_t source_key,                            \
+                                     const psa_key_attributes_t *attributes,             \
+                                     psa_key_id_t *target_key),                          \
+            COPY_KEY, STATUS, (source_key, attributes, target_key))                      \
+    WRAPPED(psa_status_t, destroy_key, (psa_key_id_t key),                               \
+            DESTROY_KEY, STATUS, (key))                                                  \
+    DIRECT(psa_status_t, purge_key, (psa_key_id_t key),                                  \
+           PURGE_KEY, STATUS, (key))                                                     \
+    DIRECT(psa_status_t, export_key, (psa_key_id_t key, uint8_t *data, size_t data_size, \
+                                      size_t *data_length),                              \
+           EXPORT_KEY, STATUS, (key, data, data_size, data_length))                      \
+    DIRECT(psa_status_t, export_public_key, (psa_key_id_t key, uint8_t *data,            \
+                                             size_t data_size, size_t *data_length),     \
+           EXPORT_PUBLIC_KEY, STATUS, (key, data, data_size, data_length))               \
+    /* Hash */                                                                           \
+    DIRECT(psa_status_t, hash_compute, (psa_algorithm_t alg, const uint8_t *input,       \
+                                        size_t input_length, uint8_t *hash,              \
+                                        size_t hash_size, size_t *hash_length),          \
+           HASH_COMPUTE, STATUS, (alg, input, input_length, hash, hash_size,             \
+                                  hash_length))                                          \
+    DIRECT(psa_status_t, hash_compare, (psa_algorithm_t alg, const uint8_t *input,       \
+                                        size_t input_length, const uint8_t *hash,        \
+                                        size_t hash_length),                             \
+           HASH_COMPARE, STATUS, (alg, input, input_length, hash, hash_length))          \
+    WRAPPED(psa_hash_operation_t, hash_operation_init, (void),                           \
+            HASH_OPERATION_INIT, NONE, ())                                               \
+    DIRECT(psa_status_t, hash_setup, (psa_hash_operation_t *operation,                   \
+                                      psa_algorithm_t alg),                              \
+           HASH_SETUP, STATUS, (operation, alg))                                         \
+    DIRECT(psa_status_t, hash_update, (psa_hash_operation_t *operation,                  \
+                                       const uint8_t *input, size_t input_length),       \
+           HASH_UPDATE, STATUS, (operation, input, input_length))                        \
+    DIRECT(psa_status_t, hash_finish, (psa_hash_operation_t *operation, uint8_t *hash,   \
+                                       size_t hash_size, size_t *hash_length),           \
+           HASH_FINISH, STATUS, (operation, hash, hash_size, hash_length))               \
+    DIRECT(psa_status_t, hash_verify, (psa_hash_operation_t *operation,                  \
+                                       const uint8_t *hash, size_t hash_length),         \
+           HASH_VERIFY, STATUS, (operation, hash, hash_length))                          \
+    DIRECT(psa_status_t, hash_abort, (psa_hash_operation_t *operation),                  \
+           HASH_ABORT, STATUS, (operation))                                              \
+    WRAPPED(psa_status_t, hash_suspend, (psa_hash_operation_t *operation,                \
+                                         uint8_t *hash_state, size_t hash_state_size,    \
+                                         size_t *hash_state_length),                     \
+            HASH_SUSPEND, STATUS, (operation, hash_state, hash_state_size,               \
+                                   hash_state_length))                                   \
+    WRAPPED(psa_status_t, hash_resume, (psa_hash_operation_t *operation,                 \
+                                        const uint8_t *hash_state,                       \
+                                        size_t hash_state_length),                       \
+            HASH_RESUME, STATUS, (operation, hash_state, hash_state_length))             \
+    DIRECT(psa_status_t, hash_clone, (const psa_hash_operation_t *source_operation,      \
+                                      psa_hash_operation_t *target_operation),           \
+           HASH_CLONE, STATUS, (source_operation, target_operation))                     \
+    /* MAC */                                                                            \
+    DIRECT(psa_status_t, mac_compute, (psa_key_id_t key, psa_algorithm_t alg,            \
+                                       const uint8_t *input, size_t input_length,        \
+                                       uint8_t *mac, size_t mac_size, size_t *mac_length), \
+           MAC_COMPUTE, STATUS, (key, alg, input, input_length, mac, mac_size,           \
+                                 mac_length))                                            \
+    DIRECT(psa_status_t, mac_verify, (psa_key_id_t key, psa_algorithm_t alg,             \
+                                      const uint8_t *input, size_t input_length,         \
+                                      const uint8_t *mac, size_t mac_length),            \
+           MAC_VERIFY, STATUS, (key, alg, input, input_length, mac, mac_length))         \
+    WRAPPED(psa_mac_operation_t, mac_operation_init, (void),                             \
+            MAC_OPERATION_INIT, NONE, ())                                                \
+    DIRECT(psa_status_t, mac_sign_setup, (psa_mac_operation_t *operation,                \
+                                          psa_key_id_t key, psa_algorithm_t alg),        \
+           MAC_SIGN_SETUP, STATUS, (operation, key, alg))                                \
+    DIRECT(psa_status_t, mac_verify_setup, (psa_mac_operation_t *operation,              \
+                                            psa_key_id_t key, psa_algorithm_t alg),      \
+           MAC_VERIFY_SETUP, STATUS, (operation, key, alg))                              \
+    DIRECT(psa_status_t, mac_update, (psa_mac_operation_t *operation,                    \
+                                      const uint8_t *input, size_t input_length),        \
+           MAC_UPDATE, STATUS, (operation, input, input_length))                         \
+    DIRECT(psa_status_t, mac_sign_finish, (psa_mac_operation_t *operation, uint8_t *mac, \
+                                           size_t mac_size, size_t *mac_length),         \
+           MAC_SIGN_FINISH, STATUS, (operation, mac, mac_size, mac_length))              \
+    DIRECT(psa_status_t, mac_verify_finish, (psa_mac_operation_t *operation,             \
+                                             const uint8_t *mac, size_t mac_length),     \
+           MAC_VERIFY_FINISH, STATUS, (operation, mac, mac_length))                      \
+    DIRECT(psa_status_t, mac_abort, (psa_mac_operation_t *operation),                    \
+           MAC_ABORT, STATUS, (operation))                                               \
+    /* Cipher */                                                                         \
+    DIRECT(psa_status_t, cipher_encrypt, (psa_key_id_t key, psa_algorithm_t alg,         \
+                                          const uint8_t *input, size_t input_length,     \
+                                          uint8_t *output, size_t output_size,           \
+                                          size_t *output_length),                        \
+           CIPHER_ENCRYPT, STATUS, (key, alg, input, input_length, output, output_size,  \
+                                    output_length))                                      \
+    DIRECT(psa_status_t, cipher_decrypt, (psa_key_id_t key, psa_algorithm_t alg,         \
+                                          const uint8_t *input, size_t input_length,     \
+                                          uint8_t *output, size_t output_size,           \
+                                          size_t *output_length),                        \
+           CIPHER_DECRYPT, STATUS, (key, alg, input, input_length, output, output_size,  \
+                                    output_length))                                      \
+    WRAPPED(psa_cipher_operation_t, cipher_operation_init, (void),                       \
+            CIPHER_OPERATION_INIT, NONE, ())                                             \
+    DIRECT(psa_status_t, cipher_encrypt_setup, (psa_cipher_operation_t *operation,       \
+                                                psa_key_id_t key, psa_algorithm_t alg),  \
+           CIPHER_ENCRYPT_SETUP, STATUS, (operation, key, alg))                          \
+    DIRECT(psa_status_t, cipher_decrypt_setup, (psa_cipher_operation_t *operation,       \
+                                                psa_key_id_t key, psa_algorithm_t alg),  \
+           CIPHER_DECRYPT_SETUP, STATUS, (operation, key, alg))                          \
+    DIRECT(psa_status_t, cipher_generate_iv, (psa_cipher_operation_t *operation,         \
+                                              uint8_t *iv, size_t iv_size,               \
+                                              size_t *iv_length),                        \
+           CIPHER_GENERATE_IV, STATUS, (operation, iv, iv_size, iv_length))              \
+    DIRECT(psa_status_t, cipher_set_iv, (psa_cipher_operation_t *operation,              \
+                                         const uint8_t *iv, size_t iv_length),           \
+           CIPHER_SET_IV, STATUS, (operation, iv, iv_length))                            \
+    DIRECT(psa_status_t, cipher_update, (psa_cipher_operation_t *operation,              \
+                                         const uint8_t *input, size_t input_length,      \
+                                         uint8_t *output, size_t output_size,            \
+                                         size_t *output_length),                         \
+           CIPHER_UPDATE, STATUS, (operation, input, input_length, output, output_size,  \
+                                   output_length))                                       \
+    DIRECT(psa_status_t, cipher_finish, (psa_cipher_operation_t *operation,              \
+                                         uint8_t *output, size_t output_size,            \
+                                         size_t *output_length),                         \
+           CIPHER_FINISH, STATUS, (operation, output, output_size, output_length))       \
+    DIRECT(psa_status_t, cipher_abort, (psa_cipher_operation_t *operation),              \
+           CIPHER_ABORT, STATUS, (operation))                                            \
+    /* AEAD */                                                                           \
+    DIRECT(psa_status_t, aead_encrypt, (psa_key_id_t key, psa_algorithm_t alg,           \
+                                        const uint8_t *nonce, size_t nonce_length,       \
+                                        const uint8_t *additional_data,                  \
+                                        size_t additional_data_length,                   \
+                                        const uint8_t *plaintext, size_t plaintext_length, \
+                                        uint8_t *ciphertext, size_t ciphertext_size,     \
+                                        size_t *ciphertext_length),                      \
+           AEAD_ENCRYPT, STATUS, (key, alg, nonce, nonce_length, additional_data,        \
+                                  additional_data_length, plaintext, plaintext_length,   \
+                                  ciphertext, ciphertext_size, ciphertext_length))       \
+    DIRECT(psa_status_t, aead_decrypt, (psa_key_id_t key, psa_algorithm_t alg,           \
+                                        const uint8_t *nonce, size_t nonce_length,       \
+                                        const uint8_t *additional_data,                  \
+                                        size_t additional_data_length,                   \
+                                        const uint8_t *ciphertext, size_t ciphertext_length, \
+                                        uint8_t *plaintext, size_t plaintext_size,       \
+                                        size_t *plaintext_length),                       \
+           AEAD_DECRYPT, STATUS, (key, alg, nonce, nonce_length, additional_data,        \
+                                  additional_data_length, ciphertext,                    \
+                                  ciphertext_length, plaintext, plaintext_size,          \
+                                  plaintext_length))                                     \
+    WRAPPED(psa_aead_operation_t, aead_operation_init, (void),                           \
+            AEAD_OPERATION_INIT, NONE, ())                                               \
+    DIRECT(psa_status_t, aead_encrypt_setup, (psa_aead_operation_t *operation,           \
+                                              psa_key_id_t key, psa_algorithm_t alg),    \
+           AEAD_ENCRYPT_SETUP, STATUS, (operation, key, alg))                            \
+    DIRECT(psa_status_t, aead_decrypt_setup, (psa_aead_operation_t *operation,           \
+                                              psa_key_id_t key, psa_algorithm_t alg),    \
+           AEAD_DECRYPT_SETUP, STATUS, (operation, key, alg))                            \
+    DIRECT(psa_status_t, aead_generate_nonce, (psa_aead_operation_t *operation,          \
+                                               uint8_t *nonce, size_t nonce_size,        \
+                                               size_t *nonce_length),                    \
+           AEAD_GENERATE_NONCE, STATUS, (operation, nonce, nonce_size, nonce_length))    \
+    DIRECT(psa_status_t, aead_set_nonce, (psa_aead_operation_t *operation,               \
+                                          const uint8_t *nonce, size_t nonce_length),    \
+           AEAD_SET_NONCE, STATUS, (operation, nonce, nonce_length))                     \
+    DIRECT(psa_status_t, aead_set_lengths, (psa_aead_operation_t *operation,             \
+                                            size_t ad_length, size_t plaintext_length),  \
+           AEAD_SET_LENGTHS, STATUS, (operation, ad_length, plaintext_length))           \
+    DIRECT(psa_status_t, aead_update_ad, (psa_aead_operation_t *operation,               \
+                                          const uint8_t *input, size_t input_length),    \
+           AEAD_UPDATE_AD, STATUS, (operation, input, input_length))                     \
+    DIRECT(psa_status_t, aead_update, (psa_aead_operation_t *operation,                  \
+                                       const uint8_t *input, size_t input_length,        \
+                                       uint8_t *output, size_t output_size,              \
+                                       size_t *output_length),                           \
+           AEAD_UPDATE, STATUS, (operation, input, input_length, output, output_size,    \
+                                 output_length))                                         \
+    DIRECT(psa_status_t, aead_finish, (psa_aead_operation_t *operation,                  \
+                                       uint8_t *ciphertext, size_t ciphertext_size,      \
+                                       size_t *ciphertext_length, uint8_t *tag,          \
+                                       size_t tag_size, size_t *tag_length),             \
+           AEAD_FINISH, STATUS, (operation, ciphertext, ciphertext_size,                 \
+                                 ciphertext_length, tag, tag_size, tag_length))          \
+    DIRECT(psa_status_t, aead_verify, (psa_aead_operation_t *operation,                  \
+                                       uint8_t *plaintext, size_t plaintext_size,        \
+                                       size_t *plaintext_length, const uint8_t *tag,     \
+                                       size_t tag_length),                               \
+           AEAD_VERIFY, STATUS, (operation, plaintext, plaintext_size,                   \
+                                 plaintext_length, tag, tag_length))                     \
+    DIRECT(psa_status_t, aead_abort, (psa_aead_operation_t *operation),                  \
+           AEAD_ABORT, STATUS, (operation))                                              \
+    /* Asymmetric */                                                                     \
+    DIRECT(psa_status_t, sign_message, (psa_key_id_t key, psa_algorithm_t alg,           \
+                                        const uint8_t *input, size_t input_length,       \
+                                        uint8_t *signature, size_t signature_size,       \
+                                        size_t *signature_length),                       \
+           SIGN_MESSAGE, STATUS, (key, alg, input, input_length, signature,              \
+                                  signature_size, signature_length))                     \
+    DIRECT(psa_status_t, verify_message, (psa_key_id_t key, psa_algorithm_t alg,         \
+                                          const uint8_t *input, size_t input_length,     \
+                                          const uint8_t *signature,                      \
+                                          size_t signature_length),                      \
+           VERIFY_MESSAGE, STATUS, (key, alg, input, input_length, signature,            \
+                                    signature_length))                                   \
+    DIRECT(psa_status_t, sign_hash, (psa_key_id_t key, psa_algorithm_t alg,              \
+                                     const uint8_t *hash, size_t hash_length,            \
+                                     uint8_t *signature, size_t signature_size,          \
+                                     size_t *signature_length),                          \
+           SIGN_HASH, STATUS, (key, alg, hash, hash_length, signature, signature_size,   \
+                               signature_length))                                        \
+    DIRECT(psa_status_t, verify_hash, (psa_key_id_t key, psa_algorithm_t alg,            \
+                                       const uint8_t *hash, size_t hash_length,          \
+                                       const uint8_t *signature, size_t signature_length), \
+           VERIFY_HASH, STATUS, (key, alg, hash, hash_length, signature,                 \
+                                 signature_length))                                      \
+    DIRECT(psa_status_t, asymmetric_encrypt, (psa_key_id_t key, psa_algorithm_t alg,     \
+                                              const uint8_t *input, size_t input_length, \
+                                              const uint8_t *salt, size_t salt_length,   \
+                                              uint8_t *output, size_t output_size,       \
+                                              size_t *output_length),                    \
+           ASYMMETRIC_ENCRYPT, STATUS, (key, alg, input, input_length, salt,             \
+                                        salt_length, output, output_size,            \
+                                        output_length))                              \
+    DIRECT(psa_status_t, asymmetric_decrypt, (psa_key_id_t key, psa_algorithm_t alg,     \
+                                              const uint8_t *input, size_t input_length, \
+                                              const uint8_t *salt, size_t salt_length,   \
+                                              uint8_t *output, size_t output_size,       \
+                                              size_t *output_length),                    \
+           ASYMMETRIC_DECRYPT, STATUS, (key, alg, input, input_length, salt,             \
+                                        salt_length, output, output_size,            \
+                                        output_length))                              \
+    /* Key derivation and key agreement */                                               \
+    WRAPPED(psa_key_derivation_operation_t, key_derivation_operation_init, (void),       \
+            KEY_DERIVATION_OPERATION_INIT, NONE, ())                                     \
+    DIRECT(psa_status_t, key_derivation_setup, (psa_key_derivation_operation_t *operation, \
+                                                psa_algorithm_t alg),                    \
+           KEY_DERIVATION_SETUP, STATUS, (operation, alg))                               \
+    DIRECT(psa_status_t, key_derivation_get_capacity,                                    \
+           (const psa_key_derivation_operation_t *operation, size_t *capacity),          \
+           KEY_DERIVATION_GET_CAPACITY, STATUS, (operation, capacity))                   \
+    DIRECT(psa_status_t, key_derivation_set_capacity,                                    \
+           (psa_key_derivation_operation_t *operation, size_t capacity),                 \
+           KEY_DERIVATION_SET_CAPACITY, STATUS, (operation, capacity))                   \
+    DIRECT(psa_status_t, key_derivation_input_bytes,                                     \
+           (psa_key_derivation_operation_t *operation, psa_key_derivation_step_t step,   \
+            const uint8_t *data, size_t data_length),                                    \
+           KEY_DERIVATION_INPUT_BYTES, STATUS, (operation, step, data, data_length))     \
+    WRAPPED(psa_status_t, key_derivation_input_integer,                                  \
+            (psa_key_derivation_operation_t *operation, psa_key_derivation_step_t step,  \
+             uint64_t value),                                                            \
+            KEY_DERIVATION_INPUT_INTEGER, STATUS, (operation, step, value))              \
+    DIRECT(psa_status_t, key_derivation_input_key,                                       \
+           (psa_key_derivation_operation_t *operation, psa_key_derivation_step_t step,   \
+            psa_key_id_t key),                                                           \
+           KEY_DERIVATION_INPUT_KEY, STATUS, (operation, step, key))                     \
+    DIRECT(psa_status_t, key_derivation_key_agreement,                                   \
+           (psa_key_derivation_operation_t *operation, psa_key_derivation_step_t step,   \
+            psa_key_id_t private_key, const uint8_t *peer_key, size_t peer_key_length),  \
+           KEY_DERIVATION_KEY_AGREEMENT, STATUS, (operation, step, private_key,          \
+                                                  peer_key, peer_key_length))            \
+    DIRECT(psa_status_t, key_derivation_output_bytes,                                    \
+           (psa_key_derivation_operation_t *operation, uint8_t *output,                  \
+            size_t output_length),                                                       \
+           KEY_DERIVATION_OUTPUT_BYTES, STATUS, (operation, output, output_length))      \
+    WRAPPED(psa_status_t, key_derivation_output_key,                                     \
+            (const psa_key_attributes_t *attributes,                                     \
+             psa_key_derivation_operation_t *operation, psa_key_id_t *key),              \
+            KEY_DERIVATION_OUTPUT_KEY, STATUS, (attributes, operation, key))             \
+    DIRECT(psa_status_t, key_derivation_verify_bytes,                                    \
+           (psa_key_derivation_operation_t *operation, const uint8_t *expected_output,   \
+            size_t output_length),                                                       \
+           KEY_DERIVATION_VERIFY_BYTES, STATUS, (operation, expected_output,             \
+                                                 output_length))                         \
+    DIRECT(psa_status_t, key_derivation_verify_key,                                      \
+           (psa_key_derivation_operation_t *operation, psa_key_id_t expected),           \
+           KEY_DERIVATION_VERIFY_KEY, STATUS, (operation, expected))                     \
+    DIRECT(psa_status_t, key_derivation_abort, (psa_key_derivation_operation_t *operation), \
+           KEY_DERIVATION_ABORT, STATUS, (operation))                                    \
+    DIRECT(psa_status_t, raw_key_agreement, (psa_algorithm_t alg, psa_key_id_t private_key, \
+                                             const uint8_t *peer_key,                    \
+                                             size_t peer_key_length, uint8_t *output,    \
+                                             size_t output_size, size_t *output_length), \
+           RAW_KEY_AGREEMENT, STATUS, (alg, private_key, peer_key, peer_key_length,      \
+                                       output, output_size, output_length))              \
+    WRAPPED(psa_status_t, key_agreement, (psa_key_id_t private_key,                      \
+                                          const uint8_t *peer_key, size_t peer_key_length, \
+                                          psa_algorithm_t alg,                           \
+                                          const psa_key_attributes_t *attributes,        \
+                                          psa_key_id_t *key),                            \
+            KEY_AGREEMENT, STATUS, (private_key, peer_key, peer_key_length, alg,         \
+                                    attributes, key))                                    \
+    /* Random generation */                                                              \
+    DIRECT(psa_status_t, generate_random, (uint8_t *output, size_t output_size),         \
+           GENERATE_RANDOM, STATUS, (output, output_size))                               \
+    /* PAKE */                                                                           \
+    WRAPPED(void, pake_cs_set_algorithm, (psa_pake_cipher_suite_t *cipher_suite,         \
+                                          psa_algorithm_t alg),                          \
+            PAKE_CS_SET_ALGORITHM, VOID, (cipher_suite, alg))                            \
+    WRAPPED(void, pake_cs_set_primitive, (psa_pake_cipher_suite_t *cipher_suite,         \
+                                          psa_pake_primitive_t primitive),               \
+            PAKE_CS_SET_PRIMITIVE, VOID, (cipher_suite, primitive))                      \
+    WRAPPED(void, pake_cs_set_key_confirmation, (psa_pake_cipher_suite_t *cipher_suite,  \
+                                                 uint32_t key_confirmation),             \
+            PAKE_CS_SET_KEY_CONFIRMATION, VOID, (cipher_suite, key_confirmation))        \
+    WRAPPED(psa_pake_operation_t, pake_operation_init, (void),                           \
+            PAKE_OPERATION_INIT, NONE, ())                                               \
+    DIRECT(psa_status_t, pake_setup, (psa_pake_operation_t *operation,                   \
+                                      psa_key_id_t password_key,                         \
+                                      const psa_pake_cipher_suite_t *cipher_suite),      \
+           PAKE_SETUP, STATUS, (operation, password_key, cipher_suite))                  \
+    DIRECT(psa_status_t, pake_set_role, (psa_pake_operation_t *operation,                \
+                                         psa_pake_role_t role),                          \
+           PAKE_SET_ROLE, STATUS, (operation, role))                                     \
+    DIRECT(psa_status_t, pake_set_user, (psa_pake_operation_t *operation,                \
+                                         const uint8_t *user_id, size_t user_id_len),    \
+           PAKE_SET_USER, STATUS, (operation, user_id, user_id_len))                     \
+    DIRECT(psa_status_t, pake_set_peer, (psa_pake_operation_t *operation,                \
+                                         const uint8_t *peer_id, size_t peer_id_len),    \
+           PAKE_SET_PEER, STATUS, (operation, peer_id, peer_id_len))                     \
+    DIRECT(psa_status_t, pake_set_context, (psa_pake_operation_t *operation,             \
+                                            const uint8_t *context, size_t context_len), \
+           PAKE_SET_CONTEXT, STATUS, (operation, context, context_len))                  \
+    DIRECT(psa_status_t, pake_output, (psa_pake_operation_t *operation,                  \
+                                       psa_pake_step_t step, uint8_t *output,            \
+                                       size_t output_size, size_t *output_length),       \
+           PAKE_OUTPUT, STATUS, (operation, step, output, output_size, output_length))   \
+    DIRECT(psa_status_t, pake_input, (psa_pake_operation_t *operation,                   \
+                                      psa_pake_step_t step, const uint8_t *input,        \
+                                      size_t input_length),                              \
+           PAKE_INPUT, STATUS, (operation, step, input, input_length))                   \
+    WRAPPED(psa_status_t, pake_get_shared_key, (psa_pake_operation_t *operation,         \
+                                                const psa_key_attributes_t *attributes,  \
+                                                psa_key_id_t *key),                      \
+            PAKE_GET_SHARED_KEY, STATUS, (operation, attributes, key))                   \
+    DIRECT(psa_status_t, pake_abort, (psa_pake_operation_t *operation),                  \
+           PAKE_ABORT, STATUS, (operation))                                              \
+    /* Interruptible operations */                                                      \
+    PAL_CRYPTO_API_INTERRUPTIBLE(DIRECT, WRAPPED)                                        \
+    PAL_CRYPTO_API_INTERRUPTIBLE_SIGN_HASH(DIRECT, WRAPPED)                              \
+    PAL_CRYPTO_API_INTERRUPTIBLE_KEY_AGREEMENT(DIRECT, WRAPPED)                          \
+    /* Test cleanup: destroys the keys created through this API */                       \
+    WRAPPED(void, free_keys, (void),                                                     \
+            FREE, VOID_NOARGS, ())
+
+#define PAL_CRYPTO_API_MEMBER(ret, name, args, code, kind, names)   ret (*name) args;
+#define PAL_CRYPTO_API_WRAPPER(ret, name, args, code, kind, names)  ret pal_crypto_##name args;
+#define PAL_CRYPTO_API_NONE(ret, name, args, code, kind, names)
+
+/* Typed crypto function table, one member per PAL_CRYPTO_API entry */
+struct pal_crypto_api_s {
+    PAL_CRYPTO_API(PAL_CRYPTO_API_MEMBER, PAL_CRYPTO_API_MEMBER)
+};
+
+/* PAL wrappers of the WRAPPED entries */
+PAL_CRYPTO_API(PAL_CRYPTO_API_NONE, PAL_CRYPTO_API_WRAPPER)
+
+/**
+ *   @brief    - Stops tracking a key created through the crypto PAL, so that it is
+ *               not destroyed by the cleanup at the end of the test
+ *   @param    - key : Key identifier
+ *   @return   - void
+**/
+void pal_crypto_untrack_key(psa_key_id_t key);
+
+#endif /* _PAL_CRYPTO_API_H_ */
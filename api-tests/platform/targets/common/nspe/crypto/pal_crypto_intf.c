@@ -17,6 +17,8 @@
 
 
 #include "pal_crypto_intf.h"
+#include "pal_crypto_api.h"
+#include "pal_trace.h"
 
 #define  PAL_KEY_SLOT_COUNT  32
 
@@ -24,6 +26,997 @@ int pal_system_reset(void);
 psa_key_id_t g_global_key_array[PAL_KEY_SLOT_COUNT];
 uint8_t g_key_count;
 
+/**
+    @brief    - Records a key created by a test, destroyed by pal_crypto_free_keys
+    @param    - key : Key identifier
+    @return   - void
+**/
+static void pal_crypto_track_key(psa_key_id_t key)
+{
+    pal_mutex_lock();
+    if (g_key_count < PAL_KEY_SLOT_COUNT)
+        g_global_key_array[g_key_count++] = key;
+    pal_mutex_unlock();
+}
+
+/* Typed wrappers, see pal_crypto_api.h. The attribute accessors and the operation
+ * initializers may be macros or static inlines in the PSA headers, they are wrapped
+ * to give them an address.
+ */
+psa_key_attributes_t pal_crypto_key_attributes_init(void)
+{
+    return psa_key_attributes_init();
+}
+
+void pal_crypto_set_key_id(psa_key_attributes_t *attributes, psa_key_id_t id)
+{
+    psa_set_key_id(attributes, id);
+}
+
+psa_key_id_t pal_crypto_get_key_id(const psa_key_attributes_t *attributes)
+{
+    return psa_get_key_id(attributes);
+}
+
+void pal_crypto_set_key_lifetime(psa_key_attributes_t *attributes, psa_key_lifetime_t lifetime)
+{
+    psa_set_key_lifetime(attributes, lifetime);
+}
+
+psa_key_lifetime_t pal_crypto_get_key_lifetime(const psa_key_attributes_t *attributes)
+{
+    return psa_get_key_lifetime(attributes);
+}
+
+void pal_crypto_set_key_usage_flags(psa_key_attributes_t *attributes, psa_key_usage_t usage_flags)
+{
+    psa_set_key_usage_flags(attributes, usage_flags);
+}
+
+psa_key_usage_t pal_crypto_get_key_usage_flags(const psa_key_attributes_t *attributes)
+{
+    return psa_get_key_usage_flags(attributes);
+}
+
+void pal_crypto_set_key_algorithm(psa_key_attributes_t *attributes, psa_algorithm_t alg)
+{
+    psa_set_key_algorithm(attributes, alg);
+}
+
+psa_algorithm_t pal_crypto_get_key_algorithm(const psa_key_attributes_t *attributes)
+{
+    return psa_get_key_algorithm(attributes);
+}
+
+void pal_crypto_set_key_type(psa_key_attributes_t *attributes, psa_key_type_t type)
+{
+    psa_set_key_type(attributes, type);
+}
+
+psa_key_type_t pal_crypto_get_key_type(const psa_key_attributes_t *attributes)
+{
+    return psa_get_key_type(attributes);
+}
+
+void pal_crypto_set_key_bits(psa_key_attributes_t *attributes, size_t bits)
+{
+    psa_set_key_bits(attributes, bits);
+}
+
+size_t pal_crypto_get_key_bits(const psa_key_attributes_t *attributes)
+{
+    return psa_get_key_bits(attributes);
+}
+
+void pal_crypto_reset_key_attributes(psa_key_attributes_t *attributes)
+{
+    psa_reset_key_attributes(attributes);
+}
+
+psa_hash_operation_t pal_crypto_hash_operation_init(void)
+{
+    return psa_hash_operation_init();
+}
+
+psa_mac_operation_t pal_crypto_mac_operation_init(void)
+{
+    return psa_mac_operation_init();
+}
+
+psa_cipher_operation_t pal_crypto_cipher_operation_init(void)
+{
+    return psa_cipher_operation_init();
+}
+
+psa_aead_operation_t pal_crypto_aead_operation_init(void)
+{
+    return psa_aead_operation_init();
+}
+
+psa_key_derivation_operation_t pal_crypto_key_derivation_operation_init(void)
+{
+    return psa_key_derivation_operation_init();
+}
+
+psa_pake_operation_t pal_crypto_pake_operation_init(void)
+{
+    return psa_pake_operation_init();
+}
+
+void pal_crypto_pake_cs_set_algorithm(psa_pake_cipher_suite_t *cipher_suite, psa_algorithm_t alg)
+{
+    psa_pake_cs_set_algorithm(cipher_suite, alg);
+}
+
+void pal_crypto_pake_cs_set_primitive(psa_pake_cipher_suite_t *cipher_suite,
+                                      psa_pake_primitive_t primitive)
+{
+    psa_pake_cs_set_primitive(cipher_suite, primitive);
+}
+
+void pal_crypto_pake_cs_set_key_confirmation(psa_pake_cipher_suite_t *cipher_suite,
+                                             uint32_t key_confirmation)
+{
+    psa_pake_cs_set_key_confirmation(cipher_suite, key_confirmation);
+}
+
+/* Optional functions, compiled out through pal_crypto_config.h */
+psa_status_t pal_crypto_hash_suspend(psa_hash_operation_t *operation, uint8_t *hash_state,
+                                     size_t hash_state_size, size_t *hash_state_length)
+{
+#ifdef ARCH_TEST_HASH_SUSPEND
+    return psa_hash_suspend(operation, hash_state, hash_state_size, hash_state_length);
+#else
+    (void)operation;
+    (void)hash_state;
+    (void)hash_state_size;
+    (void)hash_state_length;
+    return PAL_STATUS_UNSUPPORTED_FUNC;
+#endif
+}
+
+psa_status_t pal_crypto_hash_resume(psa_hash_operation_t *operation, const uint8_t *hash_state,
+                                    size_t hash_state_length)
+{
+#ifdef ARCH_TEST_HASH_RESUME
+    return psa_hash_resume(operation, hash_state, hash_state_length);
+#else
+    (void)operation;
+    (void)hash_state;
+    (void)hash_state_length;
+    return PAL_STATUS_UNSUPPORTED_FUNC;
+#endif
+}
+
+psa_status_t pal_crypto_key_derivation_input_integer(psa_key_derivation_operation_t *operation,
+                                                     psa_key_derivation_step_t step,
+                                                     uint64_t value)
+{
+#ifdef ARCH_TEST_PBKDF2
+    return psa_key_derivation_input_integer(operation, step, value);
+#else
+    (void)operation;
+    (void)step;
+    (void)value;
+    return PAL_STATUS_UNSUPPORTED_FUNC;
+#endif
+}
+
+#ifdef ARCH_TEST_INTERRUPTIBLE_SIGN_HASH
+psa_sign_hash_interruptible_operation_t pal_crypto_sign_hash_interruptible_operation_init(void)
+{
+    return psa_sign_hash_interruptible_operation_init();
+}
+
+psa_verify_hash_interruptible_operation_t pal_crypto_verify_hash_interruptible_operation_init(void)
+{
+    return psa_verify_hash_interruptible_operation_init();
+}
+#endif
+
+#ifdef ARCH_TEST_INTERRUPTIBLE_KEY_AGREEMENT
+psa_key_agreement_iop_t pal_crypto_key_agreement_iop_init(void)
+{
+    return psa_key_agreement_iop_init();
+}
+#endif
+
+/* Key creation and destruction, keeping track of the keys of the test */
+psa_status_t pal_crypto_import_key(const psa_key_attributes_t *attributes, const uint8_t *data,
+                                   size_t data_length, psa_key_id_t *key)
+{
+    psa_status_t status = psa_import_key(attributes, data, data_length, key);
+
+    if (status == PSA_SUCCESS)
+        pal_crypto_track_key(*key);
+    return status;
+}
+
+psa_status_t pal_crypto_generate_key(const psa_key_attributes_t *attributes, psa_key_id_t *key)
+{
+    psa_status_t status = psa_generate_key(attributes, key);
+
+    if (status == PSA_SUCCESS)
+        pal_crypto_track_key(*key);
+    return status;
+}
+
+psa_status_t pal_crypto_copy_key(psa_key_id_t source_key, const psa_key_attributes_t *attributes,
+                                 psa_key_id_t *target_key)
+{
+    psa_status_t status = psa_copy_key(source_key, attributes, target_key);
+
+    if (status == PSA_SUCCESS)
+        pal_crypto_track_key(*target_key);
+    return status;
+}
+
+psa_status_t pal_crypto_key_derivation_output_key(const psa_key_attributes_t *attributes,
+                                                  psa_key_derivation_operation_t *operation,
+                                                  psa_key_id_t *key)
+{
+    psa_status_t status = psa_key_derivation_output_key(attributes, operation, key);
+
+    if (status == PSA_SUCCESS)
+        pal_crypto_track_key(*key);
+    return status;
+}
+
+psa_status_t pal_crypto_key_agreement(psa_key_id_t private_key, const uint8_t *peer_key,
+                                      size_t peer_key_length, psa_algorithm_t alg,
+                                      const psa_key_attributes_t *attributes, psa_key_id_t *key)
+{
+    psa_status_t status = psa_key_agreement(private_key, peer_key, peer_key_length, alg,
+                                            attributes, key);
+
+    if (status == PSA_SUCCESS)
+        pal_crypto_track_key(*key);
+    return status;
+}
+
+psa_status_t pal_crypto_pake_get_shared_key(psa_pake_operation_t *operation,
+                                            const psa_key_attributes_t *attributes,
+                                            psa_key_id_t *key)
+{
+    psa_status_t status = psa_pake_get_shared_key(operation, attributes, key);
+
+    if (status == PSA_SUCCESS)
+        pal_crypto_track_key(*key);
+    return status;
+}
+
+#ifdef ARCH_TEST_INTERRUPTIBLE_KEY_AGREEMENT
+psa_status_t pal_crypto_key_agreement_iop_complete(psa_key_agreement_iop_t *operation,
+                                                   psa_key_id_t *key)
+{
+    psa_status_t status = psa_key_agreement_iop_complete(operation, key);
+
+    if (status == PSA_SUCCESS)
+        pal_crypto_track_key(*key);
+    return status;
+}
+#endif
+
+void pal_crypto_untrack_key(psa_key_id_t key)
+{
+    pal_mutex_lock();
+    for (int i = 0; i < g_key_count; i++) {
+        if (g_global_key_array[i] == key) {
+            g_key_count--;
+            g_global_key_array[i] = g_global_key_array[g_key_count];
+            g_global_key_array[g_key_count] = 0;
+            break;
+        }
+    }
+    pal_mutex_unlock();
+}
+
+psa_status_t pal_crypto_destroy_key(psa_key_id_t key)
+{
+    psa_status_t status = psa_destroy_key(key);
+
+    pal_crypto_untrack_key(key);
+    return status;
+}
+
+void pal_crypto_free_keys(void)
+{
+    for (int i = 0; i < g_key_count; i++) {
+        psa_destroy_key(g_global_key_array[i]);
+        g_global_key_array[i] = (psa_key_id_t)0;
+    }
+    g_key_count = 0;
+}
+
+/* Names of the PSA functions, indexed by function code */
+static const char *const g_crypto_function_names[] = {
+    [PAL_CRYPTO_AEAD_ABORT]                    = "psa_aead_abort",
+    [PAL_CRYPTO_AEAD_DECRYPT]                  = "psa_aead_decrypt",
+    [PAL_CRYPTO_AEAD_DECRYPT_SETUP]            = "psa_aead_decrypt_setup",
+    [PAL_CRYPTO_AEAD_ENCRYPT]                  = "psa_aead_encrypt",
+    [PAL_CRYPTO_AEAD_ENCRYPT_SETUP]            = "psa_aead_encrypt_setup",
+    [PAL_CRYPTO_AEAD_FINISH]                   = "psa_aead_finish",
+    [PAL_CRYPTO_AEAD_GENERATE_NONCE]           = "psa_aead_generate_nonce",
+    [PAL_CRYPTO_AEAD_OPERATION_INIT]           = "psa_aead_operation_init",
+    [PAL_CRYPTO_AEAD_SET_LENGTHS]              = "psa_aead_set_lengths",
+    [PAL_CRYPTO_AEAD_SET_NONCE]                = "psa_aead_set_nonce",
+    [PAL_CRYPTO_AEAD_UPDATE]                   = "psa_aead_update",
+    [PAL_CRYPTO_AEAD_UPDATE_AD]                = "psa_aead_update_ad",
+    [PAL_CRYPTO_AEAD_VERIFY]                   = "psa_aead_verify",
+    [PAL_CRYPTO_ASYMMETRIC_DECRYPT]            = "psa_asymmetric_decrypt",
+    [PAL_CRYPTO_ASYMMETRIC_ENCRYPT]            = "psa_asymmetric_encrypt",
+    [PAL_CRYPTO_CIPHER_ABORT]                  = "psa_cipher_abort",
+    [PAL_CRYPTO_CIPHER_DECRYPT]                = "psa_cipher_decrypt",
+    [PAL_CRYPTO_CIPHER_DECRYPT_SETUP]          = "psa_cipher_decrypt_setup",
+    [PAL_CRYPTO_CIPHER_ENCRYPT]                = "psa_cipher_encrypt",
+    [PAL_CRYPTO_CIPHER_ENCRYPT_SETUP]          = "psa_cipher_encrypt_setup",
+    [PAL_CRYPTO_CIPHER_FINISH]                 = "psa_cipher_finish",
+    [PAL_CRYPTO_CIPHER_GENERATE_IV]            = "psa_cipher_generate_iv",
+    [PAL_CRYPTO_CIPHER_OPERATION_INIT]         = "psa_cipher_operation_init",
+    [PAL_CRYPTO_CIPHER_SET_IV]                 = "psa_cipher_set_iv",
+    [PAL_CRYPTO_CIPHER_UPDATE]                 = "psa_cipher_update",
+    [PAL_CRYPTO_COPY_KEY]                      = "psa_copy_key",
+    [PAL_CRYPTO_INIT]                          = "psa_crypto_init",
+    [PAL_CRYPTO_DESTROY_KEY]                   = "psa_destroy_key",
+    [PAL_CRYPTO_EXPORT_KEY]                    = "psa_export_key",
+    [PAL_CRYPTO_EXPORT_PUBLIC_KEY]             = "psa_export_public_key",
+    [PAL_CRYPTO_GENERATE_KEY]                  = "psa_generate_key",
+    [PAL_CRYPTO_GENERATE_RANDOM]               = "psa_generate_random",
+    [PAL_CRYPTO_GET_KEY_ALGORITHM]             = "psa_get_key_algorithm",
+    [PAL_CRYPTO_GET_KEY_ATTRIBUTES]            = "psa_get_key_attributes",
+    [PAL_CRYPTO_GET_KEY_BITS]                  = "psa_get_key_bits",
+    [PAL_CRYPTO_GET_KEY_ID]                    = "psa_get_key_id",
+    [PAL_CRYPTO_GET_KEY_LIFETIME]              = "psa_get_key_lifetime",
+    [PAL_CRYPTO_GET_KEY_TYPE]                  = "psa_get_key_type",
+    [PAL_CRYPTO_GET_KEY_USAGE_FLAGS]           = "psa_get_key_usage_flags",
+    [PAL_CRYPTO_HASH_ABORT]                    = "psa_hash_abort",
+    [PAL_CRYPTO_HASH_CLONE]                    = "psa_hash_clone",
+    [PAL_CRYPTO_HASH_COMPARE]                  = "psa_hash_compare",
+    [PAL_CRYPTO_HASH_COMPUTE]                  = "psa_hash_compute",
+    [PAL_CRYPTO_HASH_FINISH]                   = "psa_hash_finish",
+    [PAL_CRYPTO_HASH_OPERATION_INIT]           = "psa_hash_operation_init",
+    [PAL_CRYPTO_HASH_RESUME]                   = "psa_hash_resume",
+    [PAL_CRYPTO_HASH_SETUP]                    = "psa_hash_setup",
+    [PAL_CRYPTO_HASH_SUSPEND]                  = "psa_hash_suspend",
+    [PAL_CRYPTO_HASH_UPDATE]                   = "psa_hash_update",
+    [PAL_CRYPTO_HASH_VERIFY]                   = "psa_hash_verify",
+    [PAL_CRYPTO_IMPORT_KEY]                    = "psa_import_key",
+    [PAL_CRYPTO_KEY_ATTRIBUTES_INIT]           = "psa_key_attributes_init",
+    [PAL_CRYPTO_KEY_DERIVATION_ABORT]          = "psa_key_derivation_abort",
+    [PAL_CRYPTO_KEY_DERIVATION_GET_CAPACITY]   = "psa_key_derivation_get_capacity",
+    [PAL_CRYPTO_KEY_DERIVATION_INPUT_BYTES]    = "psa_key_derivation_input_bytes",
+    [PAL_CRYPTO_KEY_DERIVATION_INPUT_INTEGER]  = "psa_key_derivation_input_integer",
+    [PAL_CRYPTO_KEY_DERIVATION_INPUT_KEY]      = "psa_key_derivation_input_key",
+    [PAL_CRYPTO_KEY_DERIVATION_KEY_AGREEMENT]  = "psa_key_derivation_key_agreement",
+    [PAL_CRYPTO_KEY_DERIVATION_OPERATION_INIT] = "psa_key_derivation_operation_init",
+    [PAL_CRYPTO_KEY_DERIVATION_OUTPUT_BYTES]   = "psa_key_derivation_output_bytes",
+    [PAL_CRYPTO_KEY_DERIVATION_OUTPUT_KEY]     = "psa_key_derivation_output_key",
+    [PAL_CRYPTO_KEY_DERIVATION_VERIFY_BYTES]   = "psa_key_derivation_verify_bytes",
+    [PAL_CRYPTO_KEY_DERIVATION_VERIFY_KEY]     = "psa_key_derivation_verify_key",
+    [PAL_CRYPTO_KEY_DERIVATION_SET_CAPACITY]   = "psa_key_derivation_set_capacity",
+    [PAL_CRYPTO_KEY_DERIVATION_SETUP]          = "psa_key_derivation_setup",
+    [PAL_CRYPTO_MAC_ABORT]                     = "psa_mac_abort",
+    [PAL_CRYPTO_MAC_COMPUTE]                   = "psa_mac_compute",
+    [PAL_CRYPTO_MAC_OPERATION_INIT]            = "psa_mac_operation_init",
+    [PAL_CRYPTO_MAC_SIGN_FINISH]               = "psa_mac_sign_finish",
+    [PAL_CRYPTO_MAC_SIGN_SETUP]                = "psa_mac_sign_setup",
+    [PAL_CRYPTO_MAC_UPDATE]                    = "psa_mac_update",
+    [PAL_CRYPTO_MAC_VERIFY]                    = "psa_mac_verify",
+    [PAL_CRYPTO_MAC_VERIFY_FINISH]             = "psa_mac_verify_finish",
+    [PAL_CRYPTO_MAC_VERIFY_SETUP]              = "psa_mac_verify_setup",
+    [PAL_CRYPTO_PURGE_KEY]                     = "psa_purge_key",
+    [PAL_CRYPTO_RAW_KEY_AGREEMENT]             = "psa_raw_key_agreement",
+    [PAL_CRYPTO_KEY_AGREEMENT]                 = "psa_key_agreement",
+    [PAL_CRYPTO_RESET_KEY_ATTRIBUTES]          = "psa_reset_key_attributes",
+    [PAL_CRYPTO_SET_KEY_ALGORITHM]             = "psa_set_key_algorithm",
+    [PAL_CRYPTO_SET_KEY_BITS]                  = "psa_set_key_bits",
+    [PAL_CRYPTO_SET_KEY_ID]                    = "psa_set_key_id",
+    [PAL_CRYPTO_SET_KEY_LIFETIME]              = "psa_set_key_lifetime",
+    [PAL_CRYPTO_SET_KEY_TYPE]                  = "psa_set_key_type",
+    [PAL_CRYPTO_SET_KEY_USAGE_FLAGS]           = "psa_set_key_usage_flags",
+    [PAL_CRYPTO_SIGN_HASH]                     = "psa_sign_hash",
+    [PAL_CRYPTO_SIGN_MESSAGE]                  = "psa_sign_message",
+    [PAL_CRYPTO_VERIFY_HASH]                   = "psa_verify_hash",
+    [PAL_CRYPTO_VERIFY_MESSAGE]                = "psa_verify_message",
+    [PAL_CRYPTO_PAKE_OPERATION_INIT]           = "psa_pake_operation_init",
+    [PAL_CRYPTO_PAKE_CS_SET_ALGORITHM]         = "psa_pake_cs_set_algorithm",
+    [PAL_CRYPTO_PAKE_CS_SET_PRIMITIVE]         = "psa_pake_cs_set_primitive",
+    [PAL_CRYPTO_PAKE_CS_SET_KEY_CONFIRMATION]  = "psa_pake_cs_set_key_confirmation",
+    [PAL_CRYPTO_PAKE_SETUP]                    = "psa_pake_setup",
+    [PAL_CRYPTO_PAKE_SET_ROLE]                 = "psa_pake_set_role",
+    [PAL_CRYPTO_PAKE_SET_USER]                 = "psa_pake_set_user",
+    [PAL_CRYPTO_PAKE_SET_PEER]                 = "psa_pake_set_peer",
+    [PAL_CRYPTO_PAKE_SET_CONTEXT]              = "psa_pake_set_context",
+    [PAL_CRYPTO_PAKE_OUTPUT]                   = "psa_pake_output",
+    [PAL_CRYPTO_PAKE_INPUT]                    = "psa_pake_input",
+    [PAL_CRYPTO_PAKE_GET_SHARED_KEY]           = "psa_pake_get_shared_key",
+    [PAL_CRYPTO_PAKE_ABORT]                    = "psa_pake_abort",
+    [PAL_CRYPTO_INTERRUPTIBLE_GET_MAX_OPS]     = "psa_interruptible_get_max_ops",
+    [PAL_CRYPTO_INTERRUPTIBLE_SET_MAX_OPS]     = "psa_interruptible_set_max_ops",
+    [PAL_CRYPTO_SIGN_HASH_INTERRUPTIBLE_OPERATION_INIT] = "psa_sign_hash_interruptible_operation_init",
+    [PAL_CRYPTO_SIGN_HASH_START]               = "psa_sign_hash_start",
+    [PAL_CRYPTO_SIGN_HASH_COMPLETE]            = "psa_sign_hash_complete",
+    [PAL_CRYPTO_SIGN_HASH_GET_NUM_OPS]         = "psa_sign_hash_get_num_ops",
+    [PAL_CRYPTO_SIGN_HASH_ABORT]               = "psa_sign_hash_abort",
+    [PAL_CRYPTO_VERIFY_HASH_INTERRUPTIBLE_OPERATION_INIT] = "psa_verify_hash_interruptible_operation_init",
+    [PAL_CRYPTO_VERIFY_HASH_START]             = "psa_verify_hash_start",
+    [PAL_CRYPTO_VERIFY_HASH_COMPLETE]          = "psa_verify_hash_complete",
+    [PAL_CRYPTO_VERIFY_HASH_GET_NUM_OPS]       = "psa_verify_hash_get_num_ops",
+    [PAL_CRYPTO_VERIFY_HASH_ABORT]             = "psa_verify_hash_abort",
+    [PAL_CRYPTO_KEY_AGREEMENT_IOP_INIT]        = "psa_key_agreement_iop_init",
+    [PAL_CRYPTO_KEY_AGREEMENT_IOP_SETUP]       = "psa_key_agreement_iop_setup",
+    [PAL_CRYPTO_KEY_AGREEMENT_IOP_COMPLETE]    = "psa_key_agreement_iop_complete",
+    [PAL_CRYPTO_KEY_AGREEMENT_IOP_GET_NUM_OPS] = "psa_key_agreement_iop_get_num_ops",
+    [PAL_CRYPTO_KEY_AGREEMENT_IOP_ABORT]       = "psa_key_agreement_iop_abort",
+};
+
+/**
+    @brief    - Returns the name of the PSA function of a crypto function code
+    @param    - type : function code
+    @return   - Name, NULL for an unknown code
+**/
+const char *pal_crypto_function_name(int type)
+{
+    if (type <= 0 || type >= (int)(sizeof(g_crypto_function_names) / sizeof(char *)))
+        return NULL;
+
+    return g_crypto_function_names[type];
+}
+
+/* Arguments of the crypto functions, for the trace of the PSA calls, see pal_trace.h */
+static const char *const g_crypto_trace_schemas[] = {
+    [PAL_CRYPTO_AEAD_ABORT]                      = "E",
+    [PAL_CRYPTO_AEAD_DECRYPT]                    = "kviiio",
+    [PAL_CRYPTO_AEAD_DECRYPT_SETUP]              = "Ekv",
+    [PAL_CRYPTO_AEAD_ENCRYPT]                    = "kviiio",
+    [PAL_CRYPTO_AEAD_ENCRYPT_SETUP]              = "Ekv",
+    [PAL_CRYPTO_AEAD_FINISH]                     = "Eoo",
+    [PAL_CRYPTO_AEAD_GENERATE_NONCE]             = "Eo",
+    [PAL_CRYPTO_AEAD_OPERATION_INIT]             = "E",
+    [PAL_CRYPTO_AEAD_SET_LENGTHS]                = "Ezz",
+    [PAL_CRYPTO_AEAD_SET_NONCE]                  = "Ei",
+    [PAL_CRYPTO_AEAD_UPDATE]                     = "Eio",
+    [PAL_CRYPTO_AEAD_UPDATE_AD]                  = "Ei",
+    [PAL_CRYPTO_AEAD_VERIFY]                     = "Eoi",
+    [PAL_CRYPTO_ASYMMETRIC_DECRYPT]              = "kviio",
+    [PAL_CRYPTO_ASYMMETRIC_ENCRYPT]              = "kviio",
+    [PAL_CRYPTO_CIPHER_ABORT]                    = "C",
+    [PAL_CRYPTO_CIPHER_DECRYPT]                  = "kvio",
+    [PAL_CRYPTO_CIPHER_DECRYPT_SETUP]            = "Ckv",
+    [PAL_CRYPTO_CIPHER_ENCRYPT]                  = "kvio",
+    [PAL_CRYPTO_CIPHER_ENCRYPT_SETUP]            = "Ckv",
+    [PAL_CRYPTO_CIPHER_FINISH]                   = "Co",
+    [PAL_CRYPTO_CIPHER_GENERATE_IV]              = "Co",
+    [PAL_CRYPTO_CIPHER_OPERATION_INIT]           = "C",
+    [PAL_CRYPTO_CIPHER_SET_IV]                   = "Ci",
+    [PAL_CRYPTO_CIPHER_UPDATE]                   = "Cio",
+    [PAL_CRYPTO_COPY_KEY]                        = "kTK",
+    [PAL_CRYPTO_INIT]                            = "",
+    [PAL_CRYPTO_DESTROY_KEY]                     = "k",
+    [PAL_CRYPTO_EXPORT_KEY]                      = "ko",
+    [PAL_CRYPTO_EXPORT_PUBLIC_KEY]               = "ko",
+    [PAL_CRYPTO_GENERATE_KEY]                    = "TK",
+    [PAL_CRYPTO_GENERATE_RANDOM]                 = "b",
+    [PAL_CRYPTO_GET_KEY_ALGORITHM]               = "TV",
+    [PAL_CRYPTO_GET_KEY_ATTRIBUTES]              = "kT",
+    [PAL_CRYPTO_GET_KEY_BITS]                    = "TZ",
+    [PAL_CRYPTO_GET_KEY_ID]                      = "TK",
+    [PAL_CRYPTO_GET_KEY_LIFETIME]                = "TV",
+    [PAL_CRYPTO_GET_KEY_TYPE]                    = "TW",
+    [PAL_CRYPTO_GET_KEY_USAGE_FLAGS]             = "TV",
+    [PAL_CRYPTO_HASH_ABORT]                      = "H",
+    [PAL_CRYPTO_HASH_CLONE]                      = "HH",
+    [PAL_CRYPTO_HASH_COMPARE]                    = "vii",
+    [PAL_CRYPTO_HASH_COMPUTE]                    = "vio",
+    [PAL_CRYPTO_HASH_FINISH]                     = "Ho",
+    [PAL_CRYPTO_HASH_OPERATION_INIT]             = "H",
+    [PAL_CRYPTO_HASH_RESUME]                     = "Hi",
+    [PAL_CRYPTO_HASH_SETUP]                      = "Hv",
+    [PAL_CRYPTO_HASH_SUSPEND]                    = "Ho",
+    [PAL_CRYPTO_HASH_UPDATE]                     = "Hi",
+    [PAL_CRYPTO_HASH_VERIFY]                     = "Hi",
+    [PAL_CRYPTO_IMPORT_KEY]                      = "TiK",
+    [PAL_CRYPTO_KEY_ATTRIBUTES_INIT]             = "T",
+    [PAL_CRYPTO_KEY_DERIVATION_ABORT]            = "D",
+    [PAL_CRYPTO_KEY_DERIVATION_GET_CAPACITY]     = "DZ",
+    [PAL_CRYPTO_KEY_DERIVATION_INPUT_BYTES]      = "Dvi",
+    [PAL_CRYPTO_KEY_DERIVATION_INPUT_INTEGER]    = "Dvq",
+    [PAL_CRYPTO_KEY_DERIVATION_INPUT_KEY]        = "Dvk",
+    [PAL_CRYPTO_KEY_DERIVATION_KEY_AGREEMENT]    = "Dvki",
+    [PAL_CRYPTO_KEY_DERIVATION_OPERATION_INIT]   = "D",
+    [PAL_CRYPTO_KEY_DERIVATION_OUTPUT_BYTES]     = "Db",
+    [PAL_CRYPTO_KEY_DERIVATION_OUTPUT_KEY]       = "TDK",
+    [PAL_CRYPTO_KEY_DERIVATION_VERIFY_BYTES]     = "Di",
+    [PAL_CRYPTO_KEY_DERIVATION_VERIFY_KEY]       = "Dk",
+    [PAL_CRYPTO_KEY_DERIVATION_SET_CAPACITY]     = "Dz",
+    [PAL_CRYPTO_KEY_DERIVATION_SETUP]            = "Dv",
+    [PAL_CRYPTO_MAC_ABORT]                       = "M",
+    [PAL_CRYPTO_MAC_COMPUTE]                     = "kvio",
+    [PAL_CRYPTO_MAC_OPERATION_INIT]              = "M",
+    [PAL_CRYPTO_MAC_SIGN_FINISH]                 = "Mo",
+    [PAL_CRYPTO_MAC_SIGN_SETUP]                  = "Mkv",
+    [PAL_CRYPTO_MAC_UPDATE]                      = "Mi",
+    [PAL_CRYPTO_MAC_VERIFY]                      = "kvii",
+    [PAL_CRYPTO_MAC_VERIFY_FINISH]               = "Mi",
+    [PAL_CRYPTO_MAC_VERIFY_SETUP]                = "Mkv",
+    [PAL_CRYPTO_PURGE_KEY]                       = "k",
+    [PAL_CRYPTO_RAW_KEY_AGREEMENT]               = "vkio",
+    [PAL_CRYPTO_KEY_AGREEMENT]                   = "kivTK",
+    [PAL_CRYPTO_RESET_KEY_ATTRIBUTES]            = "T",
+    [PAL_CRYPTO_SET_KEY_ALGORITHM]               = "Tv",
+    [PAL_CRYPTO_SET_KEY_BITS]                    = "Tz",
+    [PAL_CRYPTO_SET_KEY_ID]                      = "Tv",
+    [PAL_CRYPTO_SET_KEY_LIFETIME]                = "Tv",
+    [PAL_CRYPTO_SET_KEY_TYPE]                    = "Tv",
+    [PAL_CRYPTO_SET_KEY_USAGE_FLAGS]             = "Tv",
+    [PAL_CRYPTO_SIGN_HASH]                       = "kvio",
+    [PAL_CRYPTO_SIGN_MESSAGE]                    = "kvio",
+    [PAL_CRYPTO_VERIFY_HASH]                     = "kvii",
+    [PAL_CRYPTO_VERIFY_MESSAGE]                  = "kvii",
+    [PAL_CRYPTO_PAKE_OPERATION_INIT]             = "P",
+    [PAL_CRYPTO_PAKE_CS_SET_ALGORITHM]           = "Sv",
+    [PAL_CRYPTO_PAKE_CS_SET_PRIMITIVE]           = "Sv",
+    [PAL_CRYPTO_PAKE_CS_SET_KEY_CONFIRMATION]    = "Sv",
+    [PAL_CRYPTO_PAKE_SETUP]                      = "PkS",
+    [PAL_CRYPTO_PAKE_SET_ROLE]                   = "Pv",
+    [PAL_CRYPTO_PAKE_SET_USER]                   = "Pi",
+    [PAL_CRYPTO_PAKE_SET_PEER]                   = "Pi",
+    [PAL_CRYPTO_PAKE_SET_CONTEXT]                = "Pi",
+    [PAL_CRYPTO_PAKE_OUTPUT]                     = "Pvo",
+    [PAL_CRYPTO_PAKE_INPUT]                      = "Pvi",
+    [PAL_CRYPTO_PAKE_GET_SHARED_KEY]             = "PTK",
+    [PAL_CRYPTO_PAKE_ABORT]                      = "P",
+    [PAL_CRYPTO_INTERRUPTIBLE_GET_MAX_OPS]       = "V",
+    [PAL_CRYPTO_INTERRUPTIBLE_SET_MAX_OPS]       = "v",
+    [PAL_CRYPTO_SIGN_HASH_INTERRUPTIBLE_OPERATION_INIT] = "X",
+    [PAL_CRYPTO_SIGN_HASH_START]                 = "Xkvi",
+    [PAL_CRYPTO_SIGN_HASH_COMPLETE]              = "Xo",
+    [PAL_CRYPTO_SIGN_HASH_GET_NUM_OPS]           = "XV",
+    [PAL_CRYPTO_SIGN_HASH_ABORT]                 = "X",
+    [PAL_CRYPTO_VERIFY_HASH_INTERRUPTIBLE_OPERATION_INIT] = "Y",
+    [PAL_CRYPTO_VERIFY_HASH_START]               = "Ykvii",
+    [PAL_CRYPTO_VERIFY_HASH_COMPLETE]            = "Y",
+    [PAL_CRYPTO_VERIFY_HASH_GET_NUM_OPS]         = "YV",
+    [PAL_CRYPTO_VERIFY_HASH_ABORT]               = "Y",
+    [PAL_CRYPTO_KEY_AGREEMENT_IOP_INIT]          = "A",
+    [PAL_CRYPTO_KEY_AGREEMENT_IOP_SETUP]         = "AkivT",
+    [PAL_CRYPTO_KEY_AGREEMENT_IOP_COMPLETE]      = "AK",
+    [PAL_CRYPTO_KEY_AGREEMENT_IOP_GET_NUM_OPS]   = "AV",
+    [PAL_CRYPTO_KEY_AGREEMENT_IOP_ABORT]         = "A",
+};
+
+/**
+    @brief    - Tells whether an operation, key attributes or PAKE cipher suite is in
+                its initial state, for the trace of the PSA calls
+    @param    - kind   : Kind of object in the trace schema
+                object : Object
+    @return   - 1 if the object holds its initial value, 0 otherwise
+**/
+static int pal_crypto_trace_initial(char kind, const void *object)
+{
+    psa_hash_operation_t             hash = PSA_HASH_OPERATION_INIT;
+    psa_mac_operation_t              mac = PSA_MAC_OPERATION_INIT;
+    psa_cipher_operation_t           cipher = PSA_CIPHER_OPERATION_INIT;
+    psa_aead_operation_t             aead = PSA_AEAD_OPERATION_INIT;
+    psa_key_derivation_operation_t   derivation = PSA_KEY_DERIVATION_OPERATION_INIT;
+    psa_pake_operation_t             pake = PSA_PAKE_OPERATION_INIT;
+    psa_pake_cipher_suite_t          cipher_suite = PSA_PAKE_CIPHER_SUITE_INIT;
+    psa_key_attributes_t             attributes = PSA_KEY_ATTRIBUTES_INIT;
+#ifdef ARCH_TEST_INTERRUPTIBLE_SIGN_HASH
+    psa_sign_hash_interruptible_operation_t   sign = PSA_SIGN_HASH_INTERRUPTIBLE_OPERATION_INIT;
+    psa_verify_hash_interruptible_operation_t verify =
+                                              PSA_VERIFY_HASH_INTERRUPTIBLE_OPERATION_INIT;
+#endif
+#ifdef ARCH_TEST_INTERRUPTIBLE_KEY_AGREEMENT
+    psa_key_agreement_iop_t          agreement = PSA_KEY_AGREEMENT_IOP_INIT;
+#endif
+
+    switch (kind)
+    {
+        case 'H':
+            return !memcmp(object, &hash, sizeof(hash));
+        case 'M':
+            return !memcmp(object, &mac, sizeof(mac));
+        case 'C':
+            return !memcmp(object, &cipher, sizeof(cipher));
+        case 'E':
+            return !memcmp(object, &aead, sizeof(aead));
+        case 'D':
+            return !memcmp(object, &derivation, sizeof(derivation));
+        case 'P':
+            return !memcmp(object, &pake, sizeof(pake));
+        case 'S':
+            return !memcmp(object, &cipher_suite, sizeof(cipher_suite));
+        case 'T':
+            return !memcmp(object, &attributes, sizeof(attributes));
+#ifdef ARCH_TEST_INTERRUPTIBLE_SIGN_HASH
+        case 'X':
+            return !memcmp(object, &sign, sizeof(sign));
+        case 'Y':
+            return !memcmp(object, &verify, sizeof(verify));
+#endif
+#ifdef ARCH_TEST_INTERRUPTIBLE_KEY_AGREEMENT
+        case 'A':
+            return !memcmp(object, &agreement, sizeof(agreement));
+#endif
+        default:
+            return 0;
+    }
+}
+
+/**
+    @brief    - Writes the value of an object recorded in the trace of the PSA calls: the
+                key attributes, which the typed setters change without being recorded
+    @param    - kind   : schema kind of the object
+                object : object
+                value  : returns the value, see pal_trace.h
+                size   : size of value
+    @return   - size of the value, 0 for the objects recorded by address only
+**/
+static size_t pal_crypto_trace_value(char kind, const void *object, uint8_t *value,
+                                     size_t size)
+{
+    const psa_key_attributes_t *attributes = object;
+    uint32_t                    fields[6];
+    size_t                      i;
+
+    if (kind != 'T' || size < sizeof(fields) * 4)
+        return 0;
+
+    fields[0] = psa_get_key_type(attributes);
+    fields[1] = (uint32_t)psa_get_key_bits(attributes);
+    fields[2] = psa_get_key_usage_flags(attributes);
+    fields[3] = psa_get_key_algorithm(attributes);
+    fields[4] = psa_get_key_lifetime(attributes);
+    fields[5] = psa_get_key_id(attributes);
+
+    for (i = 0; i < sizeof(fields) * 4; i++)
+        value[i] = (uint8_t)(fields[i / 4] >> (8 * (i % 4)));
+
+    return sizeof(fields) * 4;
+}
+
+/**
+    @brief    - Returns the role of a crypto function in a multi-part operation. The
+                operation context is the first argument of the functions which are not
+                PAL_CRYPTO_CALL_SINGLE.
+    @param    - type : function code
+    @return   - pal_crypto_call_role_t
+**/
+static pal_crypto_call_role_t pal_crypto_call_role(int type)
+{
+    switch (type)
+    {
+        case PAL_CRYPTO_AEAD_DECRYPT_SETUP:
+        case PAL_CRYPTO_AEAD_ENCRYPT_SETUP:
+        case PAL_CRYPTO_CIPHER_DECRYPT_SETUP:
+        case PAL_CRYPTO_CIPHER_ENCRYPT_SETUP:
+        case PAL_CRYPTO_HASH_SETUP:
+        case PAL_CRYPTO_HASH_RESUME:
+        case PAL_CRYPTO_KEY_DERIVATION_SETUP:
+        case PAL_CRYPTO_MAC_SIGN_SETUP:
+        case PAL_CRYPTO_MAC_VERIFY_SETUP:
+        case PAL_CRYPTO_PAKE_SETUP:
+        case PAL_CRYPTO_SIGN_HASH_START:
+        case PAL_CRYPTO_VERIFY_HASH_START:
+        case PAL_CRYPTO_KEY_AGREEMENT_IOP_SETUP:
+            return PAL_CRYPTO_CALL_SETUP;
+
+        case PAL_CRYPTO_AEAD_GENERATE_NONCE:
+        case PAL_CRYPTO_AEAD_SET_LENGTHS:
+        case PAL_CRYPTO_AEAD_SET_NONCE:
+        case PAL_CRYPTO_AEAD_UPDATE:
+        case PAL_CRYPTO_AEAD_UPDATE_AD:
+        case PAL_CRYPTO_CIPHER_GENERATE_IV:
+        case PAL_CRYPTO_CIPHER_SET_IV:
+        case PAL_CRYPTO_CIPHER_UPDATE:
+        case PAL_CRYPTO_HASH_UPDATE:
+        case PAL_CRYPTO_KEY_DERIVATION_GET_CAPACITY:
+        case PAL_CRYPTO_KEY_DERIVATION_INPUT_BYTES:
+        case PAL_CRYPTO_KEY_DERIVATION_INPUT_INTEGER:
+        case PAL_CRYPTO_KEY_DERIVATION_INPUT_KEY:
+        case PAL_CRYPTO_KEY_DERIVATION_KEY_AGREEMENT:
+        case PAL_CRYPTO_KEY_DERIVATION_OUTPUT_BYTES:
+        case PAL_CRYPTO_KEY_DERIVATION_VERIFY_BYTES:
+        case PAL_CRYPTO_KEY_DERIVATION_VERIFY_KEY:
+        case PAL_CRYPTO_KEY_DERIVATION_SET_CAPACITY:
+        case PAL_CRYPTO_MAC_UPDATE:
+        case PAL_CRYPTO_PAKE_SET_ROLE:
+        case PAL_CRYPTO_PAKE_SET_USER:
+        case PAL_CRYPTO_PAKE_SET_PEER:
+        case PAL_CRYPTO_PAKE_SET_CONTEXT:
+        case PAL_CRYPTO_PAKE_OUTPUT:
+        case PAL_CRYPTO_PAKE_INPUT:
+        case PAL_CRYPTO_SIGN_HASH_COMPLETE:
+        case PAL_CRYPTO_SIGN_HASH_GET_NUM_OPS:
+        case PAL_CRYPTO_VERIFY_HASH_COMPLETE:
+        case PAL_CRYPTO_VERIFY_HASH_GET_NUM_OPS:
+        case PAL_CRYPTO_KEY_AGREEMENT_IOP_COMPLETE:
+        case PAL_CRYPTO_KEY_AGREEMENT_IOP_GET_NUM_OPS:
+            return PAL_CRYPTO_CALL_STEP;
+
+        case PAL_CRYPTO_AEAD_ABORT:
+        case PAL_CRYPTO_AEAD_FINISH:
+        case PAL_CRYPTO_AEAD_VERIFY:
+        case PAL_CRYPTO_CIPHER_ABORT:
+        case PAL_CRYPTO_CIPHER_FINISH:
+        case PAL_CRYPTO_HASH_ABORT:
+        case PAL_CRYPTO_HASH_FINISH:
+        case PAL_CRYPTO_HASH_SUSPEND:
+        case PAL_CRYPTO_HASH_VERIFY:
+        case PAL_CRYPTO_KEY_DERIVATION_ABORT:
+        case PAL_CRYPTO_MAC_ABORT:
+        case PAL_CRYPTO_MAC_SIGN_FINISH:
+        case PAL_CRYPTO_MAC_VERIFY_FINISH:
+        case PAL_CRYPTO_PAKE_ABORT:
+        case PAL_CRYPTO_PAKE_GET_SHARED_KEY:
+        case PAL_CRYPTO_SIGN_HASH_ABORT:
+        case PAL_CRYPTO_VERIFY_HASH_ABORT:
+        case PAL_CRYPTO_KEY_AGREEMENT_IOP_ABORT:
+            return PAL_CRYPTO_CALL_END;
+
+        default:
+            return PAL_CRYPTO_CALL_SINGLE;
+    }
+}
+
+__attribute__((weak)) void pal_crypto_call_begin(int type, pal_crypto_call_role_t role,
+                                                 const void *operation)
+{
+    (void)type;
+    (void)role;
+    (void)operation;
+}
+
+__attribute__((weak)) void pal_crypto_call_end(int type)
+{
+    (void)type;
+}
+
+__attribute__((weak)) const pal_crypto_alloc_profile_t *pal_crypto_alloc_profile(void)
+{
+    return NULL;
+}
+
+/* Set when the crypto calls are traced or their allocations profiled. The calls are
+ * bracketed with the hooks and recorded only then, the others go straight to the PSA
+ * implementation. Computed on the first call, both settings are fixed for the run.
+ */
+static int g_crypto_hooks_active = -1;
+
+/**
+    @brief    - Tells whether the crypto calls are traced or profiled
+    @param    - void
+    @return   - 1 if the calls go through the hooks and the trace, 0 otherwise
+**/
+static int pal_crypto_hooks_active(void)
+{
+    if (g_crypto_hooks_active < 0)
+        g_crypto_hooks_active = pal_trace_enabled() || (pal_crypto_alloc_profile() != NULL);
+
+    return g_crypto_hooks_active;
+}
+
+/**
+    @brief    - Starts a call of a crypto function, made through pal_crypto_function or
+                through the pal_crypto_api table: runs the pal_crypto_call_begin hook and
+                records the inputs of the call in the trace of the PSA calls
+    @param    - trace  : Returns the call being recorded
+                type   : function code
+                valist : arguments of the function
+    @return   - void
+**/
+static void pal_crypto_record_vbegin(pal_trace_call_t *trace, int type, va_list valist)
+{
+    pal_crypto_call_role_t  role = pal_crypto_call_role(type);
+    const void             *operation = NULL;
+    const char             *name = pal_crypto_function_name(type);
+    const char             *schema = NULL;
+    va_list                 args;
+
+    if (role != PAL_CRYPTO_CALL_SINGLE)
+    {
+        va_copy(args, valist);
+        operation = va_arg(args, const void *);
+        va_end(args);
+    }
+
+    /* The end of a test is recorded, the keys it created are destroyed */
+    if (type == PAL_CRYPTO_FREE)
+    {
+        name   = "pal_crypto_free_keys";
+        schema = "";
+    }
+    else if (type > 0 && type < (int)(sizeof(g_crypto_trace_schemas) / sizeof(char *)))
+        schema = g_crypto_trace_schemas[type];
+
+    pal_crypto_call_begin(type, role, operation);
+    pal_trace_begin(trace, PAL_TRACE_CRYPTO, type, name, schema, valist,
+                    pal_crypto_trace_initial, pal_crypto_trace_value);
+}
+
+/**
+    @brief    - Ends a call of a crypto function started by pal_crypto_record_vbegin
+    @param    - trace  : Call being recorded
+                type   : function code
+                status : status returned by the function
+                valist : arguments of the function, as given to pal_crypto_record_vbegin
+    @return   - void
+**/
+static void pal_crypto_record_vend(pal_trace_call_t *trace, int type, int32_t status,
+                                   va_list valist)
+{
+    pal_trace_end(trace, status, valist);
+    pal_crypto_call_end(type);
+}
+
+/**
+    @brief    - Starts a call of a crypto function made through the pal_crypto_api table
+    @param    - trace : Returns the call being recorded
+                type  : function code
+                ...   : arguments of the function, in the order of its trace schema
+    @return   - void
+**/
+static void pal_crypto_record_begin(pal_trace_call_t *trace, int type, ...)
+{
+    va_list valist;
+
+    va_start(valist, type);
+    pal_crypto_record_vbegin(trace, type, valist);
+    va_end(valist);
+}
+
+/**
+    @brief    - Ends a call of a crypto function started by pal_crypto_record_begin
+    @param    - trace  : Call being recorded
+                type   : function code
+                status : status returned by the function
+                ...    : arguments of the function, as given to pal_crypto_record_begin
+    @return   - void
+**/
+static void pal_crypto_record_end(pal_trace_call_t *trace, int type, int32_t status, ...)
+{
+    va_list valist;
+
+    va_start(valist, status);
+    pal_crypto_record_vend(trace, type, status, valist);
+    va_end(valist);
+}
+
+/* Entries of the pal_crypto_api table. While the calls are traced or profiled, each one
+ * brackets the call with the hooks of the crypto functions and records it in the trace
+ * of the PSA calls, as pal_crypto_function does, see the kinds in pal_crypto_api.h.
+ * Otherwise the call goes straight to the function. The value returned by a VALUE
+ * function is recorded as its last output, the status of the functions which do not
+ * return one is 0.
+ */
+#define PAL_CRYPTO_API_UNPACK(...)  __VA_ARGS__
+
+#define PAL_CRYPTO_ENTRY_STATUS(ret, fn, name, args, code, names)                        \
+    static ret pal_crypto_entry_##name args                                              \
+    {                                                                                    \
+        pal_trace_call_t trace;                                                          \
+        ret status;                                                                      \
+                                                                                         \
+        if (!pal_crypto_hooks_active())                                                  \
+            return fn names;                                                             \
+                                                                                         \
+        pal_crypto_record_begin(&trace, code, PAL_CRYPTO_API_UNPACK names);              \
+        status = fn names;                                                               \
+        pal_crypto_record_end(&trace, code, status, PAL_CRYPTO_API_UNPACK names);        \
+        return status;                                                                   \
+    }
+
+#define PAL_CRYPTO_ENTRY_VOID(ret, fn, name, args, code, names)                          \
+    static ret pal_crypto_entry_##name args                                              \
+    {                                                                                    \
+        pal_trace_call_t trace;                                                          \
+                                                                                         \
+        if (!pal_crypto_hooks_active())                                                  \
+        {                                                                                \
+            fn names;                                                                    \
+            return;                                                                      \
+        }                                                                                \
+                                                                                         \
+        pal_crypto_record_begin(&trace, code, PAL_CRYPTO_API_UNPACK names);              \
+        fn names;                                                                        \
+        pal_crypto_record_end(&trace, code, 0, PAL_CRYPTO_API_UNPACK names);             \
+    }
+
+#define PAL_CRYPTO_ENTRY_VALUE(ret, fn, name, args, code, names)                         \
+    static ret pal_crypto_entry_##name args                                              \
+    {                                                                                    \
+        pal_trace_call_t trace;                                                          \
+        ret result = 0;                                                                  \
+                                                                                         \
+        if (!pal_crypto_hooks_active())                                                  \
+            return fn names;                                                             \
+                                                                                         \
+        pal_crypto_record_begin(&trace, code, PAL_CRYPTO_API_UNPACK names, &result);     \
+        result = fn names;                                                               \
+        pal_crypto_record_end(&trace, code, 0, PAL_CRYPTO_API_UNPACK names, &result);    \
+        return result;                                                                   \
+    }
+
+#define PAL_CRYPTO_ENTRY_STATUS_NOARGS(ret, fn, name, args, code, names)                 \
+    static ret pal_crypto_entry_##name args                                              \
+    {                                                                                    \
+        pal_trace_call_t trace;                                                          \
+        ret status;                                                                      \
+                                                                                         \
+        if (!pal_crypto_hooks_active())                                                  \
+            return fn();                                                                 \
+                                                                                         \
+        pal_crypto_record_begin(&trace, code);                                           \
+        status = fn();                                                                   \
+        pal_crypto_record_end(&trace, code, status);                                     \
+        return status;                                                                   \
+    }
+
+#define PAL_CRYPTO_ENTRY_VOID_NOARGS(ret, fn, name, args, code, names)                   \
+    static ret pal_crypto_entry_##name args                                              \
+    {                                                                                    \
+        pal_trace_call_t trace;                                                          \
+                                                                                         \
+        if (!pal_crypto_hooks_active())                                                  \
+        {                                                                                \
+            fn();                                                                        \
+            return;                                                                      \
+        }                                                                                \
+                                                                                         \
+        pal_crypto_record_begin(&trace, code);                                           \
+        fn();                                                                            \
+        pal_crypto_record_end(&trace, code, 0);                                          \
+    }
+
+#define PAL_CRYPTO_ENTRY_VALUE_NOARGS(ret, fn, name, args, code, names)                  \
+    static ret pal_crypto_entry_##name args                                              \
+    {                                                                                    \
+        pal_trace_call_t trace;                                                          \
+        ret result = 0;                                                                  \
+                                                                                         \
+        if (!pal_crypto_hooks_active())                                                  \
+            return fn();                                                                 \
+                                                                                         \
+        pal_crypto_record_begin(&trace, code, &result);                                  \
+        result = fn();                                                                   \
+        pal_crypto_record_end(&trace, code, 0, &result);                                 \
+        return result;                                                                   \
+    }
+
+#define PAL_CRYPTO_ENTRY_NONE(ret, fn, name, args, code, names)                          \
+    static ret pal_crypto_entry_##name args                                              \
+    {                                                                                    \
+        return fn();                                                                     \
+    }
+
+#define PAL_CRYPTO_ENTRY_PLAIN_VOID(ret, fn, name, args, code, names)                    \
+    static ret pal_crypto_entry_##name args                                              \
+    {                                                                                    \
+        fn names;                                                                        \
+    }
+
+#define PAL_CRYPTO_ENTRY_PLAIN_VALUE(ret, fn, name, args, code, names)                   \
+    static ret pal_crypto_entry_##name args                                              \
+    {                                                                                    \
+        return fn names;                                                                 \
+    }
+
+#define PAL_CRYPTO_API_DIRECT(ret, name, args, code, kind, names)                        \
+    PAL_CRYPTO_ENTRY_##kind(ret, psa_##name, name, args, PAL_CRYPTO_##code, names)
+#define PAL_CRYPTO_API_WRAPPED(ret, name, args, code, kind, names)                       \
+    PAL_CRYPTO_ENTRY_##kind(ret, pal_crypto_##name, name, args, PAL_CRYPTO_##code, names)
+
+PAL_CRYPTO_API(PAL_CRYPTO_API_DIRECT, PAL_CRYPTO_API_WRAPPED)
+
+#define PAL_CRYPTO_API_TABLE(ret, name, args, code, kind, names)  .name = pal_crypto_entry_##name,
+
+const pal_crypto_api_t pal_crypto_api = {
+    PAL_CRYPTO_API(PAL_CRYPTO_API_TABLE, PAL_CRYPTO_API_TABLE)
+};
+
+static int32_t pal_crypto_dispatch(int type, va_list valist);
+
 /**
     @brief    - This API will call the requested crypto function
     @param    - type    : function code
@@ -31,6 +1024,30 @@ uint8_t g_key_count;
     @return   - error status
 **/
 int32_t pal_crypto_function(int type, va_list valist)
+{
+    pal_trace_call_t        trace;
+    va_list                 args;
+    int32_t                 status;
+
+    if (!pal_crypto_hooks_active())
+        return pal_crypto_dispatch(type, valist);
+
+    va_copy(args, valist);
+    pal_crypto_record_vbegin(&trace, type, valist);
+    status = pal_crypto_dispatch(type, valist);
+    pal_crypto_record_vend(&trace, type, status, args);
+    va_end(args);
+
+    return status;
+}
+
+/**
+    @brief    - Decodes the arguments of a crypto function and calls it
+    @param    - type    : function code
+                valist  : variable argument list
+    @return   - error status
+**/
+static int32_t pal_crypto_dispatch(int type, va_list valist)
 {
     psa_algorithm_t                           alg;
     const uint8_t                            *input, *input1;
@@ -65,7 +1082,6 @@ int32_t pal_crypto_function(int type, va_list valist)
     size_t                                    nonce_length;
     const uint8_t                            *additional_data;
     size_t                                    additional_data_length;
-    psa_status_t                              status;
     uint8_t                                  *output1;
     size_t                                   output_size1, *p_output_length1;
     psa_pake_operation_t                     *pake_operation, pake_operation_temp;
@@ -84,6 +1100,16 @@ int32_t pal_crypto_function(int type, va_list valist)
     const psa_key_attributes_t               *pake_key_attr;
     const uint8_t                            *expected_output;
     psa_key_id_t                             *derv_key;
+#ifdef ARCH_TEST_INTERRUPTIBLE_SIGN_HASH
+    psa_sign_hash_interruptible_operation_t   *sign_operation;
+    psa_verify_hash_interruptible_operation_t *verify_operation;
+#endif
+#ifdef ARCH_TEST_INTERRUPTIBLE_KEY_AGREEMENT
+    psa_key_agreement_iop_t                  *agreement_operation;
+#endif
+#if defined(ARCH_TEST_INTERRUPTIBLE_SIGN_HASH) || defined(ARCH_TEST_INTERRUPTIBLE_KEY_AGREEMENT)
+    uint32_t                                  max_ops, *p_num_ops;
+#endif
 
     switch (type)
 	{
@@ -385,29 +1411,16 @@ int32_t pal_crypto_function(int type, va_list valist)
 			key                      = va_arg(valist, psa_key_id_t);
 			c_attributes             = va_arg(valist, const psa_key_attributes_t *);
 			target_key               = va_arg(valist, psa_key_id_t *);
-			status = psa_copy_key(key,
-								c_attributes,
-								target_key);
-			if (status == PSA_SUCCESS) {
-				g_global_key_array[g_key_count++] = *target_key;
-			}
-			return status;
+			return pal_crypto_copy_key(key,
+									c_attributes,
+									target_key);
 			break;
 		case PAL_CRYPTO_INIT:
 			return psa_crypto_init();
 			break;
 		case PAL_CRYPTO_DESTROY_KEY:
 			key                      = va_arg(valist, psa_key_id_t);
-			status = psa_destroy_key(key);
-			for (int i = 0; i < g_key_count; i++) {
-				if (g_global_key_array[i] == key) {
-					g_global_key_array[i] = 0;
-					g_key_count--;
-					g_global_key_array[i] = g_global_key_array[g_key_count];
-					break;
-				}
-			}
-			return status;
+			return pal_crypto_destroy_key(key);
 			break;
 		case PAL_CRYPTO_EXPORT_KEY:
 			key                      = va_arg(valist, psa_key_id_t);
@@ -432,11 +1445,7 @@ int32_t pal_crypto_function(int type, va_list valist)
 		case PAL_CRYPTO_GENERATE_KEY:
 			c_attributes             = va_arg(valist, const psa_key_attributes_t *);
 			target_key               = va_arg(valist, psa_key_id_t *);
-			status =  psa_generate_key(c_attributes, target_key);
-			if (status == PSA_SUCCESS) {
-				g_global_key_array[g_key_count++] = *target_key;
-			}
-			return status;
+			return pal_crypto_generate_key(c_attributes, target_key);
 			break;
 		case PAL_CRYPTO_GENERATE_RANDOM:
 			output                   = va_arg(valist, uint8_t *);
@@ -592,14 +1601,10 @@ int32_t pal_crypto_function(int type, va_list valist)
 			input                    = va_arg(valist, const uint8_t *);
 			input_length             = va_arg(valist, size_t);
 			p_key                    = va_arg(valist, psa_key_id_t *);
-			status = psa_import_key(c_attributes,
+			return pal_crypto_import_key(c_attributes,
 								  input,
 								  input_length,
 								  p_key);
-			if (status == PSA_SUCCESS) {
-				g_global_key_array[g_key_count++] = *p_key;
-			}
-			return status;
 			break;
 		case PAL_CRYPTO_KEY_ATTRIBUTES_INIT:
 			attributes               = va_arg(valist, psa_key_attributes_t *);
@@ -672,12 +1677,8 @@ int32_t pal_crypto_function(int type, va_list valist)
 			c_attributes             = va_arg(valist, const psa_key_attributes_t *);
 			derivation_operation     = va_arg(valist, psa_key_derivation_operation_t *);
 			p_key                    = va_arg(valist, psa_key_id_t *);
-			status = psa_key_derivation_output_key(c_attributes,
+			return pal_crypto_key_derivation_output_key(c_attributes,
 		        derivation_operation, p_key);
-			if (status == PSA_SUCCESS) {
-				g_global_key_array[g_key_count++] = *p_key;
-			}
-			return status;
 			break;
         case PAL_CRYPTO_KEY_DERIVATION_VERIFY_BYTES:
 			derivation_operation     = va_arg(valist, psa_key_derivation_operation_t *);
@@ -813,16 +1814,12 @@ int32_t pal_crypto_function(int type, va_list valist)
 			alg                      = va_arg(valist, psa_algorithm_t);
 			c_attributes             = va_arg(valist, const psa_key_attributes_t *);
 			derv_key                 = va_arg(valist, psa_key_id_t *);
-			status = psa_key_agreement(key,
+			return pal_crypto_key_agreement(key,
 									 input,
 									 input_length,
 									 alg,
 									 c_attributes,
 									 derv_key);
-			if (status == PSA_SUCCESS) {
-				g_global_key_array[g_key_count++] = *derv_key;
-			}
-			return status;
 			break;
 		case PAL_CRYPTO_RESET_KEY_ATTRIBUTES:
 			attributes               = va_arg(valist, psa_key_attributes_t *);
@@ -1027,23 +2024,138 @@ int32_t pal_crypto_function(int type, va_list valist)
 			pake_operation = va_arg(valist, psa_pake_operation_t* );
 			pake_key_attr  = va_arg(valist, const psa_key_attributes_t* );
 			pw_key         = va_arg(valist, psa_key_id_t *);
-			status = psa_pake_get_shared_key(pake_operation,
+			return pal_crypto_pake_get_shared_key(pake_operation,
 										   pake_key_attr,
 										   pw_key);
-			if (status == PSA_SUCCESS) {
-				g_global_key_array[g_key_count++] = *pw_key;
-			}
-			return status;
 			break;
+#if defined(ARCH_TEST_INTERRUPTIBLE_SIGN_HASH) || defined(ARCH_TEST_INTERRUPTIBLE_KEY_AGREEMENT)
+        case PAL_CRYPTO_INTERRUPTIBLE_GET_MAX_OPS:
+            p_num_ops              = va_arg(valist, uint32_t *);
+            *p_num_ops             = psa_interruptible_get_max_ops();
+            return 0;
+            break;
+        case PAL_CRYPTO_INTERRUPTIBLE_SET_MAX_OPS:
+            max_ops                = va_arg(valist, uint32_t);
+            psa_interruptible_set_max_ops(max_ops);
+            return 0;
+            break;
+#endif
+#ifdef ARCH_TEST_INTERRUPTIBLE_SIGN_HASH
+        case PAL_CRYPTO_SIGN_HASH_INTERRUPTIBLE_OPERATION_INIT:
+            sign_operation         = va_arg(valist, psa_sign_hash_interruptible_operation_t *);
+            *sign_operation        = psa_sign_hash_interruptible_operation_init();
+            return 0;
+            break;
+        case PAL_CRYPTO_SIGN_HASH_START:
+            sign_operation         = va_arg(valist, psa_sign_hash_interruptible_operation_t *);
+            key                    = va_arg(valist, psa_key_id_t);
+            alg                    = va_arg(valist, psa_algorithm_t);
+            input                  = va_arg(valist, const uint8_t *);
+            input_length           = va_arg(valist, size_t);
+            return psa_sign_hash_start(sign_operation,
+                                       key,
+                                       alg,
+                                       input,
+                                       input_length);
+            break;
+        case PAL_CRYPTO_SIGN_HASH_COMPLETE:
+            sign_operation         = va_arg(valist, psa_sign_hash_interruptible_operation_t *);
+            output                 = va_arg(valist, uint8_t *);
+            output_size            = va_arg(valist, size_t);
+            p_output_length        = va_arg(valist, size_t *);
+            return psa_sign_hash_complete(sign_operation,
+                                          output,
+                                          output_size,
+                                          p_output_length);
+            break;
+        case PAL_CRYPTO_SIGN_HASH_GET_NUM_OPS:
+            sign_operation         = va_arg(valist, psa_sign_hash_interruptible_operation_t *);
+            p_num_ops              = va_arg(valist, uint32_t *);
+            *p_num_ops             = psa_sign_hash_get_num_ops(sign_operation);
+            return 0;
+            break;
+        case PAL_CRYPTO_SIGN_HASH_ABORT:
+            sign_operation         = va_arg(valist, psa_sign_hash_interruptible_operation_t *);
+            return psa_sign_hash_abort(sign_operation);
+            break;
+        case PAL_CRYPTO_VERIFY_HASH_INTERRUPTIBLE_OPERATION_INIT:
+            verify_operation       = va_arg(valist, psa_verify_hash_interruptible_operation_t *);
+            *verify_operation      = psa_verify_hash_interruptible_operation_init();
+            return 0;
+            break;
+        case PAL_CRYPTO_VERIFY_HASH_START:
+            verify_operation       = va_arg(valist, psa_verify_hash_interruptible_operation_t *);
+            key                    = va_arg(valist, psa_key_id_t);
+            alg                    = va_arg(valist, psa_algorithm_t);
+            input                  = va_arg(valist, const uint8_t *);
+            input_length           = va_arg(valist, size_t);
+            input1                 = va_arg(valist, const uint8_t *);
+            input_length1          = va_arg(valist, size_t);
+            return psa_verify_hash_start(verify_operation,
+                                         key,
+                                         alg,
+                                         input,
+                                         input_length,
+                                         input1,
+                                         input_length1);
+            break;
+        case PAL_CRYPTO_VERIFY_HASH_COMPLETE:
+            verify_operation       = va_arg(valist, psa_verify_hash_interruptible_operation_t *);
+            return psa_verify_hash_complete(verify_operation);
+            break;
+        case PAL_CRYPTO_VERIFY_HASH_GET_NUM_OPS:
+            verify_operation       = va_arg(valist, psa_verify_hash_interruptible_operation_t *);
+            p_num_ops              = va_arg(valist, uint32_t *);
+            *p_num_ops             = psa_verify_hash_get_num_ops(verify_operation);
+            return 0;
+            break;
+        case PAL_CRYPTO_VERIFY_HASH_ABORT:
+            verify_operation       = va_arg(valist, psa_verify_hash_interruptible_operation_t *);
+            return psa_verify_hash_abort(verify_operation);
+            break;
+#endif
+#ifdef ARCH_TEST_INTERRUPTIBLE_KEY_AGREEMENT
+        case PAL_CRYPTO_KEY_AGREEMENT_IOP_INIT:
+            agreement_operation    = va_arg(valist, psa_key_agreement_iop_t *);
+            *agreement_operation   = psa_key_agreement_iop_init();
+            return 0;
+            break;
+        case PAL_CRYPTO_KEY_AGREEMENT_IOP_SETUP:
+            agreement_operation    = va_arg(valist, psa_key_agreement_iop_t *);
+            key                    = va_arg(valist, psa_key_id_t);
+            input                  = va_arg(valist, const uint8_t *);
+            input_length           = va_arg(valist, size_t);
+            alg                    = va_arg(valist, psa_algorithm_t);
+            c_attributes           = va_arg(valist, const psa_key_attributes_t *);
+            return psa_key_agreement_iop_setup(agreement_operation,
+                                               key,
+                                               input,
+                                               input_length,
+                                               alg,
+                                               c_attributes);
+            break;
+        case PAL_CRYPTO_KEY_AGREEMENT_IOP_COMPLETE:
+            agreement_operation    = va_arg(valist, psa_key_agreement_iop_t *);
+            derv_key               = va_arg(valist, psa_key_id_t *);
+            return pal_crypto_key_agreement_iop_complete(agreement_operation,
+                                                         derv_key);
+            break;
+        case PAL_CRYPTO_KEY_AGREEMENT_IOP_GET_NUM_OPS:
+            agreement_operation    = va_arg(valist, psa_key_agreement_iop_t *);
+            p_num_ops              = va_arg(valist, uint32_t *);
+            *p_num_ops             = psa_key_agreement_iop_get_num_ops(agreement_operation);
+            return 0;
+            break;
+        case PAL_CRYPTO_KEY_AGREEMENT_IOP_ABORT:
+            agreement_operation    = va_arg(valist, psa_key_agreement_iop_t *);
+            return psa_key_agreement_iop_abort(agreement_operation);
+            break;
+#endif
 		case PAL_CRYPTO_RESET:
 			return pal_system_reset();
 			break;
 		case PAL_CRYPTO_FREE:
-			for (int i = 0; i < g_key_count; i++) {
-				psa_destroy_key(g_global_key_array[i]);
-				g_global_key_array[i] = (psa_key_id_t)0;
-			}
-			g_key_count = 0;
+			pal_crypto_free_keys();
 			return 0;
 			break;
 		default:
@@ -122,9 +122,54 @@ enum crypto_function_code {
     PAL_CRYPTO_PAKE_INPUT,
     PAL_CRYPTO_PAKE_GET_SHARED_KEY,
     PAL_CRYPTO_PAKE_ABORT,
+    PAL_CRYPTO_INTERRUPTIBLE_GET_MAX_OPS,
+    PAL_CRYPTO_INTERRUPTIBLE_SET_MAX_OPS,
+    PAL_CRYPTO_SIGN_HASH_INTERRUPTIBLE_OPERATION_INIT,
+    PAL_CRYPTO_SIGN_HASH_START,
+    PAL_CRYPTO_SIGN_HASH_COMPLETE,
+    PAL_CRYPTO_SIGN_HASH_GET_NUM_OPS,
+    PAL_CRYPTO_SIGN_HASH_ABORT,
+    PAL_CRYPTO_VERIFY_HASH_INTERRUPTIBLE_OPERATION_INIT,
+    PAL_CRYPTO_VERIFY_HASH_START,
+    PAL_CRYPTO_VERIFY_HASH_COMPLETE,
+    PAL_CRYPTO_VERIFY_HASH_GET_NUM_OPS,
+    PAL_CRYPTO_VERIFY_HASH_ABORT,
+    PAL_CRYPTO_KEY_AGREEMENT_IOP_INIT,
+    PAL_CRYPTO_KEY_AGREEMENT_IOP_SETUP,
+    PAL_CRYPTO_KEY_AGREEMENT_IOP_COMPLETE,
+    PAL_CRYPTO_KEY_AGREEMENT_IOP_GET_NUM_OPS,
+    PAL_CRYPTO_KEY_AGREEMENT_IOP_ABORT,
     PAL_CRYPTO_RESET                            = 0xF0,
     PAL_CRYPTO_FREE                             = 0xFE,
 };
 
+/* Role of a crypto function in the lifetime of a multi-part operation */
+typedef enum {
+    PAL_CRYPTO_CALL_SINGLE     = 0x0,  /* Not a call on a multi-part operation */
+    PAL_CRYPTO_CALL_SETUP      = 0x1,  /* Starts an operation */
+    PAL_CRYPTO_CALL_STEP       = 0x2,  /* Works on a started operation */
+    PAL_CRYPTO_CALL_END        = 0x3,  /* Ends an operation, e.g finish or abort */
+} pal_crypto_call_role_t;
+
 int32_t pal_crypto_function(int type, va_list valist);
+
+/**
+    @brief    - Called before a crypto function, by pal_crypto_function and by the
+                entries of the pal_crypto_api table, while the calls are traced or
+                pal_crypto_alloc_profile returns a profile, e.g for the allocation
+                profiler of the Linux target. No-op by default.
+    @param    - type      : function code
+                role      : role of the function in a multi-part operation
+                operation : operation context, NULL for PAL_CRYPTO_CALL_SINGLE
+    @return   - void
+**/
+void pal_crypto_call_begin(int type, pal_crypto_call_role_t role, const void *operation);
+
+/**
+    @brief    - Called after a crypto function, see pal_crypto_call_begin. No-op by
+                default.
+    @param    - type : function code
+    @return   - void
+**/
+void pal_crypto_call_end(int type);
 #endif /* _PAL_CRYPTO_INTF_H_ */
@@ -17,6 +17,20 @@
 
 
 #include "pal_attestation_intf.h"
+#include "pal_trace.h"
+
+/* Names and arguments of the functions, for the trace of the PSA calls, see pal_trace.h */
+static const char *const g_attestation_names[] = {
+    [PAL_INITIAL_ATTEST_GET_TOKEN] = "psa_initial_attest_get_token",
+    [PAL_INITIAL_ATTEST_GET_TOKEN_SIZE] = "psa_initial_attest_get_token_size",
+};
+
+static const char *const g_attestation_trace_schemas[] = {
+    [PAL_INITIAL_ATTEST_GET_TOKEN] = "io",
+    [PAL_INITIAL_ATTEST_GET_TOKEN_SIZE] = "zZ",
+};
+
+static int32_t pal_attestation_dispatch(int type, va_list valist);
 
 /**
     @brief    - This API will call the requested attestation function
@@ -25,6 +39,34 @@
     @return   - error status
 **/
 int32_t pal_attestation_function(int type, va_list valist)
+{
+    const char         *name = NULL, *schema = NULL;
+    pal_trace_call_t    trace;
+    va_list             args;
+    int32_t             status;
+
+    if (type > 0 && type < (int)(sizeof(g_attestation_names) / sizeof(char *)))
+    {
+        name   = g_attestation_names[type];
+        schema = g_attestation_trace_schemas[type];
+    }
+
+    pal_trace_begin(&trace, PAL_TRACE_ATTESTATION, type, name, schema, valist, NULL, NULL);
+    va_copy(args, valist);
+    status = pal_attestation_dispatch(type, valist);
+    pal_trace_end(&trace, status, args);
+    va_end(args);
+
+    return status;
+}
+
+/**
+    @brief    - Decodes the arguments of an attestation function and calls it
+    @param    - type    : function code
+                valist  : variable argument list
+    @return   - error status
+**/
+static int32_t pal_attestation_dispatch(int type, va_list valist)
 {
     uint8_t                *challenge, *token;
     size_t                  challenge_size, *token_size, token_buffer_size;
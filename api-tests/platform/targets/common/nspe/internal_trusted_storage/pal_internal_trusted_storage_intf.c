@@ -17,6 +17,24 @@
 
 
 #include "pal_internal_trusted_storage_intf.h"
+#include "pal_trace.h"
+
+/* Names and arguments of the functions, for the trace of the PSA calls, see pal_trace.h */
+static const char *const g_its_names[] = {
+    [PAL_ITS_SET]                = "psa_its_set",
+    [PAL_ITS_GET]                = "psa_its_get",
+    [PAL_ITS_GET_INFO]           = "psa_its_get_info",
+    [PAL_ITS_REMOVE]             = "psa_its_remove",
+};
+
+static const char *const g_its_trace_schemas[] = {
+    [PAL_ITS_SET]                = "qIv",
+    [PAL_ITS_GET]                = "qvO",
+    [PAL_ITS_GET_INFO]           = "qn",
+    [PAL_ITS_REMOVE]             = "q",
+};
+
+static int32_t pal_its_dispatch(int type, va_list valist);
 
 /**
     @brief    - This API will call the requested internal trusted storage function
@@ -25,6 +43,34 @@
     @return   - error status
 **/
 int32_t pal_its_function(int type, va_list valist)
+{
+    const char         *name = NULL, *schema = NULL;
+    pal_trace_call_t    trace;
+    va_list             args;
+    int32_t             status;
+
+    if (type > 0 && type < (int)(sizeof(g_its_names) / sizeof(char *)))
+    {
+        name   = g_its_names[type];
+        schema = g_its_trace_schemas[type];
+    }
+
+    pal_trace_begin(&trace, PAL_TRACE_ITS, type, name, schema, valist, NULL, NULL);
+    va_copy(args, valist);
+    status = pal_its_dispatch(type, valist);
+    pal_trace_end(&trace, status, args);
+    va_end(args);
+
+    return status;
+}
+
+/**
+    @brief    - Decodes the arguments of an internal trusted storage function and calls it
+    @param    - type    : function code
+                valist  : variable argument list
+    @return   - error status
+**/
+static int32_t pal_its_dispatch(int type, va_list valist)
 {
     psa_storage_uid_t           uid;
     uint32_t                    data_size, offset;
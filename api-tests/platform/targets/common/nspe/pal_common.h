@@ -40,6 +40,14 @@ typedef uint32_t            cfg_id_t;
 
 #define PAL_STATUS_UNSUPPORTED_FUNC      0xFF
 
+/* Number of pal_timestamp() ticks per micro second. The default pal_timestamp() of
+   the Armv7-M and Armv8-M Mainline cores counts core cycles, it is only used when the
+   platform gives the core clock in MHz here. */
+#ifndef PLATFORM_TIMESTAMP_TICKS_PER_US
+#define PLATFORM_TIMESTAMP_TICKS_PER_US  1
+#define PAL_TIMESTAMP_TICKS_UNKNOWN
+#endif
+
 typedef enum {
     PAL_STATUS_SUCCESS = 0x0,
     PAL_STATUS_ERROR   = 0x80
@@ -57,6 +65,33 @@ typedef struct {
     int size;
 } nvmem_param_t;
 
+typedef enum {
+    PAL_RESULT_JSONL       = 0x1,
+    PAL_RESULT_JUNIT       = 0x2,
+} pal_result_format_t;
+
+/* Body of a thread started by pal_thread_run, index is in the range [0, count) */
+typedef void (*pal_thread_fn_t)(void *arg, uint32_t index);
+
+/* Test run by pal_mem_watch_run */
+typedef void (*pal_test_fn_t)(void);
+
+/* Peak memory use of a test, measured by pal_mem_watch_run */
+typedef struct {
+    uint32_t    stack_bytes;    /* Stack used below the caller of pal_mem_watch_run */
+    uint32_t    heap_bytes;     /* Heap allocated above the use at the start of the test */
+} pal_mem_usage_t;
+
+/* Maximum number of performance counters read by pal_perf_read */
+#define PAL_PERF_MAX_COUNTERS    6
+
+/* Performance counter values, counted since pal_perf_start */
+typedef struct {
+    uint32_t    count;                          /* Number of counters read */
+    const char *name[PAL_PERF_MAX_COUNTERS];    /* Event names, e.g "cycles" */
+    uint64_t    value[PAL_PERF_MAX_COUNTERS];
+} pal_perf_counts_t;
+
 typedef enum {
     WD_INIT_SEQ         = 0x1,
     WD_ENABLE_SEQ       = 0x2,
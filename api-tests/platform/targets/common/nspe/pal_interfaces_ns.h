@@ -53,6 +53,58 @@ int pal_wd_timer_init_ns(uint32_t time_us, uint32_t timer_tick_us);
 **/
 int32_t pal_crypto_function(int type, va_list valist);
 
+/* Typed crypto function table, defined by pal_crypto_api.h */
+typedef struct pal_crypto_api_s pal_crypto_api_t;
+
+/* Calls the crypto functions directly, without the va_list decoding of
+ * pal_crypto_function. Only available in the crypto suites.
+ */
+extern const pal_crypto_api_t pal_crypto_api;
+
+/**
+ *   @brief    - Returns the name of the PSA function of a crypto function code
+ *   @param    - type : function code
+ *   @return   - Name, NULL for an unknown code
+**/
+const char *pal_crypto_function_name(int type);
+
+#define PAL_CRYPTO_ALLOC_FUNCTIONS   256
+#define PAL_CRYPTO_ALLOC_LEAKS       8
+
+/* Heap allocations made in the calls of a crypto function */
+typedef struct {
+    uint32_t    calls;
+    uint32_t    allocs;
+    uint64_t    bytes;
+    int64_t     peak;       /* Peak bytes live during a single call */
+} pal_crypto_alloc_stat_t;
+
+/* Bytes allocated and not freed by the calls on a multi-part operation */
+typedef struct {
+    int         setup;      /* Function code which started the operation */
+    int         end;        /* Function code which ended it */
+    int64_t     bytes;
+} pal_crypto_alloc_leak_t;
+
+/* Allocation profile of the crypto functions, the statistics are indexed by function code */
+typedef struct {
+    pal_crypto_alloc_stat_t test[PAL_CRYPTO_ALLOC_FUNCTIONS];
+    pal_crypto_alloc_stat_t suite[PAL_CRYPTO_ALLOC_FUNCTIONS];
+    pal_crypto_alloc_leak_t leaks[PAL_CRYPTO_ALLOC_LEAKS];    /* Of the current test */
+    uint32_t                leak_count;
+    uint32_t                suite_leak_count;
+} pal_crypto_alloc_profile_t;
+
+/**
+ *   @brief    - Returns the heap allocation profile of the crypto functions, collected
+ *               by the platform through the pal_crypto_call_begin and pal_crypto_call_end
+ *               hooks. The profile of a test is added to the totals of the suite by the
+ *               PAL_CRYPTO_FREE call which ends it.
+ *   @param    - void
+ *   @return   - Profile, NULL when the platform does not profile the allocations
+**/
+const pal_crypto_alloc_profile_t *pal_crypto_alloc_profile(void);
+
 /**
  *   @brief    - This API will call the requested internal trusted storage function
  *   @param    - type    : function code
@@ -106,6 +158,145 @@ void pal_set_custom_test_list(char *custom_test_list);
 **/
 bool_t pal_is_test_enabled(test_id_t test_id);
 
+/**
+ *   @brief    - Returns the number of workers available to run tests in parallel
+ *   @param    - void
+ *   @return   - Number of workers, 1 for sequential execution
+**/
+uint32_t pal_get_worker_count(void);
+
+/**
+ *   @brief    - Starts a worker which runs one test in isolation from the dispatcher
+ *   @param    - worker : Returns the worker index, in the range [0, worker count)
+ *   @return   - 0 when returning in the worker, 1 when returning in the dispatcher,
+ *               error code otherwise
+**/
+int pal_worker_start(int32_t *worker);
+
+/**
+ *   @brief    - Hands the result of the calling worker back to the dispatcher and
+ *               terminates the worker. Does not return.
+ *   @param    - result : Result record of the test run by the worker
+ *               size   : Size of the result record
+ *   @return   - void
+**/
+void pal_worker_exit(const void *result, size_t size);
+
+/**
+ *   @brief    - Waits for any running worker to complete
+ *   @param    - worker : Returns the index of the completed worker
+ *               result : Buffer receiving the result record of the worker
+ *               size   : Size of the result record
+ *   @return   - SUCCESS if the worker handed back its result,
+ *               ERROR if it crashed, timed out or could not be waited for
+**/
+int pal_worker_wait(int32_t *worker, void *result, size_t size);
+
+/**
+ *   @brief    - Reads a free running timestamp counter, used to time the tests.
+ *               The counter runs at PLATFORM_TIMESTAMP_TICKS_PER_US ticks per
+ *               micro second.
+ *   @param    - void
+ *   @return   - Counter value, 0 if the platform has no timestamp counter
+**/
+uint64_t pal_timestamp(void);
+
+/**
+ *   @brief    - Writes machine readable test results to a platform result file
+ *   @param    - format : PAL_RESULT_JSONL for the JSON records of the tests and
+ *                        checks, PAL_RESULT_JUNIT for the JUnit XML report
+ *               record : Null terminated text to append to the result file,
+ *                        NULL to start a new result file
+ *   @return   - SUCCESS/ERROR, UNSUPPORTED_FUNC if the platform has no result file
+**/
+int pal_result_write(pal_result_format_t format, const char *record);
+
+/**
+ *   @brief    - Appends to the trace of the PSA calls, see pal_trace.h for its format
+ *   @param    - data : Data to append, NULL to start a new trace
+ *               size : Size of the data, 0 to tell whether traces are recorded
+ *   @return   - SUCCESS/ERROR, UNSUPPORTED_FUNC if the platform does not record
+ *               traces
+**/
+int pal_trace_write(const void *data, size_t size);
+
+/**
+ *   @brief    - Tells whether the PSA calls are recorded, see pal_trace_write
+ *   @param    - void
+ *   @return   - 1 if the platform records traces, 0 otherwise
+**/
+int pal_trace_enabled(void);
+
+/**
+ *   @brief    - Maps a test vector file in memory, see val_vectors.h for its format.
+ *               The mapping must stay valid until the end of the run.
+ *   @param    - name : Name of the vector file, the name of the test using it
+ *               data : Returns the start of the mapping
+ *               size : Returns the size of the file
+ *   @return   - SUCCESS/ERROR, UNSUPPORTED_FUNC if the platform has no vector files
+**/
+int pal_vector_map(const char *name, const void **data, size_t *size);
+
+/**
+ *   @brief    - Runs a test and measures its peak stack and heap use
+ *   @param    - fn    : Test to run, called once whatever the result
+ *               usage : Returns the peak memory use of the test
+ *   @return   - SUCCESS, UNSUPPORTED_FUNC if the platform cannot measure the
+ *               memory use, the test is then run without measurement
+**/
+int pal_mem_watch_run(pal_test_fn_t fn, pal_mem_usage_t *usage);
+
+/**
+ *   @brief    - Resets and starts the performance counters of the calling thread,
+ *               e.g the cycles, instructions and cache misses of the core
+ *   @param    - void
+ *   @return   - SUCCESS/ERROR, UNSUPPORTED_FUNC if the platform has no
+ *               performance counters
+**/
+int pal_perf_start(void);
+
+/**
+ *   @brief    - Reads the performance counters started by pal_perf_start, which
+ *               keep counting
+ *   @param    - counts : Returns the counter values, count is 0 if not supported
+ *   @return   - SUCCESS/ERROR, UNSUPPORTED_FUNC if the platform has no
+ *               performance counters
+**/
+int pal_perf_read(pal_perf_counts_t *counts);
+
+/**
+ *   @brief    - Returns the number of CPUs available to run threads
+ *   @param    - void
+ *   @return   - Number of CPUs, 1 if the platform has no thread support
+**/
+uint32_t pal_get_cpu_count(void);
+
+/**
+ *   @brief    - Runs a function on several concurrent threads and waits for all of
+ *               them to complete
+ *   @param    - count : Number of threads
+ *               fn    : Function run by each thread, with its thread index
+ *               arg   : Argument passed to each thread
+ *   @return   - SUCCESS/ERROR, UNSUPPORTED_FUNC if count is above 1 and the
+ *               platform has no thread support
+**/
+int pal_thread_run(uint32_t count, pal_thread_fn_t fn, void *arg);
+
+/**
+ *   @brief    - Locks the mutex protecting the harness state shared by the threads
+ *               of pal_thread_run, e.g the key tracking of the crypto PAL
+ *   @param    - void
+ *   @return   - void
+**/
+void pal_mutex_lock(void);
+
+/**
+ *   @brief    - Unlocks the mutex taken by pal_mutex_lock
+ *   @param    - void
+ *   @return   - void
+**/
+void pal_mutex_unlock(void);
+
 /**
  *   @brief    - initialize anything relavent to a platform
  *   @return   - TRUE/FALSE
@@ -18,4 +18,5 @@
 
 # PAL C source files part of NSPE library
 list(APPEND PAL_SRC_C_NSPE
-	${PSA_ROOT_DIR}/platform/targets/common/nspe/pal_weak.c)
+	${PSA_ROOT_DIR}/platform/targets/common/nspe/pal_weak.c
+	${PSA_ROOT_DIR}/platform/targets/common/nspe/pal_trace.c)
@@ -0,0 +1,347 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "pal_trace.h"
+#include "pal_interfaces_ns.h"
+
+/* Offsets of the record header fields completed by pal_trace_end */
+#define PAL_TRACE_FLAGS_OFFSET       5
+#define PAL_TRACE_START_OFFSET       8
+#define PAL_TRACE_STATUS_OFFSET      24
+
+static uint8_t      g_trace_buf[PLATFORM_TRACE_BUFFER_SIZE];
+static uint32_t     g_trace_len;
+static int          g_trace_overflow;
+static int          g_trace_enabled = -1;  /* Unknown until the first call */
+static volatile int g_trace_busy;
+
+/**
+    @brief    - Writes a little endian value to the record buffer
+    @param    - offset : Offset in the buffer
+                value  : Value
+                size   : Size of the value in bytes
+    @return   - void
+**/
+static void pal_trace_set(uint32_t offset, uint64_t value, uint32_t size)
+{
+    while (size--)
+    {
+        g_trace_buf[offset++] = (uint8_t)value;
+        value >>= 8;
+    }
+}
+
+/**
+    @brief    - Appends a little endian value to the record. A record which does not
+                fit in the buffer is not written.
+    @param    - value : Value
+                size  : Size of the value in bytes
+    @return   - void
+**/
+static void pal_trace_put(uint64_t value, uint32_t size)
+{
+    if (g_trace_len + size > sizeof(g_trace_buf))
+    {
+        g_trace_overflow = 1;
+        return;
+    }
+
+    pal_trace_set(g_trace_len, value, size);
+    g_trace_len += size;
+}
+
+/**
+    @brief    - Appends a byte string and its length to the record, PAL_TRACE_NULL for
+                a NULL pointer. The data is left out and the record flagged as
+                truncated when it does not fit.
+    @param    - data : Data
+                size : Size of the data
+    @return   - void
+**/
+static void pal_trace_put_data(const void *data, size_t size)
+{
+    const uint8_t *bytes = data;
+
+    if (!data)
+    {
+        pal_trace_put(PAL_TRACE_NULL, 4);
+        return;
+    }
+
+    if (size > sizeof(g_trace_buf) - 4 - g_trace_len)
+    {
+        g_trace_buf[PAL_TRACE_FLAGS_OFFSET] |= PAL_TRACE_TRUNCATED;
+        size = 0;
+    }
+
+    pal_trace_put(size, 4);
+    while (size-- && !g_trace_overflow)
+        g_trace_buf[g_trace_len++] = *bytes++;
+}
+
+/**
+    @brief    - Appends a string and its length to the record
+    @param    - str : Null terminated string
+    @return   - void
+**/
+static void pal_trace_put_str(const char *str)
+{
+    uint32_t len = 0;
+
+    while (str[len] && len < 0xFF)
+        len++;
+
+    pal_trace_put(len, 1);
+    while (len-- && !g_trace_overflow)
+        pal_trace_put((uint8_t)*str++, 1);
+}
+
+static uint64_t pal_trace_ns(uint64_t ticks)
+{
+    return ticks * 1000 / PLATFORM_TIMESTAMP_TICKS_PER_US;
+}
+
+void pal_trace_start(void)
+{
+    uint8_t header[8];
+
+    if (pal_trace_write(NULL, 0) != PAL_STATUS_SUCCESS)
+        return;
+
+    header[0] = (uint8_t)PAL_TRACE_MAGIC;
+    header[1] = (uint8_t)(PAL_TRACE_MAGIC >> 8);
+    header[2] = (uint8_t)(PAL_TRACE_MAGIC >> 16);
+    header[3] = (uint8_t)(PAL_TRACE_MAGIC >> 24);
+    header[4] = PAL_TRACE_VERSION;
+    header[5] = 0;
+    header[6] = 0;
+    header[7] = 0;
+    pal_trace_write(header, sizeof(header));
+}
+
+int pal_trace_enabled(void)
+{
+    if (g_trace_enabled < 0)
+        g_trace_enabled = (pal_trace_write(g_trace_buf, 0) == PAL_STATUS_SUCCESS);
+
+    return g_trace_enabled;
+}
+
+void pal_trace_begin(pal_trace_call_t *call, pal_trace_api_t api, int type,
+                     const char *name, const char *schema, va_list valist,
+                     pal_trace_initial_fn_t initial, pal_trace_value_fn_t value)
+{
+    va_list      args;
+    const char  *kind;
+    const void  *data;
+    size_t       size;
+    uint8_t      object[32];
+
+    call->active = 0;
+    if (!schema)
+        return;
+
+    if (!pal_trace_enabled())
+        return;
+
+    /* The calls of concurrent threads are recorded one at a time */
+    for (;;)
+    {
+        pal_mutex_lock();
+        if (!g_trace_busy)
+        {
+            g_trace_busy = 1;
+            pal_mutex_unlock();
+            break;
+        }
+        pal_mutex_unlock();
+    }
+
+    g_trace_len      = 0;
+    g_trace_overflow = 0;
+    pal_trace_put(0, 4);
+    pal_trace_put(api, 1);
+    pal_trace_put(0, 1);
+    pal_trace_put((uint16_t)type, 2);
+    pal_trace_put(0, 8);
+    pal_trace_put(0, 8);
+    pal_trace_put(0, 4);
+    pal_trace_put_str(name ? name : "");
+    pal_trace_put_str(schema);
+
+    va_copy(args, valist);
+    for (kind = schema; *kind; kind++)
+    {
+        switch (*kind)
+        {
+            case 'v':
+            case 'k':
+                pal_trace_put(va_arg(args, uint32_t), 4);
+                break;
+            case 'z':
+                pal_trace_put(va_arg(args, size_t), 8);
+                break;
+            case 'q':
+                pal_trace_put(va_arg(args, uint64_t), 8);
+                break;
+            case 'i':
+                data = va_arg(args, const uint8_t *);
+                size = va_arg(args, size_t);
+                pal_trace_put_data(data, size);
+                break;
+            case 'I':
+                size = va_arg(args, uint32_t);
+                data = va_arg(args, const void *);
+                pal_trace_put_data(data, size);
+                break;
+            case 'o':
+                (void)va_arg(args, uint8_t *);
+                pal_trace_put(va_arg(args, size_t), 8);
+                (void)va_arg(args, size_t *);
+                break;
+            case 'O':
+                pal_trace_put(va_arg(args, uint32_t), 8);
+                (void)va_arg(args, void *);
+                (void)va_arg(args, size_t *);
+                break;
+            case 'b':
+                (void)va_arg(args, uint8_t *);
+                pal_trace_put(va_arg(args, size_t), 8);
+                break;
+            case 'K':
+            case 'V':
+                (void)va_arg(args, uint32_t *);
+                break;
+            case 'W':
+                (void)va_arg(args, uint16_t *);
+                break;
+            case 'Z':
+                (void)va_arg(args, size_t *);
+                break;
+            case 'n':
+                (void)va_arg(args, void *);
+                break;
+            default:
+                /* Object, identified by its address */
+                data = va_arg(args, void *);
+                pal_trace_put(initial && data && initial(*kind, data), 1);
+                pal_trace_put((uintptr_t)data, 8);
+                size = (value && data) ? value(*kind, data, object, sizeof(object)) : 0;
+                pal_trace_put_data(object, size);
+                break;
+        }
+    }
+    va_end(args);
+
+    call->schema = schema;
+    call->active = 1;
+    call->start  = pal_timestamp();
+}
+
+void pal_trace_end(pal_trace_call_t *call, int32_t status, va_list valist)
+{
+    uint64_t     end;
+    va_list      args;
+    const char  *kind;
+    const void  *data;
+    size_t       size, *length;
+    uint32_t    *value;
+    uint16_t    *value16;
+    size_t      *value_size;
+
+    if (!call->active)
+        return;
+
+    end = pal_timestamp();
+
+    pal_trace_set(PAL_TRACE_START_OFFSET, pal_trace_ns(call->start), 8);
+    pal_trace_set(PAL_TRACE_START_OFFSET + 8, pal_trace_ns(end - call->start), 8);
+    pal_trace_set(PAL_TRACE_STATUS_OFFSET, (uint32_t)status, 4);
+
+    va_copy(args, valist);
+    for (kind = call->schema; *kind; kind++)
+    {
+        switch (*kind)
+        {
+            case 'v':
+            case 'k':
+                (void)va_arg(args, uint32_t);
+                break;
+            case 'z':
+                (void)va_arg(args, size_t);
+                break;
+            case 'q':
+                (void)va_arg(args, uint64_t);
+                break;
+            case 'i':
+                (void)va_arg(args, const uint8_t *);
+                (void)va_arg(args, size_t);
+                break;
+            case 'I':
+                (void)va_arg(args, uint32_t);
+                (void)va_arg(args, const void *);
+                break;
+            case 'o':
+            case 'O':
+                if (*kind == 'o')
+                {
+                    data = va_arg(args, uint8_t *);
+                    size = va_arg(args, size_t);
+                }
+                else
+                {
+                    size = va_arg(args, uint32_t);
+                    data = va_arg(args, void *);
+                }
+                length = va_arg(args, size_t *);
+                pal_trace_put_data(data, (!status && length && *length <= size) ? *length : 0);
+                break;
+            case 'b':
+                data = va_arg(args, uint8_t *);
+                size = va_arg(args, size_t);
+                pal_trace_put_data(data, status ? 0 : size);
+                break;
+            case 'K':
+            case 'V':
+                value = va_arg(args, uint32_t *);
+                pal_trace_put(value ? *value : 0, 4);
+                break;
+            case 'W':
+                value16 = va_arg(args, uint16_t *);
+                pal_trace_put(value16 ? *value16 : 0, 4);
+                break;
+            case 'Z':
+                value_size = va_arg(args, size_t *);
+                pal_trace_put(value_size ? *value_size : 0, 8);
+                break;
+            default:
+                (void)va_arg(args, void *);
+                break;
+        }
+    }
+    va_end(args);
+
+    if (!g_trace_overflow)
+    {
+        pal_trace_set(0, g_trace_len, 4);
+        pal_trace_write(g_trace_buf, g_trace_len);
+    }
+
+    pal_mutex_lock();
+    g_trace_busy = 0;
+    pal_mutex_unlock();
+}
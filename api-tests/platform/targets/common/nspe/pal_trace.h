@@ -0,0 +1,128 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _PAL_TRACE_H_
+#define _PAL_TRACE_H_
+
+#include "pal_common.h"
+#include <stdarg.h>
+#include <stddef.h>
+
+/* Trace of the PSA calls made through the function dispatchers of the PAL and through
+ * the typed crypto table, replayed on a host by tools/utils/psa_replay.c. All the
+ * values are little endian.
+ *
+ * File    : magic, version (2 bytes), reserved (2 bytes), records
+ * Record  : size of the record (4 bytes), API (1 byte), flags (1 byte), function
+ *           code (2 bytes), start and duration in nano seconds (8 bytes each),
+ *           status (4 bytes), name and schema (1 byte length and characters),
+ *           the inputs then the outputs of the arguments, in schema order
+ *
+ * The schema of a function has one character per argument, which gives the
+ * arguments it takes from the va_list of the call and what is recorded:
+ *
+ *   v k      uint32_t value, k for a key identifier          in : 4 bytes
+ *   z q      size_t and uint64_t values                      in : 8 bytes
+ *   i        const uint8_t *, size_t length                  in : 4 byte length, data
+ *   I        uint32_t length, const void *                   in : 4 byte length, data
+ *   o        uint8_t *, size_t size, size_t *length          in : 8 byte size
+ *                                                            out: 4 byte length, data
+ *   O        uint32_t size, void *, size_t *length           same as o
+ *   b        uint8_t *, size_t size, filled on success       same as o
+ *   K V      psa_key_id_t *, uint32_t * output               out: 4 bytes
+ *   W        uint16_t * output                               out: 4 bytes
+ *   Z        size_t * output                                 out: 8 bytes
+ *   n        other output, not recorded
+ *   H M C E  hash, MAC, cipher, AEAD operation               in : 1 byte set if the
+ *   D P      key derivation, PAKE operation                       object is in its
+ *   S T      PAKE cipher suite, key attributes                    initial state,
+ *   X Y A    interruptible sign hash, verify hash and             8 byte address,
+ *            key agreement operation                              4 byte length, value
+ *
+ * The value of an object is empty, except for the key attributes: their type, bits,
+ * usage flags, algorithm, lifetime and identifier, 4 bytes each. The setters of the
+ * typed crypto table are not recorded, the replay takes the attributes from the calls
+ * which use them. *
+ * The length of a NULL byte string is PAL_TRACE_NULL. Functions without schema, e.g
+ * the PAL helpers of the attestation suite, are not recorded.
+ */
+#define PAL_TRACE_MAGIC              0x54415350  /* "PSAT" */
+#define PAL_TRACE_VERSION            2
+
+#define PAL_TRACE_NULL               0xFFFFFFFF
+
+/* Record flags */
+#define PAL_TRACE_TRUNCATED          0x1  /* Data left out, the record did not fit */
+
+/* Size of the record buffer, the inputs and outputs of a call must fit in it */
+#ifndef PLATFORM_TRACE_BUFFER_SIZE
+#define PLATFORM_TRACE_BUFFER_SIZE   4096
+#endif
+
+typedef enum {
+    PAL_TRACE_CRYPTO             = 0x1,
+    PAL_TRACE_ITS                = 0x2,
+    PAL_TRACE_PS                 = 0x3,
+    PAL_TRACE_ATTESTATION        = 0x4,
+} pal_trace_api_t;
+
+/* Tells whether an object of a schema kind, e.g 'H', is in its initial state */
+typedef int (*pal_trace_initial_fn_t)(char kind, const void *object);
+
+/* Writes the value of an object of a schema kind, returns its size, 0 if none */
+typedef size_t (*pal_trace_value_fn_t)(char kind, const void *object, uint8_t *value,
+                                       size_t size);
+
+/* Call being recorded, from pal_trace_begin to pal_trace_end */
+typedef struct {
+    int             active;
+    const char     *schema;
+    uint64_t        start;
+} pal_trace_call_t;
+
+/**
+    @brief    - Starts a new trace, at the start of a run
+    @param    - void
+    @return   - void
+**/
+void pal_trace_start(void);
+
+/**
+    @brief    - Records the inputs of a call, when the platform records traces
+    @param    - call    : Returns the call being recorded
+                api     : API of the dispatcher
+                type    : Function code
+                name    : Name of the PSA function
+                schema  : Arguments of the function, NULL to not record it
+                valist  : Arguments passed to the dispatcher
+                initial : Initial state check of the objects, NULL if none
+                value   : Value of the objects, NULL if none
+    @return   - void
+**/
+void pal_trace_begin(pal_trace_call_t *call, pal_trace_api_t api, int type,
+                     const char *name, const char *schema, va_list valist,
+                     pal_trace_initial_fn_t initial, pal_trace_value_fn_t value);
+
+/**
+    @brief    - Records the status and the outputs of a call and writes its record
+    @param    - call   : Call started by pal_trace_begin
+                status : Status returned by the function
+                valist : Arguments of the call, as given to pal_trace_begin
+    @return   - void
+**/
+void pal_trace_end(pal_trace_call_t *call, int32_t status, va_list valist);
+#endif /* _PAL_TRACE_H_ */
@@ -32,6 +32,188 @@ __attribute__((weak)) bool_t pal_is_test_enabled(test_id_t test_id)
 	return 1;
 }
 
+__attribute__((weak)) uint32_t pal_get_worker_count(void)
+{
+	return 1;
+}
+
+__attribute__((weak)) int pal_worker_start(int32_t *worker)
+{
+	(void)worker;
+
+	return PAL_STATUS_UNSUPPORTED_FUNC;
+}
+
+__attribute__((weak)) void pal_worker_exit(const void *result, size_t size)
+{
+	(void)result;
+	(void)size;
+
+	return;
+}
+
+__attribute__((weak)) int pal_worker_wait(int32_t *worker, void *result, size_t size)
+{
+	(void)worker;
+	(void)result;
+	(void)size;
+
+	return PAL_STATUS_ERROR;
+}
+
+__attribute__((weak)) int pal_result_write(pal_result_format_t format, const char *record)
+{
+	(void)format;
+	(void)record;
+
+	return PAL_STATUS_UNSUPPORTED_FUNC;
+}
+
+__attribute__((weak)) int pal_vector_map(const char *name, const void **data, size_t *size)
+{
+	(void)name;
+	(void)data;
+	(void)size;
+
+	return PAL_STATUS_UNSUPPORTED_FUNC;
+}
+
+#if defined(PLATFORM_STACK_PAINT_SIZE) && (PLATFORM_STACK_PAINT_SIZE > 0)
+#define PAL_STACK_PAINT          0x5AA5C33CUL
+/* Words left unpainted below the frame of pal_mem_watch_run, for its own spills */
+#define PAL_STACK_PAINT_GAP      16
+
+/**
+ *   @brief    - Runs a test on the current stack, painted over PLATFORM_STACK_PAINT_SIZE
+ *               bytes below this frame. The peak stack use is the depth of the first
+ *               word overwritten by the test. The heap use is not measured.
+**/
+__attribute__((weak, noinline)) int pal_mem_watch_run(pal_test_fn_t fn, pal_mem_usage_t *usage)
+{
+	volatile uint32_t  top = PAL_STACK_PAINT;
+	volatile uint32_t *word;
+	volatile uint32_t *bottom;
+
+	/* No function call while painting, a callee frame would be painted over */
+	bottom = &top - PLATFORM_STACK_PAINT_SIZE / sizeof(uint32_t);
+	for (word = &top - PAL_STACK_PAINT_GAP; word >= bottom; word--)
+		*word = PAL_STACK_PAINT;
+
+	fn();
+
+	for (word = bottom; word < &top - PAL_STACK_PAINT_GAP; word++)
+	{
+		if (*word != PAL_STACK_PAINT)
+			break;
+	}
+
+	usage->stack_bytes = (uint32_t)((uintptr_t)&top - (uintptr_t)word);
+	usage->heap_bytes  = 0;
+
+	return PAL_STATUS_SUCCESS;
+}
+#else
+__attribute__((weak)) int pal_mem_watch_run(pal_test_fn_t fn, pal_mem_usage_t *usage)
+{
+	usage->stack_bytes = 0;
+	usage->heap_bytes  = 0;
+	fn();
+
+	return PAL_STATUS_UNSUPPORTED_FUNC;
+}
+#endif
+
+__attribute__((weak)) int pal_trace_write(const void *data, size_t size)
+{
+	(void)data;
+	(void)size;
+
+	return PAL_STATUS_UNSUPPORTED_FUNC;
+}
+
+__attribute__((weak)) int pal_perf_start(void)
+{
+	return PAL_STATUS_UNSUPPORTED_FUNC;
+}
+
+__attribute__((weak)) int pal_perf_read(pal_perf_counts_t *counts)
+{
+	counts->count = 0;
+
+	return PAL_STATUS_UNSUPPORTED_FUNC;
+}
+
+__attribute__((weak)) uint32_t pal_get_cpu_count(void)
+{
+	return 1;
+}
+
+__attribute__((weak)) int pal_thread_run(uint32_t count, pal_thread_fn_t fn, void *arg)
+{
+	/* Without thread support, a single thread is run on the caller */
+	if (count != 1)
+		return PAL_STATUS_UNSUPPORTED_FUNC;
+
+	fn(arg, 0);
+
+	return PAL_STATUS_SUCCESS;
+}
+
+__attribute__((weak)) void pal_mutex_lock(void)
+{
+	return;
+}
+
+__attribute__((weak)) void pal_mutex_unlock(void)
+{
+	return;
+}
+
+#if (defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || \
+     defined(__ARM_ARCH_8M_MAIN__) || defined(__ARM_ARCH_8_1M_MAIN__)) && \
+    !defined(PAL_TIMESTAMP_TICKS_UNKNOWN)
+/* DWT cycle counter of the Armv7-M and Armv8-M Mainline cores, used when pal_config.h
+   gives the core clock as PLATFORM_TIMESTAMP_TICKS_PER_US */
+#define PAL_DEMCR                (*(volatile uint32_t *)0xE000EDFCUL)
+#define PAL_DWT_CTRL             (*(volatile uint32_t *)0xE0001000UL)
+#define PAL_DWT_CYCCNT           (*(volatile uint32_t *)0xE0001004UL)
+#define PAL_DEMCR_TRCENA         (1UL << 24)
+#define PAL_DWT_CTRL_CYCCNTENA   (1UL << 0)
+
+static uint32_t g_cyccnt_last;
+static uint64_t g_cyccnt_high;
+
+/**
+ *   @brief    - Reads the DWT cycle counter, extended to 64 bits. The counter
+ *               wraps every 2^32 cycles so it must be read at least once per
+ *               wrap period, platforms with a slower timer should override it.
+ *   @return   - Number of core cycles
+**/
+__attribute__((weak)) uint64_t pal_timestamp(void)
+{
+	uint32_t now;
+
+	if (!(PAL_DWT_CTRL & PAL_DWT_CTRL_CYCCNTENA))
+	{
+		PAL_DEMCR |= PAL_DEMCR_TRCENA;
+		PAL_DWT_CYCCNT = 0;
+		PAL_DWT_CTRL |= PAL_DWT_CTRL_CYCCNTENA;
+	}
+
+	now = PAL_DWT_CYCCNT;
+	if (now < g_cyccnt_last)
+		g_cyccnt_high += (1ULL << 32);
+	g_cyccnt_last = now;
+
+	return g_cyccnt_high | now;
+}
+#else
+__attribute__((weak)) uint64_t pal_timestamp(void)
+{
+	return 0;
+}
+#endif
+
 /**
  *   @brief    - initialize anything relavent to a platform
  *               like any key initialization for crypto operations and etc
@@ -17,6 +17,30 @@
 
 
 #include "pal_protected_storage_intf.h"
+#include "pal_trace.h"
+
+/* Names and arguments of the functions, for the trace of the PSA calls, see pal_trace.h */
+static const char *const g_ps_names[] = {
+    [PAL_PS_SET]                 = "psa_ps_set",
+    [PAL_PS_GET]                 = "psa_ps_get",
+    [PAL_PS_GET_INFO]            = "psa_ps_get_info",
+    [PAL_PS_REMOVE]              = "psa_ps_remove",
+    [PAL_PS_CREATE]              = "psa_ps_create",
+    [PAL_PS_SET_EXTENDED]        = "psa_ps_set_extended",
+    [PAL_PS_GET_SUPPORT]         = "psa_ps_get_support",
+};
+
+static const char *const g_ps_trace_schemas[] = {
+    [PAL_PS_SET]                 = "qIv",
+    [PAL_PS_GET]                 = "qvO",
+    [PAL_PS_GET_INFO]            = "qn",
+    [PAL_PS_REMOVE]              = "q",
+    [PAL_PS_CREATE]              = "qvv",
+    [PAL_PS_SET_EXTENDED]        = "qvI",
+    [PAL_PS_GET_SUPPORT]         = "",
+};
+
+static int32_t pal_ps_dispatch(int type, va_list valist);
 
 /**
     @brief    - This API will call the requested protected storage function
@@ -25,6 +49,34 @@
     @return   - error status
 **/
 int32_t pal_ps_function(int type, va_list valist)
+{
+    const char         *name = NULL, *schema = NULL;
+    pal_trace_call_t    trace;
+    va_list             args;
+    int32_t             status;
+
+    if (type > 0 && type < (int)(sizeof(g_ps_names) / sizeof(char *)))
+    {
+        name   = g_ps_names[type];
+        schema = g_ps_trace_schemas[type];
+    }
+
+    pal_trace_begin(&trace, PAL_TRACE_PS, type, name, schema, valist, NULL, NULL);
+    va_copy(args, valist);
+    status = pal_ps_dispatch(type, valist);
+    pal_trace_end(&trace, status, args);
+    va_end(args);
+
+    return status;
+}
+
+/**
+    @brief    - Decodes the arguments of a protected storage function and calls it
+    @param    - type    : function code
+                valist  : variable argument list
+    @return   - error status
+**/
+static int32_t pal_ps_dispatch(int type, va_list valist)
 {
     psa_storage_uid_t          uid;
     uint32_t                   data_size, size, offset;
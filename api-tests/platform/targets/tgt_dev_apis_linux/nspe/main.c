@@ -18,6 +18,8 @@
 #include <stdint.h>
 
 int32_t val_entry(void);
+int32_t val_select_tests(int argc, char **argv);
+int pal_reset_supervise(int *exit_status);
 
 /**
     @brief    - PSA C main function, used for generating tgt_dev_apis_stdc test binaries.
@@ -27,7 +29,16 @@ int32_t val_entry(void);
 **/
 int main(int argc, char **argv)
 {
-    (void)argc;
-    (void)argv;
+    int32_t status;
+    int     exit_status;
+
+    /* The supervisor returns here once the test processes completed the suite */
+    if (pal_reset_supervise(&exit_status))
+        return exit_status;
+
+    status = val_select_tests(argc, argv);
+    if (status)
+        return (status < 0);
+
     return val_entry();
 }
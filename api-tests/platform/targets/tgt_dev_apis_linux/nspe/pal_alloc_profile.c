@@ -0,0 +1,224 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#define _GNU_SOURCE
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pal_common.h"
+#include "pal_interfaces_ns.h"
+#include "pal_crypto_intf.h"
+
+/* Allocation profiler of the crypto suites, enabled by setting the PSA_ACS_ALLOC_PROFILE
+ * environment variable. The heap allocations made while a crypto function runs, from
+ * pal_crypto_call_begin to pal_crypto_call_end, are attributed to its function code:
+ * number of calls, allocations, bytes allocated and peak bytes live in a single call.
+ * The VAL prints them through pal_crypto_alloc_profile at the end of each test, and
+ * the totals of the suite in its memory report.
+ *
+ * The bytes allocated and not freed by the calls on a multi-part operation, from its
+ * setup to its finish or abort, are flagged as a leak of the operation.
+ */
+
+#define PAL_PROFILE_OPERATIONS       32
+
+typedef struct {
+    const void *operation;
+    int         setup;      /* Function which started the operation, 0 for a free slot */
+    int64_t     balance;    /* Bytes allocated and not freed by the calls on it */
+} pal_profile_operation_t;
+
+static int                          g_profile_enabled = -1;
+static pthread_mutex_t              g_profile_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pal_crypto_alloc_profile_t   g_profile;
+static pal_profile_operation_t      g_operations[PAL_PROFILE_OPERATIONS];
+
+/* Crypto call in flight on the calling thread */
+static __thread int                     t_type;
+static __thread pal_crypto_call_role_t  t_role;
+static __thread const void             *t_operation;
+static __thread uint32_t                t_allocs;
+static __thread uint64_t                t_bytes;
+static __thread int64_t                 t_live;
+static __thread int64_t                 t_peak;
+
+/**
+ *   @brief    - Tells whether the allocations are profiled
+ *   @param    - void
+ *   @return   - 1 if PSA_ACS_ALLOC_PROFILE is set, 0 otherwise
+**/
+static int pal_profile_enabled(void)
+{
+    const char *env;
+
+    if (g_profile_enabled < 0)
+    {
+        env = getenv("PSA_ACS_ALLOC_PROFILE");
+        g_profile_enabled = (env && *env && strcmp(env, "0")) ? 1 : 0;
+    }
+
+    return g_profile_enabled;
+}
+
+/**
+ *   @brief    - Adds the allocations of the test which just completed to the totals of
+ *               the suite. Called with the profiler mutex held.
+ *   @param    - void
+ *   @return   - void
+**/
+static void pal_profile_end_test(void)
+{
+    pal_crypto_alloc_stat_t *test, *suite;
+    int                      type;
+
+    for (type = 0; type < PAL_CRYPTO_ALLOC_FUNCTIONS; type++)
+    {
+        test  = &g_profile.test[type];
+        suite = &g_profile.suite[type];
+        suite->calls  += test->calls;
+        suite->allocs += test->allocs;
+        suite->bytes  += test->bytes;
+        if (test->peak > suite->peak)
+            suite->peak = test->peak;
+    }
+    g_profile.suite_leak_count += g_profile.leak_count;
+
+    memset(g_profile.test, 0, sizeof(g_profile.test));
+    memset(g_operations, 0, sizeof(g_operations));
+    g_profile.leak_count = 0;
+}
+
+/**
+ *   @brief    - Returns the slot of an operation, or a free slot for a new operation
+ *   @param    - operation : Operation context
+ *               create    : Returns a free slot if the operation has none
+ *   @return   - Slot, NULL if not found or no slot is free
+**/
+static pal_profile_operation_t *pal_profile_operation(const void *operation, int create)
+{
+    pal_profile_operation_t *slot = NULL;
+    uint32_t                 i;
+
+    for (i = 0; i < PAL_PROFILE_OPERATIONS; i++)
+    {
+        if (g_operations[i].setup && g_operations[i].operation == operation)
+            return &g_operations[i];
+        if (!g_operations[i].setup && !slot)
+            slot = &g_operations[i];
+    }
+
+    return create ? slot : NULL;
+}
+
+void pal_alloc_profile_account(int64_t bytes)
+{
+    if (!t_type)
+        return;
+
+    if (bytes > 0)
+    {
+        t_allocs++;
+        t_bytes += (uint64_t)bytes;
+    }
+
+    t_live += bytes;
+    if (t_live > t_peak)
+        t_peak = t_live;
+}
+
+const pal_crypto_alloc_profile_t *pal_crypto_alloc_profile(void)
+{
+    return pal_profile_enabled() ? &g_profile : NULL;
+}
+
+void pal_crypto_call_begin(int type, pal_crypto_call_role_t role, const void *operation)
+{
+    if (!pal_profile_enabled())
+        return;
+
+    /* The tests release their keys at their end, after the VAL printed their profile */
+    if (type == PAL_CRYPTO_FREE)
+    {
+        pthread_mutex_lock(&g_profile_mutex);
+        pal_profile_end_test();
+        pthread_mutex_unlock(&g_profile_mutex);
+        return;
+    }
+
+    /* Calls made by a crypto function are accounted to it */
+    if (t_type || type <= 0 || type >= PAL_CRYPTO_ALLOC_FUNCTIONS)
+        return;
+
+    t_type      = type;
+    t_role      = role;
+    t_operation = operation;
+    t_allocs    = 0;
+    t_bytes     = 0;
+    t_live      = 0;
+    t_peak      = 0;
+}
+
+void pal_crypto_call_end(int type)
+{
+    pal_crypto_alloc_stat_t *stat;
+    pal_profile_operation_t *slot;
+    pal_crypto_alloc_leak_t *leak;
+
+    if (g_profile_enabled <= 0 || t_type != type)
+        return;
+
+    pthread_mutex_lock(&g_profile_mutex);
+
+    stat = &g_profile.test[type];
+    stat->calls++;
+    stat->allocs += t_allocs;
+    stat->bytes  += t_bytes;
+    if (t_peak > stat->peak)
+        stat->peak = t_peak;
+
+    if (t_role != PAL_CRYPTO_CALL_SINGLE)
+    {
+        slot = pal_profile_operation(t_operation, t_role == PAL_CRYPTO_CALL_SETUP);
+        if (slot && t_role == PAL_CRYPTO_CALL_SETUP)
+        {
+            slot->operation = t_operation;
+            slot->setup     = type;
+            slot->balance   = t_live;
+        }
+        else if (slot)
+        {
+            slot->balance += t_live;
+        }
+
+        if (slot && t_role == PAL_CRYPTO_CALL_END)
+        {
+            if (slot->balance > 0 && g_profile.leak_count < PAL_CRYPTO_ALLOC_LEAKS)
+            {
+                leak = &g_profile.leaks[g_profile.leak_count++];
+                leak->setup = slot->setup;
+                leak->end   = type;
+                leak->bytes = slot->balance;
+            }
+            slot->setup = 0;
+        }
+    }
+
+    pthread_mutex_unlock(&g_profile_mutex);
+    t_type = 0;
+}
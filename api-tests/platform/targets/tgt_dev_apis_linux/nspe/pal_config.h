@@ -35,23 +35,22 @@
 #define UART_0_PERMISSION                      TYPE_READ_WRITE
 
 // Watchdog device info
-// In this implementation we don't assume there's a watchdog. Watchdog PAL
-// functions all just return SUCCESS, so the values below don't mean much.
+// The watchdog is emulated with alarm(), which kills a hung test process so that
+// the reset emulation starts it again. The timeouts are rounded up to seconds.
 #define WATCHDOG_NUM                           1
 
 #define WATCHDOG_0_BASE                        0x0
 #define WATCHDOG_0_SIZE                        0x0
 #define WATCHDOG_0_INTR_ID                     0x0
 #define WATCHDOG_0_PERMISSION                  TYPE_READ_WRITE
-#define WATCHDOG_0_NUM_OF_TICK_PER_MICRO_SEC   0x0
-#define WATCHDOG_0_TIMEOUT_IN_MICRO_SEC_LOW    0x0
-#define WATCHDOG_0_TIMEOUT_IN_MICRO_SEC_MEDIUM 0x0
-#define WATCHDOG_0_TIMEOUT_IN_MICRO_SEC_HIGH   0x0
-#define WATCHDOG_0_TIMEOUT_IN_MICRO_SEC_CRYPTO 0x0
-
-// In this implementation we don't actually use NV memory - we don't support
-// tests that require process or system restarts so NV memory isn't required.
-// The implementation just uses an array in memory.
+#define WATCHDOG_0_NUM_OF_TICK_PER_MICRO_SEC   0x1
+#define WATCHDOG_0_TIMEOUT_IN_MICRO_SEC_LOW    10000000
+#define WATCHDOG_0_TIMEOUT_IN_MICRO_SEC_MEDIUM 60000000
+#define WATCHDOG_0_TIMEOUT_IN_MICRO_SEC_HIGH   600000000
+#define WATCHDOG_0_TIMEOUT_IN_MICRO_SEC_CRYPTO 600000000
+
+// The NV memory is shared between the reset emulation supervisor and the test
+// process, so that it survives the emulated resets.
 #define NVMEM_NUM                              1
 
 #define NVMEM_0_START                          0x0
@@ -106,6 +105,27 @@ typedef uint32_t            cfg_id_t;
 /* Enable custom printing for Non-secure side */
 #define BESPOKE_PRINT_NS
 
+/* pal_timestamp() counts nano seconds */
+#define PLATFORM_TIMESTAMP_TICKS_PER_US 1000
+
+/* Largest message of the crypto benchmarks, the host has memory for the full sweep */
+#define PLATFORM_BENCH_MAX_MSG_SIZE (1024 * 1024)
+
+/* Samples of the crypto latency distributions */
+#define PLATFORM_BENCH_LATENCY_SAMPLES 5000
+
+/* Bytes pushed through each multipart operation by the crypto streaming benchmark */
+#define PLATFORM_BENCH_STREAM_SIZE (256 * 1024 * 1024)
+
+/* stdout is buffered already, and flushed before the test processes exit */
+#define PLATFORM_LOG_BUFFER_SIZE 0
+
+/* Size of the trace records, the host has memory for the largest calls of the suites */
+#define PLATFORM_TRACE_BUFFER_SIZE (1024 * 1024)
+
+/* The host stacks are large, the scratch arena only has to fit the test buffers */
+#define PLATFORM_SCRATCH_SIZE (64 * 1024)
+
 /* UART base address assigned */
 #define PLATFORM_UART_BASE UART_0_BASE
 
@@ -113,8 +133,8 @@ typedef uint32_t            cfg_id_t;
 #define PLATFORM_WD_BASE                        WATCHDOG_0_BASE
 #define PLATFORM_WD_NUM_OF_TICK_PER_MICRO_SEC   WATCHDOG_0_NUM_OF_TICK_PER_MICRO_SEC
 #define PLATFORM_WD_TIMEOUT_IN_MICRO_SEC_LOW    WATCHDOG_0_TIMEOUT_IN_MICRO_SEC_LOW
-#define PLATFORM_WD_TIMEOUT_IN_MICRO_SEC_MEDIUM WATCHDOG_0_TIMEOUT_IN_MICRO_SEC_LOW
-#define PLATFORM_WD_TIMEOUT_IN_MICRO_SEC_HIGH   WATCHDOG_0_TIMEOUT_IN_MICRO_SEC_LOW
+#define PLATFORM_WD_TIMEOUT_IN_MICRO_SEC_MEDIUM WATCHDOG_0_TIMEOUT_IN_MICRO_SEC_MEDIUM
+#define PLATFORM_WD_TIMEOUT_IN_MICRO_SEC_HIGH   WATCHDOG_0_TIMEOUT_IN_MICRO_SEC_HIGH
 #define PLATFORM_WD_TIMEOUT_IN_MICRO_SEC_CRYPTO WATCHDOG_0_TIMEOUT_IN_MICRO_SEC_CRYPTO
 
 /* Non-volatile memory base address assigned */
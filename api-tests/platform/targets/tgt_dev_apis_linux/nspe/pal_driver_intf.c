@@ -16,21 +16,29 @@
  * limitations under the License.
 **/
 
+#define _POSIX_C_SOURCE 199309L
+
+#include <fcntl.h>
 #include <inttypes.h>
 #include <limits.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
 
 #include "pal_common.h"
 
 /* Regression test status reporting buffer */
 uint8_t test_status_buffer[256]  = {0};
 
-/* This stdc implementation doesn't support tests that involve resets of the
- * test process or the system, so we don't actually need non-volatile memory.
- * Just implement the "nvmem" as an array in memory.
+/* The "nvmem" is an array in memory. Under the reset emulation of pal_reset.c, it is
+ * moved to a file mapping shared with the supervisor, so that it survives the
+ * emulated resets of the test process.
  */
 
 /* Using zero as NVMEM_BASE is a bit arbitrary - we don't actually need callers
@@ -40,7 +48,8 @@ uint8_t test_status_buffer[256]  = {0};
 #define NVMEM_BASE 0
 
 #define NVMEM_SIZE (1024)
-static uint8_t g_nvmem[NVMEM_SIZE];
+static uint8_t  g_nvmem_ram[NVMEM_SIZE];
+static uint8_t *g_nvmem = g_nvmem_ram;
 
 /* The custom test list is a buffer in which all enabled test names are concatenated.
  * The test name template is <TEST_NAME_PREFIX><id><TEST_NAME_SUFFIX>, where <id>
@@ -107,6 +116,37 @@ int pal_nvm_write(uint32_t offset, void *buffer, size_t size)
     return PAL_STATUS_SUCCESS;
 }
 
+/**
+    @brief    - Moves the nvmem to a shared mapping of a temporary file, which is kept
+                by the processes forked afterwards
+    @param    - void
+    @return   - SUCCESS/FAILURE
+**/
+int pal_nvm_share(void)
+{
+    FILE *file = tmpfile();
+    void *map;
+
+    if (!file)
+        return PAL_STATUS_ERROR;
+
+    if (fwrite(g_nvmem, 1, NVMEM_SIZE, file) != NVMEM_SIZE || fflush(file) != 0)
+    {
+        fclose(file);
+        return PAL_STATUS_ERROR;
+    }
+
+    map = mmap(NULL, NVMEM_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fileno(file), 0);
+
+    /* The mapping holds the file, which is deleted once unmapped by all the processes */
+    fclose(file);
+    if (map == MAP_FAILED)
+        return PAL_STATUS_ERROR;
+
+    g_nvmem = map;
+    return PAL_STATUS_SUCCESS;
+}
+
 /**
     @brief    - This function initializes the UART
 
@@ -141,44 +181,17 @@ int pal_print_ns(const char *str, int32_t data)
 }
 
 /**
-    @brief           - Initializes a hardware watchdog timer
-
-    This implementation doesn't support watchdogs so this is a noop.
-
-    @param           - time_us         : Time in micro seconds
-                     - timer_tick_us   : Number of ticks per micro second
-    @return          - SUCCESS/FAILURE
-**/
-int pal_wd_timer_init_ns(uint32_t time_us, uint32_t timer_tick_us)
-{
-    (void)time_us;
-    (void)timer_tick_us;
-    return PAL_STATUS_SUCCESS;
-}
-
-/**
-    @brief           - Enables a hardware watchdog timer
-
-    This implementation doesn't support watchdogs so this is a noop.
-
-    @param           - Void
-    @return          - SUCCESS/FAILURE
-**/
-int pal_watchdog_enable(void)
-{
-    return PAL_STATUS_SUCCESS;
-}
-
-/**
-    @brief           - Disables a hardware watchdog timer
-
-    This implementation doesn't support watchdogs so this is a noop.
-
-    @param           - Void
-    @return          - SUCCESS/FAILURE
+    @brief    - This function sends a character to the UART TX FIFO. It carries the
+                binary frames of the tokenized log, they are written to stdout.
+    @param    - c  :  Input character
+    @return   - SUCCESS/FAILURE
 **/
-int pal_watchdog_disable(void)
+int pal_print(uint8_t c)
 {
+    if (putchar(c) == EOF)
+    {
+        return PAL_STATUS_ERROR;
+    }
     return PAL_STATUS_SUCCESS;
 }
 
@@ -195,16 +208,6 @@ void pal_terminate_simulation(void)
     ;
 }
 
-/**
- *   @brief    - Resets the system.
- *   @param    - void
- *   @return   - SUCCESS/FAILURE
-**/
-int pal_system_reset(void)
-{
-    return PAL_STATUS_UNSUPPORTED_FUNC;
-}
-
 /**
  *   @brief    - Sets the custom test list buffer
  *   @param    - custom_test_list : Custom test list buffer
@@ -232,3 +235,144 @@ bool_t pal_is_test_enabled(test_id_t test_id)
 
     return strstr(g_custom_test_list, test_id_str)?1:0;
 }
+
+/**
+ *   @brief    - Reads the monotonic clock of the host
+ *   @param    - void
+ *   @return   - Time in nano seconds
+**/
+uint64_t pal_timestamp(void)
+{
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+        return 0;
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ *   @brief    - Writes machine readable test results to the files given by the
+ *               PSA_ACS_RESULTS_JSONL and PSA_ACS_RESULTS_JUNIT environment variables
+ *   @param    - format : Result file format
+ *               record : Text to append to the result file, NULL to start a new file
+ *   @return   - SUCCESS/ERROR, UNSUPPORTED_FUNC if the variable is not set
+**/
+int pal_result_write(pal_result_format_t format, const char *record)
+{
+    static FILE *result_file[2];
+    const char  *path;
+    FILE       **file;
+
+    if (format == PAL_RESULT_JSONL)
+    {
+        path = getenv("PSA_ACS_RESULTS_JSONL");
+        file = &result_file[0];
+    }
+    else if (format == PAL_RESULT_JUNIT)
+    {
+        path = getenv("PSA_ACS_RESULTS_JUNIT");
+        file = &result_file[1];
+    }
+    else
+    {
+        return PAL_STATUS_ERROR;
+    }
+
+    if (!path || !*path)
+        return PAL_STATUS_UNSUPPORTED_FUNC;
+
+    if (!record || !*file)
+    {
+        if (*file)
+            fclose(*file);
+
+        *file = fopen(path, record ? "a" : "w");
+        if (!*file)
+            return PAL_STATUS_ERROR;
+
+        if (!record)
+            return PAL_STATUS_SUCCESS;
+    }
+
+    /* One write per record, records of concurrent tests don't interleave */
+    if (fputs(record, *file) < 0 || fflush(*file) != 0)
+        return PAL_STATUS_ERROR;
+
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+ *   @brief    - Appends to the trace file given by the PSA_ACS_TRACE environment
+ *               variable
+ *   @param    - data : Data to append, NULL to start a new trace file
+ *               size : Size of the data, 0 to tell whether traces are recorded
+ *   @return   - SUCCESS/ERROR, UNSUPPORTED_FUNC if PSA_ACS_TRACE is not set
+**/
+int pal_trace_write(const void *data, size_t size)
+{
+    static int   trace_fd = -1;
+    const char  *path = getenv("PSA_ACS_TRACE");
+
+    if (!path || !*path)
+        return PAL_STATUS_UNSUPPORTED_FUNC;
+
+    if (!data || trace_fd < 0)
+    {
+        if (trace_fd >= 0)
+            close(trace_fd);
+
+        trace_fd = open(path, O_WRONLY | O_CREAT | O_APPEND | (data ? 0 : O_TRUNC), 0644);
+        if (trace_fd < 0)
+            return PAL_STATUS_ERROR;
+    }
+
+    /* One write per record, the records of the test processes don't interleave */
+    if (size && write(trace_fd, data, size) != (ssize_t)size)
+        return PAL_STATUS_ERROR;
+
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+ *   @brief    - Maps the test vector file <name>.vec of the directory given by the
+ *               PSA_ACS_VECTORS environment variable. The file stays mapped until the
+ *               process exits.
+ *   @param    - name : Name of the vector file
+ *               data : Returns the start of the mapping
+ *               size : Returns the size of the file
+ *   @return   - SUCCESS/ERROR, UNSUPPORTED_FUNC if PSA_ACS_VECTORS is not set
+**/
+int pal_vector_map(const char *name, const void **data, size_t *size)
+{
+    const char  *dir = getenv("PSA_ACS_VECTORS");
+    char         path[PATH_MAX];
+    struct stat  st;
+    void        *map;
+    int          fd;
+
+    if (!dir || !*dir)
+        return PAL_STATUS_UNSUPPORTED_FUNC;
+
+    if (snprintf(path, sizeof(path), "%s/%s.vec", dir, name) >= (int)sizeof(path))
+        return PAL_STATUS_ERROR;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return PAL_STATUS_ERROR;
+
+    if (fstat(fd, &st) != 0 || st.st_size == 0)
+    {
+        close(fd);
+        return PAL_STATUS_ERROR;
+    }
+
+    map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+        return PAL_STATUS_ERROR;
+
+    *data = map;
+    *size = (size_t)st.st_size;
+    return PAL_STATUS_SUCCESS;
+}
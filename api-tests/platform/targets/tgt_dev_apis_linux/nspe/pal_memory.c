@@ -0,0 +1,265 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <malloc.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#include "pal_common.h"
+
+/* Memory use of the tests. The heap is measured by interposing the allocator of the C
+ * library, all the functions which allocate a block released by free(), which also
+ * accounts the allocations of the PSA implementation linked in the test binary. The tests run on a stack of their own, bounded by a guard page: a test
+ * overflowing it is terminated by SIGSEGV instead of corrupting memory, and the stack
+ * is painted to measure its peak use. The allocations are also reported to the
+ * allocation profiler of the crypto suites, see pal_alloc_profile.c.
+ */
+
+/* Size of the stack the tests run on */
+#ifndef PLATFORM_TEST_STACK_SIZE
+#define PLATFORM_TEST_STACK_SIZE     (8 * 1024 * 1024)
+#endif
+
+#define PAL_STACK_PAINT              0x5AA5C33CUL
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void *__libc_memalign(size_t alignment, size_t size);
+extern void *__libc_valloc(size_t size);
+extern void *__libc_pvalloc(size_t size);
+extern void  __libc_free(void *ptr);
+
+/* Bytes allocated and their peak since the start of the running test, updated by
+ * the threads of pal_thread_run too */
+static int64_t         g_heap_in_use;
+static int64_t         g_heap_peak;
+
+static uint8_t        *g_test_stack;
+static size_t          g_test_stack_painted;
+static ucontext_t      g_test_context;
+static ucontext_t      g_caller_context;
+static pal_test_fn_t   g_test_fn;
+
+/**
+ *   @brief    - Accounts an allocation to the crypto call in flight, implemented by the
+ *               allocation profiler of the crypto suites
+ *   @param    - bytes : Bytes allocated, negative for the bytes freed
+ *   @return   - void
+**/
+__attribute__((weak)) void pal_alloc_profile_account(int64_t bytes)
+{
+    (void)bytes;
+}
+
+static void pal_heap_account(void *ptr, int sign)
+{
+    int64_t bytes, in_use, peak;
+
+    if (!ptr)
+        return;
+
+    bytes = sign * (int64_t)malloc_usable_size(ptr);
+    pal_alloc_profile_account(bytes);
+    in_use = __atomic_add_fetch(&g_heap_in_use, bytes, __ATOMIC_RELAXED);
+
+    peak = __atomic_load_n(&g_heap_peak, __ATOMIC_RELAXED);
+    while (in_use > peak &&
+           !__atomic_compare_exchange_n(&g_heap_peak, &peak, in_use, 1,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        ;
+}
+
+void *malloc(size_t size)
+{
+    void *ptr = __libc_malloc(size);
+
+    pal_heap_account(ptr, 1);
+    return ptr;
+}
+
+void *calloc(size_t count, size_t size)
+{
+    void *ptr = __libc_calloc(count, size);
+
+    pal_heap_account(ptr, 1);
+    return ptr;
+}
+
+void *realloc(void *ptr, size_t size)
+{
+    size_t old_size = ptr ? malloc_usable_size(ptr) : 0;
+    void  *new_ptr = __libc_realloc(ptr, size);
+
+    /* The old block is kept when the reallocation fails */
+    if (new_ptr || !size)
+    {
+        pal_alloc_profile_account(-(int64_t)old_size);
+        __atomic_sub_fetch(&g_heap_in_use, (int64_t)old_size, __ATOMIC_RELAXED);
+    }
+    pal_heap_account(new_ptr, 1);
+    return new_ptr;
+}
+
+void *aligned_alloc(size_t alignment, size_t size)
+{
+    void *ptr = __libc_memalign(alignment, size);
+
+    pal_heap_account(ptr, 1);
+    return ptr;
+}
+
+void *memalign(size_t alignment, size_t size)
+{
+    void *ptr = __libc_memalign(alignment, size);
+
+    pal_heap_account(ptr, 1);
+    return ptr;
+}
+
+void *valloc(size_t size)
+{
+    void *ptr = __libc_valloc(size);
+
+    pal_heap_account(ptr, 1);
+    return ptr;
+}
+
+void *pvalloc(size_t size)
+{
+    void *ptr = __libc_pvalloc(size);
+
+    pal_heap_account(ptr, 1);
+    return ptr;
+}
+
+/* The reallocarray of the C library does not go through the interposed realloc */
+void *reallocarray(void *ptr, size_t count, size_t size)
+{
+    size_t bytes;
+
+    if (__builtin_mul_overflow(count, size, &bytes))
+    {
+        errno = ENOMEM;
+        return NULL;
+    }
+
+    return realloc(ptr, bytes);
+}
+
+int posix_memalign(void **ptr, size_t alignment, size_t size)
+{
+    if (alignment % sizeof(void *) || (alignment & (alignment - 1)))
+        return EINVAL;
+
+    *ptr = __libc_memalign(alignment, size);
+    if (!*ptr)
+        return ENOMEM;
+
+    pal_heap_account(*ptr, 1);
+    return 0;
+}
+
+void free(void *ptr)
+{
+    pal_heap_account(ptr, -1);
+    __libc_free(ptr);
+}
+
+static void pal_test_trampoline(void)
+{
+    g_test_fn();
+}
+
+/**
+ *   @brief    - Runs a test on the guarded test stack and measures its peak stack use,
+ *               and its peak heap use above the allocations at its start
+ *   @param    - fn    : Test to run
+ *               usage : Returns the peak memory use of the test
+ *   @return   - SUCCESS, UNSUPPORTED_FUNC if the test stack could not be set up, the
+ *               test is then run on the current stack without measurement
+**/
+int pal_mem_watch_run(pal_test_fn_t fn, pal_mem_usage_t *usage)
+{
+    long      page = sysconf(_SC_PAGESIZE);
+    uint32_t *word;
+    int64_t   baseline;
+
+    usage->stack_bytes = 0;
+    usage->heap_bytes  = 0;
+
+    if (!g_test_stack)
+    {
+        /* The lowest page is the guard page */
+        g_test_stack = mmap(NULL, PLATFORM_TEST_STACK_SIZE + page, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (g_test_stack == MAP_FAILED || mprotect(g_test_stack, page, PROT_NONE) != 0)
+        {
+            g_test_stack = NULL;
+            fn();
+            return PAL_STATUS_UNSUPPORTED_FUNC;
+        }
+
+        g_test_stack += page;
+        g_test_stack_painted = PLATFORM_TEST_STACK_SIZE;
+    }
+
+    /* Only the part used by the previous test has to be painted again */
+    for (word = (uint32_t *)(g_test_stack + PLATFORM_TEST_STACK_SIZE - g_test_stack_painted);
+         word < (uint32_t *)(g_test_stack + PLATFORM_TEST_STACK_SIZE); word++)
+        *word = PAL_STACK_PAINT;
+
+    if (getcontext(&g_test_context) != 0)
+    {
+        fn();
+        return PAL_STATUS_UNSUPPORTED_FUNC;
+    }
+
+    g_test_context.uc_stack.ss_sp   = g_test_stack;
+    g_test_context.uc_stack.ss_size = PLATFORM_TEST_STACK_SIZE;
+    g_test_context.uc_link          = &g_caller_context;
+    makecontext(&g_test_context, pal_test_trampoline, 0);
+    g_test_fn = fn;
+
+    baseline = __atomic_load_n(&g_heap_in_use, __ATOMIC_RELAXED);
+    __atomic_store_n(&g_heap_peak, baseline, __ATOMIC_RELAXED);
+
+    if (swapcontext(&g_caller_context, &g_test_context) != 0)
+    {
+        fn();
+        return PAL_STATUS_UNSUPPORTED_FUNC;
+    }
+
+    for (word = (uint32_t *)g_test_stack;
+         word < (uint32_t *)(g_test_stack + PLATFORM_TEST_STACK_SIZE); word++)
+    {
+        if (*word != PAL_STACK_PAINT)
+            break;
+    }
+
+    g_test_stack_painted = (size_t)(g_test_stack + PLATFORM_TEST_STACK_SIZE - (uint8_t *)word);
+    usage->stack_bytes   = (uint32_t)g_test_stack_painted;
+    usage->heap_bytes    = (uint32_t)(__atomic_load_n(&g_heap_peak, __ATOMIC_RELAXED) - baseline);
+
+    return PAL_STATUS_SUCCESS;
+}
@@ -0,0 +1,187 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#define _GNU_SOURCE
+
+#include <linux/perf_event.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "pal_common.h"
+
+/* Performance counters of the test thread, read through a perf_event_open counter
+ * group so that all the counters cover the same instructions. The events are
+ * selected by the PSA_ACS_PERF_EVENTS environment variable, a comma separated list
+ * of the names below, and only count user space. Events the core does not have are
+ * left out. Set PSA_ACS_PERF_EVENTS to an empty string to disable the counters.
+ */
+#define PAL_PERF_DEFAULT_EVENTS      "cycles,instructions,branch-misses,cache-misses"
+#define PAL_PERF_CACHE(cache, op, result) \
+    ((cache) | ((op) << 8) | ((result) << 16))
+
+typedef struct {
+    const char *name;
+    uint32_t    type;
+    uint64_t    config;
+} pal_perf_event_t;
+
+static const pal_perf_event_t g_perf_events[] = {
+    {"cycles",                  PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {"instructions",            PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {"cache-references",        PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES},
+    {"cache-misses",            PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+    {"branches",                PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS},
+    {"branch-misses",           PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {"stalled-cycles-frontend", PERF_TYPE_HARDWARE, PERF_COUNT_HW_STALLED_CYCLES_FRONTEND},
+    {"stalled-cycles-backend",  PERF_TYPE_HARDWARE, PERF_COUNT_HW_STALLED_CYCLES_BACKEND},
+    {"ref-cycles",              PERF_TYPE_HARDWARE, PERF_COUNT_HW_REF_CPU_CYCLES},
+    {"L1-dcache-load-misses",   PERF_TYPE_HW_CACHE,
+        PAL_PERF_CACHE(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ,
+                       PERF_COUNT_HW_CACHE_RESULT_MISS)},
+    {"LLC-load-misses",         PERF_TYPE_HW_CACHE,
+        PAL_PERF_CACHE(PERF_COUNT_HW_CACHE_LL, PERF_COUNT_HW_CACHE_OP_READ,
+                       PERF_COUNT_HW_CACHE_RESULT_MISS)},
+    {"task-clock",              PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK},
+    {"page-faults",             PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS},
+    {"context-switches",        PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES},
+};
+
+/* Counter group, opened by the thread it counts */
+static pid_t        g_perf_owner;
+static int          g_perf_fd[PAL_PERF_MAX_COUNTERS];
+static const char  *g_perf_name[PAL_PERF_MAX_COUNTERS];
+static uint32_t     g_perf_count;
+
+/**
+ *   @brief    - Returns an event by name
+ *   @param    - name : Event name
+ *               len  : Length of the name
+ *   @return   - Event, NULL if unknown
+**/
+static const pal_perf_event_t *pal_perf_find(const char *name, size_t len)
+{
+    size_t i;
+
+    for (i = 0; i < sizeof(g_perf_events) / sizeof(g_perf_events[0]); i++)
+    {
+        if (strlen(g_perf_events[i].name) == len && !strncmp(g_perf_events[i].name, name, len))
+            return &g_perf_events[i];
+    }
+
+    return NULL;
+}
+
+/**
+ *   @brief    - Opens the counter group of the calling thread. The group of another
+ *               thread, inherited from the parent of a forked worker or test process,
+ *               is closed first.
+ *   @param    - void
+ *   @return   - void
+**/
+static void pal_perf_open(void)
+{
+    struct perf_event_attr      attr;
+    const pal_perf_event_t     *event;
+    const char                 *list = getenv("PSA_ACS_PERF_EVENTS");
+    size_t                      len;
+    int                         fd;
+
+    while (g_perf_count)
+        close(g_perf_fd[--g_perf_count]);
+
+    g_perf_owner = (pid_t)syscall(SYS_gettid);
+    if (!list)
+        list = PAL_PERF_DEFAULT_EVENTS;
+
+    while (*list && g_perf_count < PAL_PERF_MAX_COUNTERS)
+    {
+        len = strcspn(list, ", ");
+        event = pal_perf_find(list, len);
+        list += len;
+        list += strspn(list, ", ");
+        if (!event)
+            continue;
+
+        memset(&attr, 0, sizeof(attr));
+        attr.size           = sizeof(attr);
+        attr.type           = event->type;
+        attr.config         = event->config;
+        attr.disabled       = !g_perf_count;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+        attr.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                              PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1,
+                          g_perf_count ? g_perf_fd[0] : -1, PERF_FLAG_FD_CLOEXEC);
+        if (fd < 0)
+            continue;
+
+        g_perf_fd[g_perf_count]   = fd;
+        g_perf_name[g_perf_count] = event->name;
+        g_perf_count++;
+    }
+}
+
+int pal_perf_start(void)
+{
+    if (g_perf_owner != (pid_t)syscall(SYS_gettid))
+        pal_perf_open();
+
+    if (!g_perf_count)
+        return PAL_STATUS_UNSUPPORTED_FUNC;
+
+    if (ioctl(g_perf_fd[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP) ||
+        ioctl(g_perf_fd[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP))
+        return PAL_STATUS_ERROR;
+
+    return PAL_STATUS_SUCCESS;
+}
+
+int pal_perf_read(pal_perf_counts_t *counts)
+{
+    uint64_t    data[3 + PAL_PERF_MAX_COUNTERS];  /* count, time enabled, time running */
+    uint32_t    i;
+
+    counts->count = 0;
+
+    /* The counters of another thread, e.g the parent of a forked process, are not read */
+    if (!g_perf_count || g_perf_owner != (pid_t)syscall(SYS_gettid))
+        return PAL_STATUS_UNSUPPORTED_FUNC;
+
+    if (read(g_perf_fd[0], data, sizeof(data)) < (ssize_t)(3 * sizeof(uint64_t)) ||
+        data[0] != g_perf_count)
+        return PAL_STATUS_ERROR;
+
+    for (i = 0; i < g_perf_count; i++)
+    {
+        counts->name[i]  = g_perf_name[i];
+        counts->value[i] = data[3 + i];
+
+        /* The group shares the core counters with other processes, scale the counts
+         * to the whole time it was enabled.
+         */
+        if (data[2] && data[2] < data[1])
+            counts->value[i] = (uint64_t)((double)data[3 + i] * data[1] / data[2]);
+    }
+    counts->count = g_perf_count;
+
+    return PAL_STATUS_SUCCESS;
+}
@@ -0,0 +1,183 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "pal_common.h"
+
+/* Reset emulation. The test suite runs in a child process of a supervisor, and
+ * a reset of the system is the end of that process: a test requesting a reset, a
+ * crash such as a panic, or a hang killed by the emulated watchdog. The supervisor
+ * then starts a new test process, which resumes the run from the boot state kept
+ * in the nvmem, shared by the supervisor and all the test processes.
+ */
+
+/* Exit code of a test process requesting a system reset */
+#define PAL_RESET_EXIT_CODE          0x7E
+
+/* Default number of resets after which the supervisor gives up the run */
+#define PAL_RESET_DEFAULT_MAX        1000
+
+uint32_t pal_getenv_uint(const char *name, uint32_t default_value);
+uint32_t pal_get_worker_count(void);
+int pal_nvm_share(void);
+
+/* Set in the test processes started by the supervisor */
+static int g_reset_emulation;
+
+/* Emulated watchdog timeout, in seconds */
+static unsigned int g_wd_timeout_s;
+
+/**
+    @brief    - Runs the test suite in supervised test processes, when running the
+                tests sequentially and unless PSA_ACS_RESET_EMULATION is set to 0
+    @param    - exit_status : Returns the exit status of the last test process
+    @return   - 0 in a test process, or when the suite is not supervised,
+                1 in the supervisor once the suite completed
+**/
+int pal_reset_supervise(int *exit_status)
+{
+    uint32_t  max_resets = pal_getenv_uint("PSA_ACS_MAX_RESETS", PAL_RESET_DEFAULT_MAX);
+    uint32_t  resets;
+    int       status;
+    pid_t     pid;
+
+    if (!pal_getenv_uint("PSA_ACS_RESET_EMULATION", 1) || pal_get_worker_count() > 1)
+        return 0;
+
+    if (pal_nvm_share() != PAL_STATUS_SUCCESS)
+    {
+        printf("\nReset emulation unavailable, running without it\n");
+        return 0;
+    }
+
+    for (resets = 0; ; resets++)
+    {
+        fflush(stdout);
+
+        pid = fork();
+        if (pid < 0)
+        {
+            printf("\nUnable to start the test process, errno=%d\n", errno);
+            *exit_status = 1;
+            return 1;
+        }
+
+        if (pid == 0)
+        {
+            /* Keep the output of the tests up to a crash */
+            setvbuf(stdout, NULL, _IOLBF, 0);
+            g_reset_emulation = 1;
+            return 0;
+        }
+
+        while (waitpid(pid, &status, 0) < 0)
+        {
+            if (errno != EINTR)
+            {
+                *exit_status = 1;
+                return 1;
+            }
+        }
+
+        if (WIFEXITED(status) && WEXITSTATUS(status) != PAL_RESET_EXIT_CODE)
+        {
+            *exit_status = WEXITSTATUS(status);
+            return 1;
+        }
+
+        if (WIFSIGNALED(status))
+        {
+            printf("\nTest process terminated by signal %d", WTERMSIG(status));
+            printf("%s, emulating a reset\n",
+                   (WTERMSIG(status) == SIGALRM) ? " (watchdog)" : "");
+        }
+
+        if (resets == max_resets)
+        {
+            printf("\nGiving up after %u resets\n", resets);
+            *exit_status = 1;
+            return 1;
+        }
+    }
+}
+
+/**
+    @brief           - Initializes the emulated watchdog timer
+    @param           - time_us         : Time in micro seconds
+                     - timer_tick_us   : Number of ticks per micro second
+    @return          - SUCCESS/FAILURE
+**/
+int pal_wd_timer_init_ns(uint32_t time_us, uint32_t timer_tick_us)
+{
+    (void)timer_tick_us;
+    g_wd_timeout_s = (time_us + 999999) / 1000000;
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief           - Enables the emulated watchdog timer, a hung test process is
+                       killed by SIGALRM once the timeout elapsed. Only under the reset
+                       emulation, noop otherwise.
+    @param           - Void
+    @return          - SUCCESS/FAILURE
+**/
+int pal_watchdog_enable(void)
+{
+    if (g_reset_emulation && g_wd_timeout_s)
+    {
+        signal(SIGALRM, SIG_DFL);
+        alarm(g_wd_timeout_s);
+    }
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief           - Disables the emulated watchdog timer
+    @param           - Void
+    @return          - SUCCESS/FAILURE
+**/
+int pal_watchdog_disable(void)
+{
+    if (g_reset_emulation)
+        alarm(0);
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+ *   @brief    - Resets the system, by ending the test process under the reset
+ *               emulation
+ *   @param    - void
+ *   @return   - UNSUPPORTED_FUNC without the reset emulation, does not return otherwise
+**/
+int pal_system_reset(void)
+{
+    if (!g_reset_emulation)
+        return PAL_STATUS_UNSUPPORTED_FUNC;
+
+    fflush(stdout);
+    _exit(PAL_RESET_EXIT_CODE);
+}
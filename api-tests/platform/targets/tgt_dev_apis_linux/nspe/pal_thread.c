@@ -0,0 +1,108 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include "pal_common.h"
+
+/* Threads of the crypto stress benchmarks */
+
+/* Maximum number of threads run by pal_thread_run */
+#define PAL_MAX_THREADS              256
+
+typedef struct {
+    pthread_t        thread;
+    pal_thread_fn_t  fn;
+    void            *arg;
+    uint32_t         index;
+} pal_thread_t;
+
+static pal_thread_t    g_threads[PAL_MAX_THREADS];
+static pthread_mutex_t g_pal_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+    @brief    - Returns the number of online CPUs
+    @param    - void
+    @return   - Number of CPUs
+**/
+uint32_t pal_get_cpu_count(void)
+{
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (cpus <= 0)
+        return 1;
+
+    return (cpus > PAL_MAX_THREADS) ? PAL_MAX_THREADS : (uint32_t)cpus;
+}
+
+static void *pal_thread_entry(void *ctx)
+{
+    pal_thread_t *thread = ctx;
+
+    thread->fn(thread->arg, thread->index);
+
+    return NULL;
+}
+
+/**
+    @brief    - Runs a function on count POSIX threads and joins them
+    @param    - count : Number of threads
+                fn    : Function run by each thread
+                arg   : Argument passed to each thread
+    @return   - SUCCESS, or ERROR if a thread could not be created. The threads
+                already started are joined in both cases.
+**/
+int pal_thread_run(uint32_t count, pal_thread_fn_t fn, void *arg)
+{
+    uint32_t i, started;
+    int      status = PAL_STATUS_SUCCESS;
+
+    if ((count == 0) || (count > PAL_MAX_THREADS))
+        return PAL_STATUS_ERROR;
+
+    for (started = 0; started < count; started++)
+    {
+        g_threads[started].fn    = fn;
+        g_threads[started].arg   = arg;
+        g_threads[started].index = started;
+
+        if (pthread_create(&g_threads[started].thread, NULL, pal_thread_entry,
+                           &g_threads[started]) != 0)
+        {
+            status = PAL_STATUS_ERROR;
+            break;
+        }
+    }
+
+    for (i = 0; i < started; i++)
+        pthread_join(g_threads[i].thread, NULL);
+
+    return status;
+}
+
+void pal_mutex_lock(void)
+{
+    pthread_mutex_lock(&g_pal_mutex);
+}
+
+void pal_mutex_unlock(void)
+{
+    pthread_mutex_unlock(&g_pal_mutex);
+}
@@ -0,0 +1,258 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "pal_common.h"
+
+/* Each worker is a child process running exactly one test. The child output is
+ * captured in a temporary file and replayed on the dispatcher stdout once the
+ * worker completes, so the logs of concurrent tests never interleave. The result
+ * record of the test is handed back through a pipe.
+ */
+
+/* Maximum number of workers, whatever the value requested through PSA_ACS_JOBS */
+#define PAL_MAX_WORKERS              64
+
+/* Default time, in seconds, a worker may run before it is considered hung */
+#define PAL_WORKER_DEFAULT_TIMEOUT   600
+
+typedef struct {
+    pid_t pid;
+    int   result_fd;
+    FILE *log;
+} pal_worker_t;
+
+static pal_worker_t g_workers[PAL_MAX_WORKERS];
+
+/* Write end of the result pipe, only valid in a worker */
+static int g_worker_result_fd = -1;
+
+/**
+    @brief    - Reads an unsigned value from the environment
+    @param    - name          : Environment variable name
+                default_value : Value returned when the variable is unset or invalid
+    @return   - Value of the variable
+**/
+uint32_t pal_getenv_uint(const char *name, uint32_t default_value)
+{
+    const char    *str = getenv(name);
+    char          *end;
+    unsigned long  value;
+
+    if (!str || !*str)
+        return default_value;
+
+    value = strtoul(str, &end, 0);
+    if (*end != '\0')
+        return default_value;
+
+    return (uint32_t)value;
+}
+
+/**
+    @brief    - Returns the number of workers available to run tests in parallel.
+                Controlled by the PSA_ACS_JOBS environment variable, where 0 selects
+                one worker per online CPU.
+    @param    - void
+    @return   - Number of workers, 1 for sequential execution
+**/
+uint32_t pal_get_worker_count(void)
+{
+    uint32_t jobs = pal_getenv_uint("PSA_ACS_JOBS", 1);
+    long     cpus;
+
+    if (jobs == 0)
+    {
+        cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        jobs = (cpus > 0) ? (uint32_t)cpus : 1;
+    }
+
+    return (jobs > PAL_MAX_WORKERS) ? PAL_MAX_WORKERS : jobs;
+}
+
+/**
+    @brief    - Starts a worker process. The worker stdout is redirected to a private
+                log and the worker is killed by SIGALRM once PSA_ACS_TEST_TIMEOUT
+                seconds have elapsed.
+    @param    - worker : Returns the worker index
+    @return   - 0 in the worker, 1 in the dispatcher, error code otherwise
+**/
+int pal_worker_start(int32_t *worker)
+{
+    int32_t  i;
+    int      fds[2];
+    FILE    *log;
+    pid_t    pid;
+
+    for (i = 0; i < PAL_MAX_WORKERS; i++)
+    {
+        if (g_workers[i].pid == 0)
+            break;
+    }
+
+    if (i == PAL_MAX_WORKERS)
+        return PAL_STATUS_ERROR;
+
+    log = tmpfile();
+    if (!log)
+        return PAL_STATUS_ERROR;
+
+    if (pipe(fds) != 0)
+    {
+        fclose(log);
+        return PAL_STATUS_ERROR;
+    }
+
+    /* Don't let the worker inherit, and later flush, pending dispatcher output */
+    fflush(stdout);
+
+    pid = fork();
+    if (pid < 0)
+    {
+        close(fds[0]);
+        close(fds[1]);
+        fclose(log);
+        return PAL_STATUS_ERROR;
+    }
+
+    if (pid == 0)
+    {
+        close(fds[0]);
+        dup2(fileno(log), STDOUT_FILENO);
+        g_worker_result_fd = fds[1];
+        alarm(pal_getenv_uint("PSA_ACS_TEST_TIMEOUT", PAL_WORKER_DEFAULT_TIMEOUT));
+        *worker = i;
+        return 0;
+    }
+
+    close(fds[1]);
+    g_workers[i].pid       = pid;
+    g_workers[i].result_fd = fds[0];
+    g_workers[i].log       = log;
+    *worker = i;
+    return 1;
+}
+
+/**
+    @brief    - Hands the result record back to the dispatcher and terminates the worker
+    @param    - result : Result record
+                size   : Size of the result record
+    @return   - void
+**/
+void pal_worker_exit(const void *result, size_t size)
+{
+    const uint8_t *p = result;
+    ssize_t        written;
+    int            exit_code = 0;
+
+    fflush(stdout);
+
+    while (size > 0)
+    {
+        written = write(g_worker_result_fd, p, size);
+        if (written < 0 && errno == EINTR)
+            continue;
+        if (written <= 0)
+        {
+            exit_code = 1;
+            break;
+        }
+        p    += written;
+        size -= (size_t)written;
+    }
+
+    _exit(exit_code);
+}
+
+/**
+    @brief    - Waits for any worker to complete, replays its log and collects its
+                result record
+    @param    - worker : Returns the index of the completed worker
+                result : Buffer receiving the result record
+                size   : Size of the result record
+    @return   - SUCCESS/ERROR
+**/
+int pal_worker_wait(int32_t *worker, void *result, size_t size)
+{
+    int32_t  i;
+    int      wstatus;
+    pid_t    pid;
+    uint8_t *p = result;
+    size_t   received = 0;
+    ssize_t  n;
+    char     buf[512];
+    size_t   len;
+
+    do {
+        pid = waitpid(-1, &wstatus, 0);
+    } while (pid < 0 && errno == EINTR);
+
+    if (pid < 0)
+        return PAL_STATUS_ERROR;
+
+    for (i = 0; i < PAL_MAX_WORKERS; i++)
+    {
+        if (g_workers[i].pid == pid)
+            break;
+    }
+
+    if (i == PAL_MAX_WORKERS)
+        return PAL_STATUS_ERROR;
+
+    while (received < size)
+    {
+        n = read(g_workers[i].result_fd, p + received, size - received);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            break;
+        received += (size_t)n;
+    }
+
+    fflush(stdout);
+    rewind(g_workers[i].log);
+    while ((len = fread(buf, 1, sizeof(buf), g_workers[i].log)) > 0)
+        fwrite(buf, 1, len, stdout);
+    fflush(stdout);
+
+    close(g_workers[i].result_fd);
+    fclose(g_workers[i].log);
+    g_workers[i].pid = 0;
+    *worker = i;
+
+    if (WIFSIGNALED(wstatus))
+    {
+        printf("\n\tWorker terminated by signal %d%s\n", WTERMSIG(wstatus),
+               (WTERMSIG(wstatus) == SIGALRM) ? " (timeout)" : "");
+        return PAL_STATUS_ERROR;
+    }
+
+    if (!WIFEXITED(wstatus) || WEXITSTATUS(wstatus) != 0 || received != size)
+        return PAL_STATUS_ERROR;
+
+    return PAL_STATUS_SUCCESS;
+}
@@ -36,11 +36,17 @@ else()
 	list(APPEND PAL_SRC_C_NSPE
 		# driver files will be compiled as part of NSPE
 		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/pal_driver_intf.c
+		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/pal_worker.c
+		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/pal_thread.c
+		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/pal_reset.c
+		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/pal_memory.c
+		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/pal_perf.c
 	)
 endif()
-if(${SUITE} STREQUAL "CRYPTO")
+if((${SUITE} STREQUAL "CRYPTO") OR (${SUITE} STREQUAL "CRYPTO_BENCH"))
 	list(APPEND PAL_SRC_C_NSPE
 		${PSA_ROOT_DIR}/platform/targets/common/nspe/crypto/pal_crypto_intf.c
+		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/pal_alloc_profile.c
 	)
 endif()
 if(${SUITE} STREQUAL "PROTECTED_STORAGE")
@@ -73,6 +79,10 @@ endif()
 # Create NSPE library
 add_library(${PSA_TARGET_PAL_NSPE_LIB} STATIC ${PAL_SRC_C_NSPE} ${PAL_SRC_ASM_NSPE})
 
+# POSIX threads of pal_thread.c and pal_alloc_profile.c
+find_package(Threads REQUIRED)
+target_link_libraries(${PSA_TARGET_PAL_NSPE_LIB} PUBLIC Threads::Threads)
+
 # PSA Include directories
 foreach(psa_inc_path ${PSA_INCLUDE_PATHS})
 	target_include_directories(${PSA_TARGET_PAL_NSPE_LIB} PRIVATE ${psa_inc_path})
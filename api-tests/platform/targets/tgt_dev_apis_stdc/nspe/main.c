@@ -18,6 +18,7 @@
 #include <stdint.h>
 
 int32_t val_entry(void);
+int32_t val_select_tests(int argc, char **argv);
 
 /**
     @brief    - PSA C main function, used for generating tgt_dev_apis_stdc test binaries.
@@ -27,7 +28,11 @@ int32_t val_entry(void);
 **/
 int main(int argc, char **argv)
 {
-    (void)argc;
-    (void)argv;
+    int32_t status;
+
+    status = val_select_tests(argc, argv);
+    if (status)
+        return (status < 0);
+
     return val_entry();
 }
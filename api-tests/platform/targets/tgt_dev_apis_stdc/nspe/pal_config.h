@@ -103,6 +103,24 @@ typedef uint32_t            cfg_id_t;
 /* Enable custom printing for Non-secure side */
 #define BESPOKE_PRINT_NS
 
+/* pal_timestamp() counts nano seconds */
+#define PLATFORM_TIMESTAMP_TICKS_PER_US 1000
+
+/* Largest message of the crypto benchmarks, the host has memory for the full sweep */
+#define PLATFORM_BENCH_MAX_MSG_SIZE (1024 * 1024)
+
+/* Samples of the crypto latency distributions */
+#define PLATFORM_BENCH_LATENCY_SAMPLES 5000
+
+/* Bytes pushed through each multipart operation by the crypto streaming benchmark */
+#define PLATFORM_BENCH_STREAM_SIZE (256 * 1024 * 1024)
+
+/* stdout is buffered already */
+#define PLATFORM_LOG_BUFFER_SIZE 0
+
+/* The host stacks are large, the scratch arena only has to fit the test buffers */
+#define PLATFORM_SCRATCH_SIZE (64 * 1024)
+
 /* UART base address assigned */
 #define PLATFORM_UART_BASE UART_0_BASE
 
@@ -402,6 +402,20 @@
 #define ARCH_TEST_SPAKE2P_CMAC
 #define ARCH_TEST_SPAKE2P_MATTER
 
+/**
+ * \def ARCH_TEST_INTERRUPTIBLE_SIGN_HASH
+ *
+ * Enable the interruptible sign and verify hash operations.
+*/
+#define ARCH_TEST_INTERRUPTIBLE_SIGN_HASH
+
+/**
+ * \def ARCH_TEST_INTERRUPTIBLE_KEY_AGREEMENT
+ *
+ * Enable the interruptible key agreement operation, added by the 1.3 PSA Crypto API.
+*/
+//#define ARCH_TEST_INTERRUPTIBLE_KEY_AGREEMENT
+
 #include "pal_crypto_config_check.h"
 
 #endif /* _PAL_CRYPTO_CONFIG_H_ */
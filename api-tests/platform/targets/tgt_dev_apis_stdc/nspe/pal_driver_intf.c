@@ -15,12 +15,15 @@
  * limitations under the License.
 **/
 
+#define _POSIX_C_SOURCE 199309L
+
 #include <inttypes.h>
 #include <limits.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
 
 #include "pal_common.h"
 
@@ -130,6 +133,21 @@ int pal_print_ns(const char *str, int32_t data)
     return PAL_STATUS_SUCCESS;
 }
 
+/**
+    @brief    - This function sends a character to the UART TX FIFO. It carries the
+                binary frames of the tokenized log, they are written to stdout.
+    @param    - c  :  Input character
+    @return   - SUCCESS/FAILURE
+**/
+int pal_print(uint8_t c)
+{
+    if (putchar(c) == EOF)
+    {
+        return PAL_STATUS_ERROR;
+    }
+    return PAL_STATUS_SUCCESS;
+}
+
 /**
     @brief           - Initializes a hardware watchdog timer
 
@@ -194,3 +212,69 @@ int pal_system_reset(void)
 {
     return PAL_STATUS_UNSUPPORTED_FUNC;
 }
+
+/**
+ *   @brief    - Reads the monotonic clock of the host
+ *   @param    - void
+ *   @return   - Time in nano seconds
+**/
+uint64_t pal_timestamp(void)
+{
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+        return 0;
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ *   @brief    - Writes machine readable test results to the files given by the
+ *               PSA_ACS_RESULTS_JSONL and PSA_ACS_RESULTS_JUNIT environment variables
+ *   @param    - format : Result file format
+ *               record : Text to append to the result file, NULL to start a new file
+ *   @return   - SUCCESS/ERROR, UNSUPPORTED_FUNC if the variable is not set
+**/
+int pal_result_write(pal_result_format_t format, const char *record)
+{
+    static FILE *result_file[2];
+    const char  *path;
+    FILE       **file;
+
+    if (format == PAL_RESULT_JSONL)
+    {
+        path = getenv("PSA_ACS_RESULTS_JSONL");
+        file = &result_file[0];
+    }
+    else if (format == PAL_RESULT_JUNIT)
+    {
+        path = getenv("PSA_ACS_RESULTS_JUNIT");
+        file = &result_file[1];
+    }
+    else
+    {
+        return PAL_STATUS_ERROR;
+    }
+
+    if (!path || !*path)
+        return PAL_STATUS_UNSUPPORTED_FUNC;
+
+    if (!record || !*file)
+    {
+        if (*file)
+            fclose(*file);
+
+        *file = fopen(path, record ? "a" : "w");
+        if (!*file)
+            return PAL_STATUS_ERROR;
+
+        if (!record)
+            return PAL_STATUS_SUCCESS;
+    }
+
+    /* One write per record, records of concurrent tests don't interleave */
+    if (fputs(record, *file) < 0 || fflush(*file) != 0)
+        return PAL_STATUS_ERROR;
+
+    return PAL_STATUS_SUCCESS;
+}
@@ -58,6 +58,7 @@ if(${SUITE} STREQUAL "IPC")
 endif()
 
 if((${SUITE} STREQUAL "CRYPTO") OR
+   (${SUITE} STREQUAL "CRYPTO_BENCH") OR
    (${SUITE} STREQUAL "STORAGE") OR
    (${SUITE} STREQUAL "PROTECTED_STORAGE") OR
    (${SUITE} STREQUAL "INTERNAL_TRUSTED_STORAGE") OR
@@ -0,0 +1,136 @@
+#! /usr/bin/env python3
+#/** @file
+# * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+# * SPDX-License-Identifier : Apache-2.0
+# *
+# * Licensed under the Apache License, Version 2.0 (the "License");
+# * you may not use this file except in compliance with the License.
+# * You may obtain a copy of the License at
+# *
+# *  http://www.apache.org/licenses/LICENSE-2.0
+# *
+# * Unless required by applicable law or agreed to in writing, software
+# * distributed under the License is distributed on an "AS IS" BASIS,
+# * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# * See the License for the specific language governing permissions and
+# * limitations under the License.
+#**/
+
+"""
+Generate the string table of the tokenized log (-DTOKENIZED_LOG=1).
+
+Every C string literal of the given source directories is a candidate format
+string of val_print. The literals are identified by their FNV-1a hash, which the
+test suite computes at run time. The sorted hashes are written as a C array
+initialiser, the position of a hash in that array is the token sent on the wire.
+The strings are written in the same order to a JSON table, which is read by
+tools/utils/decode_log.py to reconstruct the log.
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+
+# Comments, character literals and string literals, in the order they must be matched
+C_TOKEN = re.compile(r'//[^\n]*|/\*.*?\*/|\'(?:\\.|[^\\\'\n])*\'|"((?:\\.|[^\\"\n])*)"|'
+                     r'\n[ \t]*#[ \t]*include[^\n]*', re.S)
+C_ESCAPE = re.compile(r'\\(x[0-9a-fA-F]+|[0-7]{1,3}|.)', re.S)
+C_SIMPLE_ESCAPES = {'n': '\n', 't': '\t', 'r': '\r', 'a': '\a', 'b': '\b', 'f': '\f',
+                    'v': '\v', '\\': '\\', '"': '"', "'": "'", '?': '?'}
+SOURCE_EXT = ('.c', '.h', '.inc')
+
+
+def fnv1a(data):
+    """FNV-1a 32 bit hash, as computed by val_log.c"""
+    value = 0x811C9DC5
+    for byte in data:
+        value = ((value ^ byte) * 0x01000193) & 0xFFFFFFFF
+    return value
+
+
+def unescape(literal):
+    """Returns the characters of a C string literal, escapes resolved"""
+    def replace(match):
+        esc = match.group(1)
+        if esc[0] == 'x':
+            return chr(int(esc[1:], 16) & 0xFF)
+        if esc[0] in '01234567':
+            return chr(int(esc, 8) & 0xFF)
+        return C_SIMPLE_ESCAPES.get(esc, esc)
+    return C_ESCAPE.sub(replace, literal)
+
+
+def read_literals(path):
+    """Returns the string literals of a C source, adjacent literals concatenated"""
+    with open(path, errors='replace') as src:
+        text = src.read().replace('\\\n', '')
+
+    literals = []
+    current = None
+    last_end = 0
+    for match in C_TOKEN.finditer(text):
+        between = text[last_end:match.start()]
+        last_end = match.end()
+        if match.group(1) is None:
+            if match.group(0).startswith(('/', '\n')) and not between.strip():
+                continue
+            if current is not None:
+                literals.append(current)
+            current = None
+            continue
+        if current is not None and between.strip():
+            literals.append(current)
+            current = None
+        current = (current or '') + unescape(match.group(1))
+    if current is not None:
+        literals.append(current)
+    return literals
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('inc', help="output C array initialiser of the token hashes")
+    parser.add_argument('table', help="output JSON string table")
+    parser.add_argument('dirs', nargs='+', help="source directories to scan")
+    args = parser.parse_args()
+
+    strings = {}
+    collisions = set()
+    for top in args.dirs:
+        for root, _, files in os.walk(top):
+            for name in sorted(files):
+                if not name.endswith(SOURCE_EXT):
+                    continue
+                for literal in read_literals(os.path.join(root, name)):
+                    if not literal:
+                        continue
+                    value = fnv1a(literal.encode('latin-1', 'replace'))
+                    if strings.get(value, literal) != literal:
+                        collisions.add(value)
+                    strings[value] = literal
+
+    # Colliding strings are not tokenized, the target sends them as text
+    for value in collisions:
+        del strings[value]
+    tokens = sorted(strings)
+    if not tokens:
+        sys.exit("No string literal found in %s" % " ".join(args.dirs))
+
+    with open(args.inc, 'w') as inc:
+        inc.write("/* Generated by gen_log_tokens.py, do not edit */\n")
+        for value in tokens:
+            inc.write("0x%08x,\n" % value)
+
+    with open(args.table, 'w') as table:
+        json.dump({'hash': 'fnv1a32', 'strings': [strings[v] for v in tokens]}, table,
+                  indent=0)
+        table.write('\n')
+
+    sys.stdout.write("%d log tokens, %d collisions\n" % (len(tokens), len(collisions)))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,150 @@
+#! /usr/bin/env python3
+#/** @file
+# * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+# * SPDX-License-Identifier : Apache-2.0
+# *
+# * Licensed under the Apache License, Version 2.0 (the "License");
+# * you may not use this file except in compliance with the License.
+# * You may obtain a copy of the License at
+# *
+# *  http://www.apache.org/licenses/LICENSE-2.0
+# *
+# * Unless required by applicable law or agreed to in writing, software
+# * distributed under the License is distributed on an "AS IS" BASIS,
+# * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# * See the License for the specific language governing permissions and
+# * limitations under the License.
+#**/
+
+"""
+Generate the test vector files read by val/nspe/val_vectors.c.
+
+The vectors of a test are described in JSON:
+
+    {"name": "test_c006",
+     "vectors": [{"test_desc": "Test psa_hash_compute with SHA256 algorithm\\n",
+                  "alg": {"int": "0x02000009"},
+                  "input": {"hex": "bd"},
+                  "expected_hash": {"hex": "68325720..."}}]}
+
+A JSON number or {"int": "<C integer>"} is an integer, a JSON string is a text
+and {"hex": "<bytes>"} is a byte string. The keys are the member names of the
+test data structure, the members which a vector omits keep their default.
+
+  vec     converts a JSON description to the <name>.vec file, which the Linux
+          target maps from the PSA_ACS_VECTORS directory
+  archive packs several .vec files in one image, for the flash partition of
+          the boards at PLATFORM_VECTOR_ARCHIVE_BASE
+"""
+
+import argparse
+import json
+import os
+import struct
+import sys
+
+MAGIC = 0x56415350          # "PSAV"
+ARCHIVE_MAGIC = 0x41415350  # "PSAA"
+VERSION = 1
+NAME_SIZE = 32
+MAX_FIELDS = 32
+
+TYPE_INT = 1
+TYPE_BYTES = 2
+TYPE_TEXT = 3
+
+
+def pad(data):
+    return data + b'\0' * (-len(data) % 4)
+
+
+def encode_value(field, value):
+    """Returns the type and the encoding of a vector value"""
+    if isinstance(value, bool):
+        raise ValueError("%s: booleans are not supported, use 0 or 1" % field)
+    if isinstance(value, int):
+        return TYPE_INT, struct.pack('<q', value)
+    if isinstance(value, str):
+        return TYPE_TEXT, value.encode('latin-1')
+    if isinstance(value, dict) and list(value) == ['int']:
+        number = int(str(value['int']), 0)
+        if number >= 1 << 63:
+            number -= 1 << 64
+        return TYPE_INT, struct.pack('<q', number)
+    if isinstance(value, dict) and list(value) == ['hex']:
+        return TYPE_BYTES, bytes.fromhex(value['hex'])
+    raise ValueError("%s: unsupported value %r" % (field, value))
+
+
+def build_file(desc):
+    """Returns the vector file of a JSON description"""
+    fields = []
+    for vector in desc['vectors']:
+        for field in vector:
+            if field not in fields:
+                fields.append(field)
+    if len(fields) > MAX_FIELDS:
+        raise ValueError("more than %d fields" % MAX_FIELDS)
+
+    data = struct.pack('<IHHI', MAGIC, VERSION, len(fields), len(desc['vectors']))
+    for field in fields:
+        name = field.encode('ascii')
+        data += struct.pack('<B', len(name)) + name
+    data = pad(data)
+
+    for vector in desc['vectors']:
+        items = b''
+        for field, value in vector.items():
+            kind, value = encode_value(field, value)
+            items += struct.pack('<BBHI', fields.index(field), kind, 0, len(value))
+            items += pad(value)
+        data += struct.pack('<I', len(items)) + items
+    return data
+
+
+def build_archive(paths):
+    """Returns the flash archive of vector files, named after their file names"""
+    entries = []
+    offset = 8 + len(paths) * (NAME_SIZE + 8)
+    blobs = b''
+    for path in paths:
+        name = os.path.splitext(os.path.basename(path))[0].encode('ascii')
+        if len(name) >= NAME_SIZE:
+            raise ValueError("%s: name longer than %d characters" % (path, NAME_SIZE - 1))
+        with open(path, 'rb') as vec:
+            blob = vec.read()
+        entries.append(struct.pack('<%dsII' % NAME_SIZE, name, offset + len(blobs), len(blob)))
+        blobs += pad(blob)
+    return struct.pack('<II', ARCHIVE_MAGIC, len(paths)) + b''.join(entries) + blobs
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = parser.add_subparsers(dest='command', required=True)
+    vec = sub.add_parser('vec', help="convert a JSON description to a vector file")
+    vec.add_argument('json', help="JSON description of the vectors")
+    vec.add_argument('-o', '--output', help="vector file, <name>.vec by default")
+    archive = sub.add_parser('archive', help="pack vector files in a flash image")
+    archive.add_argument('output', help="archive image")
+    archive.add_argument('files', nargs='+', help="vector files")
+    args = parser.parse_args()
+
+    try:
+        if args.command == 'vec':
+            with open(args.json) as src:
+                desc = json.load(src)
+            data = build_file(desc)
+            output = args.output or desc['name'] + '.vec'
+        else:
+            data = build_archive(args.files)
+            output = args.output
+    except (KeyError, ValueError) as err:
+        sys.exit("gen_test_vectors.py: %s" % err)
+
+    with open(output, 'wb') as out:
+        out.write(data)
+
+
+if __name__ == '__main__':
+    main()
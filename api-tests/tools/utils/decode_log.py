@@ -0,0 +1,133 @@
+#! /usr/bin/env python3
+#/** @file
+# * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+# * SPDX-License-Identifier : Apache-2.0
+# *
+# * Licensed under the Apache License, Version 2.0 (the "License");
+# * you may not use this file except in compliance with the License.
+# * You may obtain a copy of the License at
+# *
+# *  http://www.apache.org/licenses/LICENSE-2.0
+# *
+# * Unless required by applicable law or agreed to in writing, software
+# * distributed under the License is distributed on an "AS IS" BASIS,
+# * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# * See the License for the specific language governing permissions and
+# * limitations under the License.
+#**/
+
+"""
+Decode the log of a test suite built with -DTOKENIZED_LOG=1.
+
+Each print of the test suite is sent as a frame: the 0x1F byte, the token of the
+format string and the value for the format specifier, both as LEB128 varints, the
+value zigzag encoded. Token 0 is followed by the null terminated format string.
+The tokens index the string table psa_log_tokens.json generated in the build
+directory. Bytes outside of the frames, e.g the prints of the secure side, are
+copied as they are.
+"""
+
+import argparse
+import json
+import re
+import sys
+
+FRAME = 0x1F
+C_SPEC = re.compile(r'%([-+ #0]*)(\d*)(?:\.(\d+))?(?:hh|h|ll|l|z|j|t)?([diouxXcsp%])')
+
+
+class Truncated(Exception):
+    pass
+
+
+def read_varint(data, pos):
+    value = shift = 0
+    while True:
+        if pos >= len(data):
+            raise Truncated()
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return value, pos
+
+
+def c_format(fmt, value):
+    """Formats the value the way the printf of the target would"""
+    def replace(match):
+        flags, width, precision, conv = match.groups()
+        if conv == '%':
+            return '%'
+        spec = '%' + flags + width + ('.' + precision if precision else '')
+        if conv in 'ouxX':
+            return (spec + conv) % (value & 0xFFFFFFFF)
+        if conv == 'c':
+            return (spec + 'c') % chr(value & 0xFF)
+        if conv in 'sp':
+            return (spec + 's') % ('0x%x' % (value & 0xFFFFFFFF))
+        return (spec + 'd') % value
+    return C_SPEC.sub(replace, fmt)
+
+
+def decode(data, strings, out):
+    """Writes the decoded log, returns the number of bytes left in a truncated frame"""
+    pos = 0
+    while pos < len(data):
+        end = data.find(bytes([FRAME]), pos)
+        if end < 0:
+            end = len(data)
+        out.write(data[pos:end].decode('latin-1'))
+        pos = end
+        if pos == len(data):
+            break
+
+        start = pos
+        try:
+            token, pos = read_varint(data, pos + 1)
+            if token == 0:
+                end = data.find(b'\0', pos)
+                if end < 0:
+                    raise Truncated()
+                fmt = data[pos:end].decode('latin-1')
+                pos = end + 1
+            elif token <= len(strings):
+                fmt = strings[token - 1]
+            else:
+                fmt = "<unknown log token %d: %%d>" % token
+            value, pos = read_varint(data, pos)
+        except Truncated:
+            return len(data) - start
+
+        value = (value >> 1) ^ -(value & 1)
+        out.write(c_format(fmt, value))
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('table', help="psa_log_tokens.json of the build")
+    parser.add_argument('log', help="binary log captured from the target, - for stdin")
+    parser.add_argument('-o', '--output', help="decoded log file, stdout by default")
+    args = parser.parse_args()
+
+    with open(args.table) as table:
+        strings = json.load(table)['strings']
+
+    if args.log == '-':
+        data = sys.stdin.buffer.read()
+    else:
+        with open(args.log, 'rb') as log:
+            data = log.read()
+
+    out = open(args.output, 'w') if args.output else sys.stdout
+    left = decode(data, strings, out)
+    if args.output:
+        out.close()
+    if left:
+        sys.stderr.write("Log truncated in the middle of a frame, %d bytes ignored\n" % left)
+
+
+if __name__ == '__main__':
+    main()
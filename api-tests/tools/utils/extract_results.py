@@ -0,0 +1,116 @@
+#! /usr/bin/env python3
+#/** @file
+# * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+# * SPDX-License-Identifier : Apache-2.0
+# *
+# * Licensed under the Apache License, Version 2.0 (the "License");
+# * you may not use this file except in compliance with the License.
+# * You may obtain a copy of the License at
+# *
+# *  http://www.apache.org/licenses/LICENSE-2.0
+# *
+# * Unless required by applicable law or agreed to in writing, software
+# * distributed under the License is distributed on an "AS IS" BASIS,
+# * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# * See the License for the specific language governing permissions and
+# * limitations under the License.
+#**/
+
+"""
+Extract the machine readable result records from a test log.
+
+The records are printed by the test suite when built with -DRESULT_RECORDS=1,
+each one preceded by an ASCII record separator (RFC 7464). The input can also be
+a JSON Lines result file written by a host target. The records are written as
+JSON Lines and, optionally, converted into a JUnit XML report.
+"""
+
+import argparse
+import json
+import sys
+from xml.sax.saxutils import quoteattr
+
+RS = '\x1e'
+
+
+def read_records(log):
+    """Returns the records of a test log or of a JSON Lines file"""
+    records = []
+    for line in log:
+        line = line.rstrip('\r\n')
+        if RS in line:
+            line = line[line.index(RS) + 1:]
+        elif not line.startswith('{'):
+            continue
+        try:
+            records.append(json.loads(line))
+        except ValueError:
+            # Record corrupted on the console, e.g interleaved with another print
+            sys.stderr.write("Skipping malformed record: %s\n" % line)
+    return records
+
+
+def seconds(time_us):
+    return "%d.%06d" % (time_us // 1000000, time_us % 1000000)
+
+
+def write_junit(records, out):
+    """Writes the test records of the last run as a JUnit XML report"""
+    runs = [i for i, r in enumerate(records) if r.get('type') == 'run']
+    if runs:
+        records = records[runs[-1]:]
+    tests = [r for r in records if r.get('type') == 'test']
+    suite = tests[0]['suite'] if tests else 'Unknown Suite'
+
+    count = {'FAIL': 0, 'ERROR': 0, 'SKIP': 0}
+    for test in tests:
+        if test['state'] in count:
+            count[test['state']] += 1
+
+    out.write('<?xml version="1.0" encoding="UTF-8"?>\n<testsuites>\n')
+    out.write('<testsuite name=%s tests="%d" failures="%d" errors="%d" skipped="%d" time="%s">\n'
+              % (quoteattr(suite), len(tests), count['FAIL'], count['ERROR'], count['SKIP'],
+                 seconds(sum(t['duration_us'] for t in tests))))
+    for test in tests:
+        out.write('  <testcase classname=%s name=%s time="%s"'
+                  % (quoteattr(test['suite']),
+                     quoteattr("%s %s" % (test['name'], test['desc'])),
+                     seconds(test['duration_us'])))
+        if test['state'] == 'PASS':
+            out.write('/>\n')
+            continue
+        tag = {'SKIP': 'skipped', 'ERROR': 'error'}.get(test['state'], 'failure')
+        out.write('>\n    <%s message="status=0x%x check=%d checkpoint=%d"/>\n  </testcase>\n'
+                  % (tag, test['status'], test['check'], test['checkpoint']))
+    out.write('</testsuite>\n</testsuites>\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('log', help="test log or JSON Lines result file, - for stdin")
+    parser.add_argument('-o', '--jsonl', help="JSON Lines output file, stdout by default")
+    parser.add_argument('-j', '--junit', help="JUnit XML output file")
+    args = parser.parse_args()
+
+    if args.log == '-':
+        records = read_records(sys.stdin)
+    else:
+        with open(args.log, errors='replace') as log:
+            records = read_records(log)
+
+    if args.jsonl:
+        with open(args.jsonl, 'w') as out:
+            for record in records:
+                out.write(json.dumps(record) + '\n')
+    elif not args.junit:
+        for record in records:
+            sys.stdout.write(json.dumps(record) + '\n')
+
+    if args.junit:
+        with open(args.junit, 'w') as out:
+            write_junit(records, out)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,1201 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+/* Replays the trace of the PSA calls recorded by a test suite, see
+ * platform/targets/common/nspe/pal_trace.h for its format, against the PSA
+ * implementation it is linked with. Each call is issued with the recorded inputs,
+ * its status and outputs are compared with the recorded ones, and its duration with
+ * the recorded duration.
+ *
+ * Build it against the PSA implementation to compare with, with the crypto
+ * configuration of the target which recorded the trace, e.g:
+ *
+ *   cc -O2 -include <target>/nspe/pal_crypto_config.h -I<psa>/include psa_replay.c
+ *      -L<psa>/library -lmbedcrypto -o psa_replay
+ *
+ * -DREPLAY_ITS and -DREPLAY_PS replay the storage calls as well, when the
+ * implementation provides the storage APIs. The attestation calls are not replayed.
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "psa/crypto.h"
+#ifdef REPLAY_ITS
+#include "psa/internal_trusted_storage.h"
+#endif
+#ifdef REPLAY_PS
+#include "psa/protected_storage.h"
+#endif
+
+/* Same values as pal_trace.h */
+#define TRACE_MAGIC              0x54415350  /* "PSAT" */
+#define TRACE_VERSION            2
+#define TRACE_NULL               0xFFFFFFFF
+#define TRACE_TRUNCATED          0x1
+#define TRACE_HEADER_SIZE        8
+#define TRACE_RECORD_FIXED_SIZE  28
+
+#define REPLAY_MAX_ARGS          8
+#define REPLAY_MAX_BUFFER        (64 * 1024 * 1024)
+
+/* Outputs which differ from run to run, e.g random values, are not compared */
+#define REPLAY_RANDOM            0x1
+
+/* Argument of a call, as recorded and as replayed */
+typedef struct {
+    char            kind;
+    uint64_t        value;      /* Value, or size of an output buffer */
+    const uint8_t  *in;         /* Input byte string, NULL if recorded as NULL */
+    size_t          in_len;
+    int             initial;    /* Object in its initial state */
+    uint64_t        address;    /* Object address in the recording */
+    const uint8_t  *out;        /* Recorded output byte string */
+    uint32_t        out_len;    /* Its length, TRACE_NULL for a NULL buffer */
+    uint64_t        out_value;  /* Recorded output value */
+    void           *object;     /* Replayed object */
+    uint8_t        *buf;        /* Replayed output buffer */
+    size_t          length;     /* Replayed output length */
+    psa_key_id_t    key;        /* Replayed key output */
+    uint64_t        result;     /* Replayed output value */
+} replay_arg_t;
+
+/* Record being replayed */
+typedef struct {
+    uint8_t         api;
+    uint8_t         flags;
+    uint16_t        code;
+    uint64_t        start_ns;
+    uint64_t        duration_ns;
+    uint32_t        status;
+    char            name[256];
+    char            schema[256];
+    uint32_t        argc;
+    replay_arg_t    args[REPLAY_MAX_ARGS];
+} replay_record_t;
+
+typedef psa_status_t (*replay_call_t)(replay_arg_t *a);
+
+/* Replayed function and its statistics */
+typedef struct {
+    const char     *name;
+    replay_call_t   call;
+    uint32_t        flags;
+    uint64_t        calls;
+    uint64_t        status_mismatches;
+    uint64_t        output_mismatches;
+    uint64_t        unknown_keys;
+    uint64_t        truncated;
+    uint64_t        recorded_ns;
+    uint64_t        replayed_ns;
+} replay_fn_t;
+
+/* Operation, key attributes or cipher suite, identified by its recorded address */
+typedef struct {
+    char            kind;
+    uint64_t        address;
+    void           *object;
+} replay_object_t;
+
+/* Key created by the replay, identified by its recorded identifier */
+typedef struct {
+    psa_key_id_t    recorded;
+    psa_key_id_t    replayed;
+} replay_key_t;
+
+static replay_object_t *g_objects;
+static size_t           g_object_count;
+static replay_key_t    *g_keys;
+static size_t           g_key_count;
+static int              g_unknown_key;
+static int              g_verbose;
+
+static const psa_hash_operation_t           g_hash_init = PSA_HASH_OPERATION_INIT;
+static const psa_mac_operation_t            g_mac_init = PSA_MAC_OPERATION_INIT;
+static const psa_cipher_operation_t         g_cipher_init = PSA_CIPHER_OPERATION_INIT;
+static const psa_aead_operation_t           g_aead_init = PSA_AEAD_OPERATION_INIT;
+static const psa_key_derivation_operation_t g_derivation_init = PSA_KEY_DERIVATION_OPERATION_INIT;
+static const psa_pake_operation_t           g_pake_init = PSA_PAKE_OPERATION_INIT;
+static const psa_pake_cipher_suite_t        g_cipher_suite_init = PSA_PAKE_CIPHER_SUITE_INIT;
+static const psa_key_attributes_t           g_attributes_init = PSA_KEY_ATTRIBUTES_INIT;
+#ifdef ARCH_TEST_INTERRUPTIBLE_SIGN_HASH
+static const psa_sign_hash_interruptible_operation_t   g_sign_init =
+                                            PSA_SIGN_HASH_INTERRUPTIBLE_OPERATION_INIT;
+static const psa_verify_hash_interruptible_operation_t g_verify_init =
+                                            PSA_VERIFY_HASH_INTERRUPTIBLE_OPERATION_INIT;
+#endif
+#ifdef ARCH_TEST_INTERRUPTIBLE_KEY_AGREEMENT
+static const psa_key_agreement_iop_t        g_agreement_init = PSA_KEY_AGREEMENT_IOP_INIT;
+#endif
+
+/* Objects of the schema kinds and their initial values */
+static const struct {
+    char        kind;
+    size_t      size;
+    const void *init;
+} g_object_kinds[] = {
+    {'H', sizeof(g_hash_init),         &g_hash_init},
+    {'M', sizeof(g_mac_init),          &g_mac_init},
+    {'C', sizeof(g_cipher_init),       &g_cipher_init},
+    {'E', sizeof(g_aead_init),         &g_aead_init},
+    {'D', sizeof(g_derivation_init),   &g_derivation_init},
+    {'P', sizeof(g_pake_init),         &g_pake_init},
+    {'S', sizeof(g_cipher_suite_init), &g_cipher_suite_init},
+    {'T', sizeof(g_attributes_init),   &g_attributes_init},
+#ifdef ARCH_TEST_INTERRUPTIBLE_SIGN_HASH
+    {'X', sizeof(g_sign_init),         &g_sign_init},
+    {'Y', sizeof(g_verify_init),       &g_verify_init},
+#endif
+#ifdef ARCH_TEST_INTERRUPTIBLE_KEY_AGREEMENT
+    {'A', sizeof(g_agreement_init),    &g_agreement_init},
+#endif
+};
+
+/**
+    @brief    - Returns the replayed key of a recorded key identifier
+    @param    - recorded : Key identifier in the recording
+    @return   - Replayed key, the recorded identifier for the keys not created by the
+                replay, e.g the persistent keys created before the recording. These
+                are flagged in g_unknown_key.
+**/
+static psa_key_id_t replay_key(uint32_t recorded)
+{
+    size_t i;
+
+    for (i = 0; i < g_key_count; i++)
+    {
+        if (g_keys[i].recorded == recorded)
+            return g_keys[i].replayed;
+    }
+
+    if (recorded != PSA_KEY_ID_NULL)
+        g_unknown_key = 1;
+
+    return recorded;
+}
+
+/**
+    @brief    - Maps a recorded key identifier to the replayed key
+    @param    - recorded : Key identifier in the recording
+                replayed : Key created by the replay
+    @return   - void
+**/
+static void replay_key_add(psa_key_id_t recorded, psa_key_id_t replayed)
+{
+    replay_key_t *keys;
+    size_t        i;
+
+    for (i = 0; i < g_key_count; i++)
+    {
+        if (g_keys[i].recorded == recorded)
+        {
+            g_keys[i].replayed = replayed;
+            return;
+        }
+    }
+
+    keys = realloc(g_keys, (g_key_count + 1) * sizeof(*keys));
+    if (!keys)
+        return;
+
+    g_keys = keys;
+    g_keys[g_key_count].recorded = recorded;
+    g_keys[g_key_count].replayed = replayed;
+    g_key_count++;
+}
+
+/**
+    @brief    - Returns the replayed object of a recorded object, created on first use
+                and reset when the recorded one was in its initial state
+    @param    - arg : Object argument
+    @return   - Replayed object, NULL for a NULL object or out of memory
+**/
+static void *replay_object(const replay_arg_t *arg)
+{
+    replay_object_t *objects;
+    size_t           i, k;
+
+    if (!arg->address)
+        return NULL;
+
+    for (k = 0; k < sizeof(g_object_kinds) / sizeof(g_object_kinds[0]); k++)
+    {
+        if (g_object_kinds[k].kind == arg->kind)
+            break;
+    }
+    if (k == sizeof(g_object_kinds) / sizeof(g_object_kinds[0]))
+        return NULL;
+
+    for (i = 0; i < g_object_count; i++)
+    {
+        if (g_objects[i].kind == arg->kind && g_objects[i].address == arg->address)
+            break;
+    }
+
+    if (i == g_object_count)
+    {
+        objects = realloc(g_objects, (g_object_count + 1) * sizeof(*objects));
+        if (!objects)
+            return NULL;
+
+        g_objects = objects;
+        g_objects[i].kind    = arg->kind;
+        g_objects[i].address = arg->address;
+        g_objects[i].object  = malloc(g_object_kinds[k].size);
+        if (!g_objects[i].object)
+            return NULL;
+
+        g_object_count++;
+        memcpy(g_objects[i].object, g_object_kinds[k].init, g_object_kinds[k].size);
+    }
+    else if (arg->initial)
+    {
+        memcpy(g_objects[i].object, g_object_kinds[k].init, g_object_kinds[k].size);
+    }
+
+    return g_objects[i].object;
+}
+
+/**
+    @brief    - Sets the replayed key attributes to their recorded value, the setters
+                of the typed crypto table are not recorded
+    @param    - attributes : Replayed key attributes
+                value      : Recorded value, see pal_trace.h
+    @return   - void
+**/
+static void replay_attributes(psa_key_attributes_t *attributes, const uint8_t *value)
+{
+    uint32_t fields[6];
+    size_t   i;
+
+    for (i = 0; i < 6; i++)
+        fields[i] = value[4 * i] | value[4 * i + 1] << 8 | value[4 * i + 2] << 16 |
+                    (uint32_t)value[4 * i + 3] << 24;
+
+    psa_set_key_type(attributes, (psa_key_type_t)fields[0]);
+    psa_set_key_bits(attributes, fields[1]);
+    psa_set_key_usage_flags(attributes, fields[2]);
+    psa_set_key_algorithm(attributes, fields[3]);
+    if (fields[5] != PSA_KEY_ID_NULL)
+        psa_set_key_id(attributes, fields[5]);
+    psa_set_key_lifetime(attributes, fields[4]);
+}
+
+/**
+    @brief    - Destroys the keys and frees the objects of the replay, at the end of a
+                test
+    @param    - a : Unused
+    @return   - PSA_SUCCESS
+**/
+static psa_status_t replay_free_keys(replay_arg_t *a)
+{
+    size_t i;
+
+    (void)a;
+    for (i = 0; i < g_key_count; i++)
+        psa_destroy_key(g_keys[i].replayed);
+
+    for (i = 0; i < g_object_count; i++)
+        free(g_objects[i].object);
+
+    free(g_keys);
+    free(g_objects);
+    g_keys         = NULL;
+    g_key_count    = 0;
+    g_objects      = NULL;
+    g_object_count = 0;
+    return PSA_SUCCESS;
+}
+
+/* Arguments of the replayed calls, by position in the schema */
+#define U32(n)          ((uint32_t)a[n].value)
+#define U64(n)          (a[n].value)
+#define SIZE(n)         ((size_t)a[n].value)
+#define KEY(n)          replay_key(U32(n))
+#define IN(n)           a[n].in, a[n].in_len
+#define OUT(n)          a[n].buf, SIZE(n), &a[n].length
+#define FILL(n)         a[n].buf, SIZE(n)
+#define KEY_OUT(n)      &a[n].key
+#define SIZE_OUT(n)     (size_t *)&a[n].result
+#define OBJ(type, n)    ((type *)a[n].object)
+
+#define REPLAY(fn, call) \
+    static psa_status_t replay_##fn(replay_arg_t *a) { (void)a; return call; }
+#define REPLAY_VOID(fn, call) \
+    static psa_status_t replay_##fn(replay_arg_t *a) { call; return PSA_SUCCESS; }
+
+REPLAY(psa_crypto_init, psa_crypto_init())
+
+REPLAY(psa_aead_abort, psa_aead_abort(OBJ(psa_aead_operation_t, 0)))
+REPLAY(psa_aead_decrypt, psa_aead_decrypt(KEY(0), U32(1), IN(2), IN(3), IN(4), OUT(5)))
+REPLAY(psa_aead_decrypt_setup,
+       psa_aead_decrypt_setup(OBJ(psa_aead_operation_t, 0), KEY(1), U32(2)))
+REPLAY(psa_aead_encrypt, psa_aead_encrypt(KEY(0), U32(1), IN(2), IN(3), IN(4), OUT(5)))
+REPLAY(psa_aead_encrypt_setup,
+       psa_aead_encrypt_setup(OBJ(psa_aead_operation_t, 0), KEY(1), U32(2)))
+REPLAY(psa_aead_finish, psa_aead_finish(OBJ(psa_aead_operation_t, 0), OUT(1), OUT(2)))
+REPLAY(psa_aead_generate_nonce,
+       psa_aead_generate_nonce(OBJ(psa_aead_operation_t, 0), OUT(1)))
+REPLAY_VOID(psa_aead_operation_init,
+            *OBJ(psa_aead_operation_t, 0) = psa_aead_operation_init())
+REPLAY(psa_aead_set_lengths,
+       psa_aead_set_lengths(OBJ(psa_aead_operation_t, 0), SIZE(1), SIZE(2)))
+REPLAY(psa_aead_set_nonce, psa_aead_set_nonce(OBJ(psa_aead_operation_t, 0), IN(1)))
+REPLAY(psa_aead_update, psa_aead_update(OBJ(psa_aead_operation_t, 0), IN(1), OUT(2)))
+REPLAY(psa_aead_update_ad, psa_aead_update_ad(OBJ(psa_aead_operation_t, 0), IN(1)))
+REPLAY(psa_aead_verify, psa_aead_verify(OBJ(psa_aead_operation_t, 0), OUT(1), IN(2)))
+
+REPLAY(psa_asymmetric_decrypt, psa_asymmetric_decrypt(KEY(0), U32(1), IN(2), IN(3), OUT(4)))
+REPLAY(psa_asymmetric_encrypt, psa_asymmetric_encrypt(KEY(0), U32(1), IN(2), IN(3), OUT(4)))
+
+REPLAY(psa_cipher_abort, psa_cipher_abort(OBJ(psa_cipher_operation_t, 0)))
+REPLAY(psa_cipher_decrypt, psa_cipher_decrypt(KEY(0), U32(1), IN(2), OUT(3)))
+REPLAY(psa_cipher_decrypt_setup,
+       psa_cipher_decrypt_setup(OBJ(psa_cipher_operation_t, 0), KEY(1), U32(2)))
+REPLAY(psa_cipher_encrypt, psa_cipher_encrypt(KEY(0), U32(1), IN(2), OUT(3)))
+REPLAY(psa_cipher_encrypt_setup,
+       psa_cipher_encrypt_setup(OBJ(psa_cipher_operation_t, 0), KEY(1), U32(2)))
+REPLAY(psa_cipher_finish, psa_cipher_finish(OBJ(psa_cipher_operation_t, 0), OUT(1)))
+REPLAY(psa_cipher_generate_iv, psa_cipher_generate_iv(OBJ(psa_cipher_operation_t, 0), OUT(1)))
+REPLAY_VOID(psa_cipher_operation_init,
+            *OBJ(psa_cipher_operation_t, 0) = psa_cipher_operation_init())
+REPLAY(psa_cipher_set_iv, psa_cipher_set_iv(OBJ(psa_cipher_operation_t, 0), IN(1)))
+REPLAY(psa_cipher_update, psa_cipher_update(OBJ(psa_cipher_operation_t, 0), IN(1), OUT(2)))
+
+REPLAY(psa_copy_key, psa_copy_key(KEY(0), OBJ(psa_key_attributes_t, 1), KEY_OUT(2)))
+REPLAY(psa_destroy_key, psa_destroy_key(KEY(0)))
+REPLAY(psa_export_key, psa_export_key(KEY(0), OUT(1)))
+REPLAY(psa_export_public_key, psa_export_public_key(KEY(0), OUT(1)))
+REPLAY(psa_generate_key, psa_generate_key(OBJ(psa_key_attributes_t, 0), KEY_OUT(1)))
+REPLAY(psa_generate_random, psa_generate_random(FILL(0)))
+REPLAY(psa_import_key, psa_import_key(OBJ(psa_key_attributes_t, 0), IN(1), KEY_OUT(2)))
+REPLAY(psa_purge_key, psa_purge_key(KEY(0)))
+
+REPLAY_VOID(psa_get_key_algorithm,
+            a[1].result = psa_get_key_algorithm(OBJ(psa_key_attributes_t, 0)))
+REPLAY(psa_get_key_attributes, psa_get_key_attributes(KEY(0), OBJ(psa_key_attributes_t, 1)))
+REPLAY_VOID(psa_get_key_bits, a[1].result = psa_get_key_bits(OBJ(psa_key_attributes_t, 0)))
+REPLAY_VOID(psa_get_key_id, a[1].key = psa_get_key_id(OBJ(psa_key_attributes_t, 0)))
+REPLAY_VOID(psa_get_key_lifetime,
+            a[1].result = psa_get_key_lifetime(OBJ(psa_key_attributes_t, 0)))
+REPLAY_VOID(psa_get_key_type, a[1].result = psa_get_key_type(OBJ(psa_key_attributes_t, 0)))
+REPLAY_VOID(psa_get_key_usage_flags,
+            a[1].result = psa_get_key_usage_flags(OBJ(psa_key_attributes_t, 0)))
+REPLAY_VOID(psa_key_attributes_init,
+            *OBJ(psa_key_attributes_t, 0) = psa_key_attributes_init())
+REPLAY_VOID(psa_reset_key_attributes, psa_reset_key_attributes(OBJ(psa_key_attributes_t, 0)))
+REPLAY_VOID(psa_set_key_algorithm, psa_set_key_algorithm(OBJ(psa_key_attributes_t, 0), U32(1)))
+REPLAY_VOID(psa_set_key_bits, psa_set_key_bits(OBJ(psa_key_attributes_t, 0), SIZE(1)))
+REPLAY_VOID(psa_set_key_id, psa_set_key_id(OBJ(psa_key_attributes_t, 0), U32(1)))
+REPLAY_VOID(psa_set_key_lifetime, psa_set_key_lifetime(OBJ(psa_key_attributes_t, 0), U32(1)))
+REPLAY_VOID(psa_set_key_type,
+            psa_set_key_type(OBJ(psa_key_attributes_t, 0), (psa_key_type_t)U32(1)))
+REPLAY_VOID(psa_set_key_usage_flags,
+            psa_set_key_usage_flags(OBJ(psa_key_attributes_t, 0), U32(1)))
+
+REPLAY(psa_hash_abort, psa_hash_abort(OBJ(psa_hash_operation_t, 0)))
+REPLAY(psa_hash_clone, psa_hash_clone(OBJ(psa_hash_operation_t, 0), OBJ(psa_hash_operation_t, 1)))
+REPLAY(psa_hash_compare, psa_hash_compare(U32(0), IN(1), IN(2)))
+REPLAY(psa_hash_compute, psa_hash_compute(U32(0), IN(1), OUT(2)))
+REPLAY(psa_hash_finish, psa_hash_finish(OBJ(psa_hash_operation_t, 0), OUT(1)))
+REPLAY_VOID(psa_hash_operation_init,
+            *OBJ(psa_hash_operation_t, 0) = psa_hash_operation_init())
+REPLAY(psa_hash_setup, psa_hash_setup(OBJ(psa_hash_operation_t, 0), U32(1)))
+REPLAY(psa_hash_update, psa_hash_update(OBJ(psa_hash_operation_t, 0), IN(1)))
+REPLAY(psa_hash_verify, psa_hash_verify(OBJ(psa_hash_operation_t, 0), IN(1)))
+#ifdef ARCH_TEST_HASH_SUSPEND
+REPLAY(psa_hash_suspend, psa_hash_suspend(OBJ(psa_hash_operation_t, 0), OUT(1)))
+#endif
+#ifdef ARCH_TEST_HASH_RESUME
+REPLAY(psa_hash_resume, psa_hash_resume(OBJ(psa_hash_operation_t, 0), IN(1)))
+#endif
+
+REPLAY(psa_key_derivation_abort,
+       psa_key_derivation_abort(OBJ(psa_key_derivation_operation_t, 0)))
+REPLAY(psa_key_derivation_get_capacity,
+       psa_key_derivation_get_capacity(OBJ(psa_key_derivation_operation_t, 0), SIZE_OUT(1)))
+REPLAY(psa_key_derivation_input_bytes,
+       psa_key_derivation_input_bytes(OBJ(psa_key_derivation_operation_t, 0), U32(1), IN(2)))
+#ifdef ARCH_TEST_PBKDF2
+REPLAY(psa_key_derivation_input_integer,
+       psa_key_derivation_input_integer(OBJ(psa_key_derivation_operation_t, 0), U32(1), U64(2)))
+#endif
+REPLAY(psa_key_derivation_input_key,
+       psa_key_derivation_input_key(OBJ(psa_key_derivation_operation_t, 0), U32(1), KEY(2)))
+REPLAY(psa_key_derivation_key_agreement,
+       psa_key_derivation_key_agreement(OBJ(psa_key_derivation_operation_t, 0), U32(1), KEY(2),
+                                        IN(3)))
+REPLAY_VOID(psa_key_derivation_operation_init,
+            *OBJ(psa_key_derivation_operation_t, 0) = psa_key_derivation_operation_init())
+REPLAY(psa_key_derivation_output_bytes,
+       psa_key_derivation_output_bytes(OBJ(psa_key_derivation_operation_t, 0), FILL(1)))
+REPLAY(psa_key_derivation_output_key,
+       psa_key_derivation_output_key(OBJ(psa_key_attributes_t, 0),
+                                     OBJ(psa_key_derivation_operation_t, 1), KEY_OUT(2)))
+REPLAY(psa_key_derivation_verify_bytes,
+       psa_key_derivation_verify_bytes(OBJ(psa_key_derivation_operation_t, 0), IN(1)))
+REPLAY(psa_key_derivation_verify_key,
+       psa_key_derivation_verify_key(OBJ(psa_key_derivation_operation_t, 0), KEY(1)))
+REPLAY(psa_key_derivation_set_capacity,
+       psa_key_derivation_set_capacity(OBJ(psa_key_derivation_operation_t, 0), SIZE(1)))
+REPLAY(psa_key_derivation_setup,
+       psa_key_derivation_setup(OBJ(psa_key_derivation_operation_t, 0), U32(1)))
+
+REPLAY(psa_mac_abort, psa_mac_abort(OBJ(psa_mac_operation_t, 0)))
+REPLAY(psa_mac_compute, psa_mac_compute(KEY(0), U32(1), IN(2), OUT(3)))
+REPLAY_VOID(psa_mac_operation_init, *OBJ(psa_mac_operation_t, 0) = psa_mac_operation_init())
+REPLAY(psa_mac_sign_finish, psa_mac_sign_finish(OBJ(psa_mac_operation_t, 0), OUT(1)))
+REPLAY(psa_mac_sign_setup, psa_mac_sign_setup(OBJ(psa_mac_operation_t, 0), KEY(1), U32(2)))
+REPLAY(psa_mac_update, psa_mac_update(OBJ(psa_mac_operation_t, 0), IN(1)))
+REPLAY(psa_mac_verify, psa_mac_verify(KEY(0), U32(1), IN(2), IN(3)))
+REPLAY(psa_mac_verify_finish, psa_mac_verify_finish(OBJ(psa_mac_operation_t, 0), IN(1)))
+REPLAY(psa_mac_verify_setup, psa_mac_verify_setup(OBJ(psa_mac_operation_t, 0), KEY(1), U32(2)))
+
+REPLAY(psa_raw_key_agreement, psa_raw_key_agreement(U32(0), KEY(1), IN(2), OUT(3)))
+REPLAY(psa_key_agreement,
+       psa_key_agreement(KEY(0), IN(1), U32(2), OBJ(psa_key_attributes_t, 3), KEY_OUT(4)))
+REPLAY(psa_sign_hash, psa_sign_hash(KEY(0), U32(1), IN(2), OUT(3)))
+REPLAY(psa_sign_message, psa_sign_message(KEY(0), U32(1), IN(2), OUT(3)))
+REPLAY(psa_verify_hash, psa_verify_hash(KEY(0), U32(1), IN(2), IN(3)))
+REPLAY(psa_verify_message, psa_verify_message(KEY(0), U32(1), IN(2), IN(3)))
+
+#if defined(ARCH_TEST_INTERRUPTIBLE_SIGN_HASH) || defined(ARCH_TEST_INTERRUPTIBLE_KEY_AGREEMENT)
+REPLAY_VOID(psa_interruptible_get_max_ops, a[0].result = psa_interruptible_get_max_ops())
+REPLAY_VOID(psa_interruptible_set_max_ops, psa_interruptible_set_max_ops(U32(0)))
+#endif
+
+#ifdef ARCH_TEST_INTERRUPTIBLE_SIGN_HASH
+REPLAY_VOID(psa_sign_hash_interruptible_operation_init,
+            *OBJ(psa_sign_hash_interruptible_operation_t, 0) =
+                psa_sign_hash_interruptible_operation_init())
+REPLAY(psa_sign_hash_start,
+       psa_sign_hash_start(OBJ(psa_sign_hash_interruptible_operation_t, 0), KEY(1), U32(2),
+                           IN(3)))
+REPLAY(psa_sign_hash_complete,
+       psa_sign_hash_complete(OBJ(psa_sign_hash_interruptible_operation_t, 0), OUT(1)))
+REPLAY_VOID(psa_sign_hash_get_num_ops,
+            a[1].result = psa_sign_hash_get_num_ops(
+                              OBJ(psa_sign_hash_interruptible_operation_t, 0)))
+REPLAY(psa_sign_hash_abort,
+       psa_sign_hash_abort(OBJ(psa_sign_hash_interruptible_operation_t, 0)))
+REPLAY_VOID(psa_verify_hash_interruptible_operation_init,
+            *OBJ(psa_verify_hash_interruptible_operation_t, 0) =
+                psa_verify_hash_interruptible_operation_init())
+REPLAY(psa_verify_hash_start,
+       psa_verify_hash_start(OBJ(psa_verify_hash_interruptible_operation_t, 0), KEY(1), U32(2),
+                             IN(3), IN(4)))
+REPLAY(psa_verify_hash_complete,
+       psa_verify_hash_complete(OBJ(psa_verify_hash_interruptible_operation_t, 0)))
+REPLAY_VOID(psa_verify_hash_get_num_ops,
+            a[1].result = psa_verify_hash_get_num_ops(
+                              OBJ(psa_verify_hash_interruptible_operation_t, 0)))
+REPLAY(psa_verify_hash_abort,
+       psa_verify_hash_abort(OBJ(psa_verify_hash_interruptible_operation_t, 0)))
+#endif
+
+#ifdef ARCH_TEST_INTERRUPTIBLE_KEY_AGREEMENT
+REPLAY_VOID(psa_key_agreement_iop_init,
+            *OBJ(psa_key_agreement_iop_t, 0) = psa_key_agreement_iop_init())
+REPLAY(psa_key_agreement_iop_setup,
+       psa_key_agreement_iop_setup(OBJ(psa_key_agreement_iop_t, 0), KEY(1), IN(2), U32(3),
+                                   OBJ(psa_key_attributes_t, 4)))
+REPLAY(psa_key_agreement_iop_complete,
+       psa_key_agreement_iop_complete(OBJ(psa_key_agreement_iop_t, 0), KEY_OUT(1)))
+REPLAY_VOID(psa_key_agreement_iop_get_num_ops,
+            a[1].result = psa_key_agreement_iop_get_num_ops(OBJ(psa_key_agreement_iop_t, 0)))
+REPLAY(psa_key_agreement_iop_abort, psa_key_agreement_iop_abort(OBJ(psa_key_agreement_iop_t, 0)))
+#endif
+
+REPLAY_VOID(psa_pake_operation_init,
+            *OBJ(psa_pake_operation_t, 0) = psa_pake_operation_init())
+REPLAY_VOID(psa_pake_cs_set_algorithm,
+            psa_pake_cs_set_algorithm(OBJ(psa_pake_cipher_suite_t, 0), U32(1)))
+REPLAY_VOID(psa_pake_cs_set_primitive,
+            psa_pake_cs_set_primitive(OBJ(psa_pake_cipher_suite_t, 0), U32(1)))
+REPLAY_VOID(psa_pake_cs_set_key_confirmation,
+            psa_pake_cs_set_key_confirmation(OBJ(psa_pake_cipher_suite_t, 0), U32(1)))
+REPLAY(psa_pake_setup,
+       psa_pake_setup(OBJ(psa_pake_operation_t, 0), KEY(1), OBJ(psa_pake_cipher_suite_t, 2)))
+REPLAY(psa_pake_set_role, psa_pake_set_role(OBJ(psa_pake_operation_t, 0), U32(1)))
+REPLAY(psa_pake_set_user, psa_pake_set_user(OBJ(psa_pake_operation_t, 0), IN(1)))
+REPLAY(psa_pake_set_peer, psa_pake_set_peer(OBJ(psa_pake_operation_t, 0), IN(1)))
+REPLAY(psa_pake_set_context, psa_pake_set_context(OBJ(psa_pake_operation_t, 0), IN(1)))
+REPLAY(psa_pake_output, psa_pake_output(OBJ(psa_pake_operation_t, 0), U32(1), OUT(2)))
+REPLAY(psa_pake_input, psa_pake_input(OBJ(psa_pake_operation_t, 0), U32(1), IN(2)))
+REPLAY(psa_pake_get_shared_key,
+       psa_pake_get_shared_key(OBJ(psa_pake_operation_t, 0), OBJ(psa_key_attributes_t, 1),
+                               KEY_OUT(2)))
+REPLAY(psa_pake_abort, psa_pake_abort(OBJ(psa_pake_operation_t, 0)))
+
+#ifdef REPLAY_ITS
+REPLAY(psa_its_set, psa_its_set(U64(0), (uint32_t)a[1].in_len, a[1].in, U32(2)))
+REPLAY(psa_its_get, psa_its_get(U64(0), U32(1), U32(2), a[2].buf, &a[2].length))
+static psa_status_t replay_psa_its_get_info(replay_arg_t *a)
+{
+    struct psa_storage_info_t info;
+
+    return psa_its_get_info(U64(0), &info);
+}
+REPLAY(psa_its_remove, psa_its_remove(U64(0)))
+#endif
+
+#ifdef REPLAY_PS
+REPLAY(psa_ps_set, psa_ps_set(U64(0), (uint32_t)a[1].in_len, a[1].in, U32(2)))
+REPLAY(psa_ps_get, psa_ps_get(U64(0), U32(1), U32(2), a[2].buf, &a[2].length))
+static psa_status_t replay_psa_ps_get_info(replay_arg_t *a)
+{
+    struct psa_storage_info_t info;
+
+    return psa_ps_get_info(U64(0), &info);
+}
+REPLAY(psa_ps_remove, psa_ps_remove(U64(0)))
+REPLAY(psa_ps_create, psa_ps_create(U64(0), U32(1), U32(2)))
+REPLAY(psa_ps_set_extended,
+       psa_ps_set_extended(U64(0), U32(1), (uint32_t)a[2].in_len, a[2].in))
+REPLAY(psa_ps_get_support, (psa_status_t)psa_ps_get_support())
+#endif
+
+#define FN(name, flags)  {#name, replay_##name, flags, 0, 0, 0, 0, 0, 0}
+
+static replay_fn_t g_functions[] = {
+    {"pal_crypto_free_keys", replay_free_keys, 0, 0, 0, 0, 0, 0, 0},
+    FN(psa_crypto_init, 0),
+    FN(psa_aead_abort, 0),
+    FN(psa_aead_decrypt, 0),
+    FN(psa_aead_decrypt_setup, 0),
+    FN(psa_aead_encrypt, 0),
+    FN(psa_aead_encrypt_setup, 0),
+    FN(psa_aead_finish, 0),
+    FN(psa_aead_generate_nonce, REPLAY_RANDOM),
+    FN(psa_aead_operation_init, 0),
+    FN(psa_aead_set_lengths, 0),
+    FN(psa_aead_set_nonce, 0),
+    FN(psa_aead_update, 0),
+    FN(psa_aead_update_ad, 0),
+    FN(psa_aead_verify, 0),
+    FN(psa_asymmetric_decrypt, 0),
+    FN(psa_asymmetric_encrypt, REPLAY_RANDOM),
+    FN(psa_cipher_abort, 0),
+    FN(psa_cipher_decrypt, 0),
+    FN(psa_cipher_decrypt_setup, 0),
+    FN(psa_cipher_encrypt, REPLAY_RANDOM),
+    FN(psa_cipher_encrypt_setup, 0),
+    FN(psa_cipher_finish, 0),
+    FN(psa_cipher_generate_iv, REPLAY_RANDOM),
+    FN(psa_cipher_operation_init, 0),
+    FN(psa_cipher_set_iv, 0),
+    FN(psa_cipher_update, 0),
+    FN(psa_copy_key, 0),
+    FN(psa_destroy_key, 0),
+    FN(psa_export_key, 0),
+    FN(psa_export_public_key, 0),
+    FN(psa_generate_key, 0),
+    FN(psa_generate_random, REPLAY_RANDOM),
+    FN(psa_import_key, 0),
+    FN(psa_purge_key, 0),
+    FN(psa_get_key_algorithm, 0),
+    FN(psa_get_key_attributes, 0),
+    FN(psa_get_key_bits, 0),
+    FN(psa_get_key_id, 0),
+    FN(psa_get_key_lifetime, 0),
+    FN(psa_get_key_type, 0),
+    FN(psa_get_key_usage_flags, 0),
+    FN(psa_key_attributes_init, 0),
+    FN(psa_reset_key_attributes, 0),
+    FN(psa_set_key_algorithm, 0),
+    FN(psa_set_key_bits, 0),
+    FN(psa_set_key_id, 0),
+    FN(psa_set_key_lifetime, 0),
+    FN(psa_set_key_type, 0),
+    FN(psa_set_key_usage_flags, 0),
+    FN(psa_hash_abort, 0),
+    FN(psa_hash_clone, 0),
+    FN(psa_hash_compare, 0),
+    FN(psa_hash_compute, 0),
+    FN(psa_hash_finish, 0),
+    FN(psa_hash_operation_init, 0),
+    FN(psa_hash_setup, 0),
+    FN(psa_hash_update, 0),
+    FN(psa_hash_verify, 0),
+#ifdef ARCH_TEST_HASH_SUSPEND
+    FN(psa_hash_suspend, 0),
+#endif
+#ifdef ARCH_TEST_HASH_RESUME
+    FN(psa_hash_resume, 0),
+#endif
+    FN(psa_key_derivation_abort, 0),
+    FN(psa_key_derivation_get_capacity, 0),
+    FN(psa_key_derivation_input_bytes, 0),
+#ifdef ARCH_TEST_PBKDF2
+    FN(psa_key_derivation_input_integer, 0),
+#endif
+    FN(psa_key_derivation_input_key, 0),
+    FN(psa_key_derivation_key_agreement, 0),
+    FN(psa_key_derivation_operation_init, 0),
+    FN(psa_key_derivation_output_bytes, 0),
+    FN(psa_key_derivation_output_key, 0),
+    FN(psa_key_derivation_verify_bytes, 0),
+    FN(psa_key_derivation_verify_key, 0),
+    FN(psa_key_derivation_set_capacity, 0),
+    FN(psa_key_derivation_setup, 0),
+    FN(psa_mac_abort, 0),
+    FN(psa_mac_compute, 0),
+    FN(psa_mac_operation_init, 0),
+    FN(psa_mac_sign_finish, 0),
+    FN(psa_mac_sign_setup, 0),
+    FN(psa_mac_update, 0),
+    FN(psa_mac_verify, 0),
+    FN(psa_mac_verify_finish, 0),
+    FN(psa_mac_verify_setup, 0),
+    FN(psa_raw_key_agreement, 0),
+    FN(psa_key_agreement, 0),
+    FN(psa_sign_hash, REPLAY_RANDOM),
+    FN(psa_sign_message, REPLAY_RANDOM),
+    FN(psa_verify_hash, 0),
+    FN(psa_verify_message, 0),
+#if defined(ARCH_TEST_INTERRUPTIBLE_SIGN_HASH) || defined(ARCH_TEST_INTERRUPTIBLE_KEY_AGREEMENT)
+    FN(psa_interruptible_get_max_ops, 0),
+    FN(psa_interruptible_set_max_ops, 0),
+#endif
+#ifdef ARCH_TEST_INTERRUPTIBLE_SIGN_HASH
+    FN(psa_sign_hash_interruptible_operation_init, 0),
+    FN(psa_sign_hash_start, 0),
+    FN(psa_sign_hash_complete, REPLAY_RANDOM),
+    FN(psa_sign_hash_get_num_ops, 0),
+    FN(psa_sign_hash_abort, 0),
+    FN(psa_verify_hash_interruptible_operation_init, 0),
+    FN(psa_verify_hash_start, 0),
+    FN(psa_verify_hash_complete, 0),
+    FN(psa_verify_hash_get_num_ops, 0),
+    FN(psa_verify_hash_abort, 0),
+#endif
+#ifdef ARCH_TEST_INTERRUPTIBLE_KEY_AGREEMENT
+    FN(psa_key_agreement_iop_init, 0),
+    FN(psa_key_agreement_iop_setup, 0),
+    FN(psa_key_agreement_iop_complete, 0),
+    FN(psa_key_agreement_iop_get_num_ops, 0),
+    FN(psa_key_agreement_iop_abort, 0),
+#endif
+    FN(psa_pake_operation_init, 0),
+    FN(psa_pake_cs_set_algorithm, 0),
+    FN(psa_pake_cs_set_primitive, 0),
+    FN(psa_pake_cs_set_key_confirmation, 0),
+    FN(psa_pake_setup, 0),
+    FN(psa_pake_set_role, 0),
+    FN(psa_pake_set_user, 0),
+    FN(psa_pake_set_peer, 0),
+    FN(psa_pake_set_context, 0),
+    FN(psa_pake_output, REPLAY_RANDOM),
+    FN(psa_pake_input, 0),
+    FN(psa_pake_get_shared_key, 0),
+    FN(psa_pake_abort, 0),
+#ifdef REPLAY_ITS
+    FN(psa_its_set, 0),
+    FN(psa_its_get, 0),
+    FN(psa_its_get_info, 0),
+    FN(psa_its_remove, 0),
+#endif
+#ifdef REPLAY_PS
+    FN(psa_ps_set, 0),
+    FN(psa_ps_get, 0),
+    FN(psa_ps_get_info, 0),
+    FN(psa_ps_remove, 0),
+    FN(psa_ps_create, 0),
+    FN(psa_ps_set_extended, 0),
+    FN(psa_ps_get_support, 0),
+#endif
+};
+
+/* Reader of the trace */
+typedef struct {
+    const uint8_t  *data;
+    size_t          size;
+    size_t          pos;
+    int             error;
+} replay_reader_t;
+
+static uint64_t replay_get(replay_reader_t *r, uint32_t size)
+{
+    uint64_t value = 0;
+    uint32_t i;
+
+    if (r->error || size > r->size - r->pos)
+    {
+        r->error = 1;
+        return 0;
+    }
+
+    for (i = 0; i < size; i++)
+        value |= (uint64_t)r->data[r->pos + i] << (8 * i);
+
+    r->pos += size;
+    return value;
+}
+
+static const uint8_t *replay_get_data(replay_reader_t *r, uint32_t *length)
+{
+    const uint8_t *data;
+
+    *length = (uint32_t)replay_get(r, 4);
+    if (r->error || *length == TRACE_NULL)
+        return NULL;
+
+    if (*length > r->size - r->pos)
+    {
+        r->error = 1;
+        return NULL;
+    }
+
+    data = r->data + r->pos;
+    r->pos += *length;
+    return data;
+}
+
+static void replay_get_str(replay_reader_t *r, char *str)
+{
+    uint32_t len = (uint32_t)replay_get(r, 1);
+
+    if (r->error || len > r->size - r->pos)
+    {
+        r->error = 1;
+        len = 0;
+    }
+
+    memcpy(str, r->data + r->pos, len);
+    str[len] = '\0';
+    r->pos += len;
+}
+
+/**
+    @brief    - Decodes a record of the trace
+    @param    - data   : Record, starting with its size
+                size   : Size of the record
+                record : Returns the decoded record
+    @return   - 0 on success, -1 if the record is malformed
+**/
+static int replay_decode(const uint8_t *data, size_t size, replay_record_t *record)
+{
+    replay_reader_t  r = {data, size, 4, 0};
+    replay_arg_t    *arg;
+    const char      *kind;
+    uint32_t         len;
+
+    memset(record, 0, sizeof(*record));
+    record->api         = (uint8_t)replay_get(&r, 1);
+    record->flags       = (uint8_t)replay_get(&r, 1);
+    record->code        = (uint16_t)replay_get(&r, 2);
+    record->start_ns    = replay_get(&r, 8);
+    record->duration_ns = replay_get(&r, 8);
+    record->status      = (uint32_t)replay_get(&r, 4);
+    replay_get_str(&r, record->name);
+    replay_get_str(&r, record->schema);
+
+    if (strlen(record->schema) > REPLAY_MAX_ARGS)
+        return -1;
+
+    for (kind = record->schema; *kind && !r.error; kind++)
+    {
+        arg = &record->args[record->argc++];
+        arg->kind = *kind;
+        switch (*kind)
+        {
+            case 'v':
+            case 'k':
+                arg->value = replay_get(&r, 4);
+                break;
+            case 'z':
+            case 'q':
+            case 'o':
+            case 'O':
+            case 'b':
+                arg->value = replay_get(&r, 8);
+                break;
+            case 'i':
+            case 'I':
+                arg->in     = replay_get_data(&r, &len);
+                arg->in_len = (len == TRACE_NULL) ? 0 : len;
+                break;
+            case 'K':
+            case 'V':
+            case 'W':
+            case 'Z':
+            case 'n':
+                break;
+            default:
+                arg->initial = (int)replay_get(&r, 1);
+                arg->address = replay_get(&r, 8);
+                arg->in      = replay_get_data(&r, &len);
+                arg->in_len  = (len == TRACE_NULL) ? 0 : len;
+                break;
+        }
+    }
+
+    for (arg = record->args; arg < record->args + record->argc && !r.error; arg++)
+    {
+        switch (arg->kind)
+        {
+            case 'o':
+            case 'O':
+            case 'b':
+                arg->out = replay_get_data(&r, &arg->out_len);
+                break;
+            case 'K':
+            case 'V':
+            case 'W':
+                arg->out_value = replay_get(&r, 4);
+                break;
+            case 'Z':
+                arg->out_value = replay_get(&r, 8);
+                break;
+            default:
+                break;
+        }
+    }
+
+    return r.error ? -1 : 0;
+}
+
+static uint64_t replay_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static replay_fn_t *replay_find(const char *name)
+{
+    size_t i;
+
+    for (i = 0; i < sizeof(g_functions) / sizeof(g_functions[0]); i++)
+    {
+        if (!strcmp(g_functions[i].name, name))
+            return &g_functions[i];
+    }
+
+    return NULL;
+}
+
+/**
+    @brief    - Issues the call of a record and compares its status and outputs with
+                the recorded ones
+    @param    - record : Decoded record
+                index  : Index of the record in the trace, for the messages
+    @return   - 0 if the call was replayed, -1 if the function is not replayed or
+                its buffers could not be allocated
+**/
+static int replay_call(replay_record_t *record, uint64_t index)
+{
+    replay_fn_t     *fn = replay_find(record->name);
+    replay_arg_t    *arg;
+    psa_status_t     status;
+    uint64_t         start;
+    int              compare, mismatch = 0, ret = 0;
+
+    if (!fn)
+        return -1;
+
+    for (arg = record->args; arg < record->args + record->argc; arg++)
+    {
+        if (strchr("oOb", arg->kind) && arg->out_len != TRACE_NULL)
+        {
+            /* Buffers larger than the host can provide are not replayed */
+            arg->buf = (arg->value <= REPLAY_MAX_BUFFER) ?
+                       malloc(arg->value ? (size_t)arg->value : 1) : NULL;
+            if (!arg->buf)
+            {
+                ret = -1;
+                goto free;
+            }
+        }
+        else if (strchr("HMCEDPSTXYA", arg->kind))
+        {
+            arg->object = replay_object(arg);
+            if (arg->address && !arg->object)
+            {
+                ret = -1;
+                goto free;
+            }
+
+            if (arg->kind == 'T' && arg->object && arg->in_len == 24)
+                replay_attributes(arg->object, arg->in);
+        }
+    }
+
+    g_unknown_key = 0;
+    start  = replay_now_ns();
+    status = fn->call(record->args);
+    fn->replayed_ns += replay_now_ns() - start;
+    fn->recorded_ns += record->duration_ns;
+    fn->calls++;
+
+    /* A key the recording used successfully, but whose creation was not recorded */
+    if (g_unknown_key && record->status == PSA_SUCCESS)
+    {
+        fn->unknown_keys++;
+        if (g_verbose)
+            printf("#%" PRIu64 " %s: key not created by the recorded calls\n", index,
+                   record->name);
+    }
+
+    if ((uint32_t)status != record->status)
+    {
+        fn->status_mismatches++;
+        if (g_verbose)
+            printf("#%" PRIu64 " %s: status %d, recorded %d\n", index, record->name,
+                   (int)status, (int32_t)record->status);
+    }
+
+    compare = !status && !record->status && !(fn->flags & REPLAY_RANDOM);
+    if (record->flags & TRACE_TRUNCATED)
+    {
+        fn->truncated++;
+        compare = 0;
+    }
+
+    for (arg = record->args; arg < record->args + record->argc; arg++)
+    {
+        if (arg->kind == 'K' && !status)
+            replay_key_add((psa_key_id_t)arg->out_value, arg->key);
+
+        if (!compare)
+            continue;
+
+        switch (arg->kind)
+        {
+            case 'o':
+            case 'O':
+                if (arg->buf && (arg->length != arg->out_len ||
+                                 memcmp(arg->buf, arg->out, arg->length)))
+                    mismatch = 1;
+                break;
+            case 'b':
+                if (arg->buf && memcmp(arg->buf, arg->out, arg->out_len))
+                    mismatch = 1;
+                break;
+            case 'V':
+            case 'W':
+            case 'Z':
+                if (arg->result != arg->out_value)
+                    mismatch = 1;
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (mismatch)
+    {
+        fn->output_mismatches++;
+        if (g_verbose)
+            printf("#%" PRIu64 " %s: output differs from the recording\n", index,
+                   record->name);
+    }
+
+free:
+    for (arg = record->args; arg < record->args + record->argc; arg++)
+        free(arg->buf);
+
+    return ret;
+}
+
+/**
+    @brief    - Prints a record of the trace
+    @param    - record : Decoded record
+                index  : Index of the record in the trace
+    @return   - void
+**/
+static void replay_dump(const replay_record_t *record, uint64_t index)
+{
+    const replay_arg_t *arg;
+
+    printf("#%" PRIu64 " %12" PRIu64 " ns %10" PRIu64 " ns %s(", index, record->start_ns,
+           record->duration_ns, record->name);
+    for (arg = record->args; arg < record->args + record->argc; arg++)
+    {
+        if (arg != record->args)
+            printf(", ");
+
+        switch (arg->kind)
+        {
+            case 'v':
+            case 'k':
+            case 'z':
+            case 'q':
+                printf("0x%" PRIx64, arg->value);
+                break;
+            case 'i':
+            case 'I':
+                if (arg->in)
+                    printf("in[%zu]", arg->in_len);
+                else
+                    printf("NULL");
+                break;
+            case 'o':
+            case 'O':
+            case 'b':
+                if (arg->out_len == TRACE_NULL)
+                    printf("NULL");
+                else
+                    printf("out[%" PRIu32 "/%" PRIu64 "]", arg->out_len, arg->value);
+                break;
+            case 'K':
+            case 'V':
+            case 'W':
+            case 'Z':
+                printf("&0x%" PRIx64, arg->out_value);
+                break;
+            case 'n':
+                printf("&..");
+                break;
+            default:
+                printf("%c@0x%" PRIx64 "%s", arg->kind, arg->address,
+                       arg->initial ? "(init)" : "");
+                break;
+        }
+    }
+
+    printf(") = %d%s\n", (int32_t)record->status,
+           (record->flags & TRACE_TRUNCATED) ? " truncated" : "");
+}
+
+static void replay_usage(const char *prog)
+{
+    fprintf(stderr, "Usage: %s [-v] [-d] <trace>\n"
+                    "  -v  prints the calls which differ from the recording\n"
+                    "  -d  prints the recorded calls without replaying them\n", prog);
+}
+
+int main(int argc, char **argv)
+{
+    static replay_record_t  record;
+    const char             *path = NULL;
+    uint8_t                *data = NULL;
+    size_t                  size = 0, capacity = 0, pos, n;
+    uint64_t                index = 0, skipped = 0, mismatches = 0, unknown_keys = 0;
+    uint32_t                record_size;
+    replay_fn_t            *fn;
+    FILE                   *file;
+    int                     dump = 0, i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "-v"))
+            g_verbose = 1;
+        else if (!strcmp(argv[i], "-d"))
+            dump = 1;
+        else if (argv[i][0] != '-' && !path)
+            path = argv[i];
+        else
+        {
+            replay_usage(argv[0]);
+            return 2;
+        }
+    }
+
+    if (!path)
+    {
+        replay_usage(argv[0]);
+        return 2;
+    }
+
+    file = fopen(path, "rb");
+    if (!file)
+    {
+        perror(path);
+        return 2;
+    }
+
+    do
+    {
+        if (size == capacity)
+        {
+            capacity = capacity ? capacity * 2 : 1024 * 1024;
+            data = realloc(data, capacity);
+            if (!data)
+            {
+                fprintf(stderr, "Out of memory\n");
+                return 2;
+            }
+        }
+        n = fread(data + size, 1, capacity - size, file);
+        size += n;
+    } while (n);
+    fclose(file);
+
+    if (size < TRACE_HEADER_SIZE ||
+        (data[0] | data[1] << 8 | data[2] << 16 | (uint32_t)data[3] << 24) != TRACE_MAGIC ||
+        (data[4] | data[5] << 8) != TRACE_VERSION)
+    {
+        fprintf(stderr, "%s is not a PSA call trace of version %d\n", path, TRACE_VERSION);
+        return 2;
+    }
+
+    if (!dump && psa_crypto_init() != PSA_SUCCESS)
+    {
+        fprintf(stderr, "psa_crypto_init failed\n");
+        return 2;
+    }
+
+    for (pos = TRACE_HEADER_SIZE; pos < size; pos += record_size, index++)
+    {
+        record_size = size - pos < 4 ? 0 : (uint32_t)(data[pos] | data[pos + 1] << 8 |
+                                                      data[pos + 2] << 16 |
+                                                      (uint32_t)data[pos + 3] << 24);
+        if (record_size < TRACE_RECORD_FIXED_SIZE || record_size > size - pos ||
+            replay_decode(data + pos, record_size, &record) != 0)
+        {
+            fprintf(stderr, "Malformed record #%" PRIu64 " at offset %zu\n", index, pos);
+            break;
+        }
+
+        if (dump)
+            replay_dump(&record, index);
+        else if (replay_call(&record, index) != 0)
+            skipped++;
+    }
+
+    if (dump)
+        return 0;
+
+    replay_free_keys(NULL);
+
+    printf("%-36s %8s %8s %8s %8s %14s %14s\n", "Function", "Calls", "Status", "Output",
+           "Keys", "Recorded us", "Replayed us");
+    for (fn = g_functions; fn < g_functions + sizeof(g_functions) / sizeof(g_functions[0]);
+         fn++)
+    {
+        if (!fn->calls)
+            continue;
+
+        printf("%-36s %8" PRIu64 " %8" PRIu64 " %8" PRIu64 " %8" PRIu64 " %14.1f %14.1f%s\n",
+               fn->name, fn->calls, fn->status_mismatches, fn->output_mismatches,
+               fn->unknown_keys, fn->recorded_ns / 1000.0, fn->replayed_ns / 1000.0,
+               fn->truncated ? " (truncated records not compared)" : "");
+        mismatches   += fn->status_mismatches;
+        unknown_keys += fn->unknown_keys;
+    }
+
+    printf("%" PRIu64 " records, %" PRIu64 " not replayed, %" PRIu64 " status mismatches, %"
+           PRIu64 " uses of unknown keys\n", index, skipped, mismatches, unknown_keys);
+    free(data);
+    return (mismatches || unknown_keys) ? 1 : 0;
+}
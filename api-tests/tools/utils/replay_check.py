@@ -0,0 +1,111 @@
+#! /usr/bin/env python3
+#/** @file
+# * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+# * SPDX-License-Identifier : Apache-2.0
+# *
+# * Licensed under the Apache License, Version 2.0 (the "License");
+# * you may not use this file except in compliance with the License.
+# * You may obtain a copy of the License at
+# *
+# *  http://www.apache.org/licenses/LICENSE-2.0
+# *
+# * Unless required by applicable law or agreed to in writing, software
+# * distributed under the License is distributed on an "AS IS" BASIS,
+# * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# * See the License for the specific language governing permissions and
+# * limitations under the License.
+#**/
+
+"""
+Check that the trace of a crypto suite run replays without error.
+
+Runs the crypto suite of tgt_dev_apis_linux with PSA_ACS_TRACE set, checks that the
+trace holds successful calls using RSA or ECC keys, which the tests create through
+the typed crypto table val->crypto, and replays it with psa_replay. The check
+fails if psa_replay reports a status which differs from the recording or a key
+whose creation was not recorded.
+"""
+
+import argparse
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+
+TRACE_MAGIC = 0x54415350
+TRACE_VERSION = 2
+TRACE_HEADER_SIZE = 8
+TRACE_RECORD_FIXED_SIZE = 28
+
+# Calls which use an asymmetric key
+ASYMMETRIC_CALLS = (
+    'psa_sign_hash', 'psa_verify_hash', 'psa_sign_message', 'psa_verify_message',
+    'psa_asymmetric_encrypt', 'psa_asymmetric_decrypt', 'psa_raw_key_agreement',
+    'psa_export_public_key',
+)
+
+
+def read_calls(path):
+    """Returns the name and status of the records of a trace"""
+    with open(path, 'rb') as trace:
+        data = trace.read()
+
+    if len(data) < TRACE_HEADER_SIZE:
+        raise ValueError("%s is not a PSA call trace" % path)
+    magic, version = struct.unpack_from('<IH', data)
+    if magic != TRACE_MAGIC or version != TRACE_VERSION:
+        raise ValueError("%s is not a PSA call trace of version %d" % (path, TRACE_VERSION))
+
+    calls = []
+    pos = TRACE_HEADER_SIZE
+    while pos + 4 <= len(data):
+        size = struct.unpack_from('<I', data, pos)[0]
+        if size < TRACE_RECORD_FIXED_SIZE or pos + size > len(data):
+            raise ValueError("Malformed record at offset %d" % pos)
+        status = struct.unpack_from('<i', data, pos + 24)[0]
+        length = data[pos + TRACE_RECORD_FIXED_SIZE]
+        name = data[pos + TRACE_RECORD_FIXED_SIZE + 1:
+                    pos + TRACE_RECORD_FIXED_SIZE + 1 + length].decode('ascii')
+        calls.append((name, status))
+        pos += size
+    return calls
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('suite', help="crypto suite executable, e.g psa-arch-tests-crypto")
+    parser.add_argument('replay', help="psa_replay built against the same PSA implementation")
+    parser.add_argument('-t', '--trace', help="trace file, kept after the check")
+    args = parser.parse_args()
+
+    trace = args.trace
+    if not trace:
+        fd, trace = tempfile.mkstemp(suffix='.trace')
+        os.close(fd)
+
+    try:
+        env = dict(os.environ, PSA_ACS_TRACE=trace)
+        # The tests are run one at a time, the calls of concurrent tests would mix
+        env.pop('PSA_ACS_JOBS', None)
+        subprocess.run([args.suite], env=env, stdout=subprocess.DEVNULL, check=False)
+
+        calls = read_calls(trace)
+        asymmetric = [name for name, status in calls
+                      if name in ASYMMETRIC_CALLS and status == 0]
+        if not asymmetric:
+            sys.stderr.write("%s: no successful call using an RSA or ECC key in %d records\n"
+                             % (trace, len(calls)))
+            return 1
+        print("%d records, %d successful calls using an RSA or ECC key"
+              % (len(calls), len(asymmetric)))
+
+        return subprocess.run([args.replay, '-v', trace], check=False).returncode
+    finally:
+        if not args.trace:
+            os.remove(trace)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
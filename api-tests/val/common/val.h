@@ -62,6 +62,7 @@
 #define VAL_CRYPTO_BASE                        1
 #define VAL_STORAGE_BASE                       2
 #define VAL_INITIAL_ATTESTATION_BASE           3
+#define VAL_CRYPTO_BENCH_BASE                  4
 
 #define VAL_GET_COMP_NUM(test_id)      \
    ((test_id - (test_id % VAL_MAX_TEST_PER_COMP)) / VAL_MAX_TEST_PER_COMP)
@@ -93,6 +94,17 @@
     do {                                         \
     } while (1)
 
+/* Prints below the VERBOSITY of the build are compiled out, along with their strings */
+#define VAL_PRINT_ENABLED(level)        ((level) >= VERBOSITY)
+
+#define TEST_PRINT(level, string, data)                                             \
+    do {                                                                            \
+        if (VAL_PRINT_ENABLED(level))                                               \
+        {                                                                           \
+            val->print(level, string, data);                                        \
+        }                                                                           \
+    } while (0)
+
 #define TEST_ASSERT_EQUAL(arg1, arg2, checkpoint)                                   \
     do {                                                                            \
     	if ((arg1) == PAL_STATUS_UNSUPPORTED_FUNC)                                  \
@@ -101,6 +113,7 @@
         }                                                                           \
         if ((arg1) != arg2)                                                         \
         {                                                                           \
+            val->set_failed_checkpoint(checkpoint);                                 \
             val->print(ERROR, "\tFailed at Checkpoint: %d\n", checkpoint);    \
             val->print(ERROR, "\tActual: %d\n", arg1);                        \
             val->print(ERROR, "\tExpected: %d\n", arg2);                      \
@@ -116,6 +129,7 @@
         }                                                                           \
         if ((arg1) != status1 && (arg1) != status2)                                 \
         {                                                                           \
+            val->set_failed_checkpoint(checkpoint);                                 \
             val->print(ERROR, "\tFailed at Checkpoint: %d\n", checkpoint);    \
             val->print(ERROR, "\tActual: %d\n", arg1);                        \
             if ((status1) != (status2))                                             \
@@ -139,6 +153,7 @@
         }                                                                           \
         if ((arg1) == arg2)                                                         \
         {                                                                           \
+            val->set_failed_checkpoint(checkpoint);                                 \
             val->print(ERROR, "\tFailed at Checkpoint: %d\n", checkpoint);    \
             val->print(ERROR, "\tValue: %d\n", arg1);                         \
             return 1;                                                               \
@@ -149,6 +164,7 @@
     do {                                                                            \
         if (memcmp(buf1, buf2, size))                                               \
         {                                                                           \
+            val->set_failed_checkpoint(checkpoint);                                 \
             val->print(ERROR, "\tFailed at Checkpoint: %d : ", checkpoint);   \
             val->print(ERROR, "Unequal data in compared buffers\n", 0);       \
             return 1;                                                               \
@@ -163,6 +179,7 @@
         }                                                                           \
         if ((arg1) < range1 || (arg1) > range2)                                     \
         {                                                                           \
+            val->set_failed_checkpoint(checkpoint);                                 \
             val->print(ERROR, "\tFailed at Checkpoint: %d\n", checkpoint);    \
             val->print(ERROR, "\tActual: %d\n", arg1);                        \
             val->print(ERROR, "\tExpected range: %d to ", range1);            \
@@ -19,6 +19,161 @@
 #include "val_framework.h"
 #include "val_client_defs.h"
 #include "val_crypto.h"
+#include "val_peripherals.h"
+
+#ifdef CRYPTO
+/* Key cache. The asymmetric keys imported by the tests are kept as master keys, and
+ * a later import of the same key returns a copy of its master. A copy is a key of its
+ * own, used and destroyed by the test as usual, but it skips the parsing and checks
+ * of the key material, e.g the RSA key checks or the ECC public key computation.
+ *
+ * The masters are not destroyed at the end of the tests, each entry holds a key slot
+ * of the crypto implementation. PLATFORM_KEY_CACHE_ENTRIES of 0 disables the cache.
+ * It is bypassed as well while the PSA calls are traced or their allocations
+ * profiled: a replay destroys the keys at the end of each test, masters included, and
+ * the profile would count a master against the test which imported it.
+ */
+#ifndef PLATFORM_KEY_CACHE_ENTRIES
+#define PLATFORM_KEY_CACHE_ENTRIES 4
+#endif
+
+#if PLATFORM_KEY_CACHE_ENTRIES > 0
+typedef struct {
+    psa_key_id_t        master;
+    psa_key_type_t      type;
+    size_t              bits;
+    psa_key_usage_t     usage;
+    psa_algorithm_t     alg;
+    size_t              data_length;
+    uint64_t            data_hash;
+    uint32_t            last_use;
+} val_key_cache_entry_t;
+
+static val_key_cache_entry_t g_key_cache[PLATFORM_KEY_CACHE_ENTRIES];
+static uint32_t              g_key_cache_clock;
+static int                   g_key_cache_disabled;
+
+/**
+    @brief    - Hashes the material of a key, FNV-1a
+    @param    - data   : Key material
+                length : Size of the key material
+    @return   - Hash of the key material
+**/
+static uint64_t val_key_cache_hash(const uint8_t *data, size_t length)
+{
+    uint64_t hash = 0xCBF29CE484222325ULL;
+
+    while (length--)
+        hash = (hash ^ *data++) * 0x100000001B3ULL;
+    return hash;
+}
+
+/**
+    @brief    - Destroys the master keys of the cache
+    @param    - None
+    @return   - void
+**/
+static void val_key_cache_flush(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < PLATFORM_KEY_CACHE_ENTRIES; i++)
+    {
+        if (g_key_cache[i].master != PSA_KEY_ID_NULL)
+            pal_crypto_api.destroy_key(g_key_cache[i].master);
+        g_key_cache[i].master = PSA_KEY_ID_NULL;
+    }
+}
+
+/**
+    @brief    - Imports a key, through a copy of its cached master for the volatile
+                asymmetric keys
+    @param    - attributes  : Key attributes
+                data        : Key material
+                data_length : Size of the key material
+                key         : Returns the key identifier
+    @return   - PSA status of the import
+**/
+static psa_status_t val_key_cache_import(const psa_key_attributes_t *attributes,
+                                         const uint8_t *data, size_t data_length,
+                                         psa_key_id_t *key)
+{
+    const pal_crypto_api_t  *api  = &pal_crypto_api;
+    psa_key_type_t           type = api->get_key_type(attributes);
+    psa_key_attributes_t     master_attributes;
+    val_key_cache_entry_t   *entry = NULL;
+    uint64_t                 hash;
+    uint32_t                 i;
+    psa_status_t             status;
+
+    if (g_key_cache_disabled || !PSA_KEY_TYPE_IS_ASYMMETRIC(type) ||
+        (api->get_key_lifetime(attributes) != PSA_KEY_LIFETIME_VOLATILE) ||
+        pal_trace_enabled() || (pal_crypto_alloc_profile() != NULL))
+        return api->import_key(attributes, data, data_length, key);
+
+    hash = val_key_cache_hash(data, data_length);
+    for (i = 0; i < PLATFORM_KEY_CACHE_ENTRIES; i++)
+    {
+        if ((g_key_cache[i].master != PSA_KEY_ID_NULL) &&
+            (g_key_cache[i].type == type) &&
+            (g_key_cache[i].bits == api->get_key_bits(attributes)) &&
+            (g_key_cache[i].usage == api->get_key_usage_flags(attributes)) &&
+            (g_key_cache[i].alg == api->get_key_algorithm(attributes)) &&
+            (g_key_cache[i].data_length == data_length) &&
+            (g_key_cache[i].data_hash == hash))
+        {
+            entry = &g_key_cache[i];
+            break;
+        }
+    }
+
+    if (entry == NULL)
+    {
+        /* Replace a free entry, or else the least recently used one */
+        entry = &g_key_cache[0];
+        for (i = 0; (i < PLATFORM_KEY_CACHE_ENTRIES) && (entry->master != PSA_KEY_ID_NULL); i++)
+        {
+            if ((g_key_cache[i].master == PSA_KEY_ID_NULL) ||
+                (g_key_cache[i].last_use < entry->last_use))
+                entry = &g_key_cache[i];
+        }
+
+        if (entry->master != PSA_KEY_ID_NULL)
+            api->destroy_key(entry->master);
+        entry->master = PSA_KEY_ID_NULL;
+
+        /* The master may be copied, the copies get the usage of the test */
+        master_attributes = *attributes;
+        api->set_key_usage_flags(&master_attributes,
+                                 api->get_key_usage_flags(attributes) | PSA_KEY_USAGE_COPY);
+        status = api->import_key(&master_attributes, data, data_length, &entry->master);
+        if (status != PSA_SUCCESS)
+        {
+            entry->master = PSA_KEY_ID_NULL;
+            return api->import_key(attributes, data, data_length, key);
+        }
+
+        /* Kept over the end of the test */
+        pal_crypto_untrack_key(entry->master);
+
+        entry->type        = type;
+        entry->bits        = api->get_key_bits(attributes);
+        entry->usage       = api->get_key_usage_flags(attributes);
+        entry->alg         = api->get_key_algorithm(attributes);
+        entry->data_length = data_length;
+        entry->data_hash   = hash;
+    }
+
+    entry->last_use = ++g_key_cache_clock;
+
+    status = api->copy_key(entry->master, attributes, key);
+    if (status != PSA_SUCCESS)
+        return api->import_key(attributes, data, data_length, key);
+
+    return PSA_SUCCESS;
+}
+#endif /* PLATFORM_KEY_CACHE_ENTRIES > 0 */
+#endif /* CRYPTO */
 
 /**
     @brief    - This API will call the requested crypto function
@@ -31,8 +186,55 @@ int32_t val_crypto_function(int type, ...)
 #ifdef CRYPTO
     va_list      valist;
     int32_t      status;
+#if PLATFORM_KEY_CACHE_ENTRIES > 0
+    const psa_key_attributes_t *attributes;
+    const uint8_t              *data;
+    size_t                      data_length;
+    psa_key_id_t               *key;
+#endif
 
     va_start(valist, type);
+
+    /* End of the test, the PAL adds its allocation profile to the suite totals */
+    if (type == VAL_CRYPTO_FREE)
+        val_crypto_print_alloc_profile(0);
+
+#if PLATFORM_KEY_CACHE_ENTRIES > 0
+    switch (type)
+    {
+        case VAL_CRYPTO_IMPORT_KEY:
+            attributes  = va_arg(valist, const psa_key_attributes_t *);
+            data        = va_arg(valist, const uint8_t *);
+            data_length = va_arg(valist, size_t);
+            key         = va_arg(valist, psa_key_id_t *);
+            va_end(valist);
+            return val_key_cache_import(attributes, data, data_length, key);
+
+        case VAL_CRYPTO_KEY_CACHE_DISABLE:
+            g_key_cache_disabled = 1;
+            va_end(valist);
+            return VAL_STATUS_SUCCESS;
+
+        case VAL_CRYPTO_FREE:
+            /* End of the test */
+            g_key_cache_disabled = 0;
+            break;
+
+        case VAL_CRYPTO_RESET:
+            val_key_cache_flush();
+            break;
+
+        default:
+            break;
+    }
+#else
+    if (type == VAL_CRYPTO_KEY_CACHE_DISABLE)
+    {
+        va_end(valist);
+        return VAL_STATUS_SUCCESS;
+    }
+#endif
+
     status = pal_crypto_function(type, valist);
     va_end(valist);
     return status;
@@ -41,3 +243,90 @@ int32_t val_crypto_function(int type, ...)
     return VAL_STATUS_ERROR;
 #endif
 }
+
+/**
+    @brief    - Prints the sizes of the operation contexts of the crypto implementation,
+                which the tests and the applications hold on their stacks
+    @param    - None
+    @return   - None
+**/
+void val_crypto_print_context_sizes(void)
+{
+#ifdef CRYPTO
+    val_print(ALWAYS, "Hash operation           : %d bytes\n", sizeof(psa_hash_operation_t));
+    val_print(ALWAYS, "MAC operation            : %d bytes\n", sizeof(psa_mac_operation_t));
+    val_print(ALWAYS, "Cipher operation         : %d bytes\n", sizeof(psa_cipher_operation_t));
+    val_print(ALWAYS, "AEAD operation           : %d bytes\n", sizeof(psa_aead_operation_t));
+    val_print(ALWAYS, "Key derivation operation : %d bytes\n",
+              sizeof(psa_key_derivation_operation_t));
+    val_print(ALWAYS, "PAKE operation           : %d bytes\n", sizeof(psa_pake_operation_t));
+    val_print(ALWAYS, "Key attributes           : %d bytes\n", sizeof(psa_key_attributes_t));
+#endif
+}
+
+/**
+    @brief    - Prints the heap allocations made in the PSA calls, per PSA function, when
+                the platform profiles them, see pal_crypto_alloc_profile
+    @param    - suite : 0 for the current test, 1 for the totals of the suite
+    @return   - None
+**/
+void val_crypto_print_alloc_profile(int suite)
+{
+#ifdef CRYPTO
+    const pal_crypto_alloc_profile_t *profile = pal_crypto_alloc_profile();
+    const pal_crypto_alloc_stat_t    *stats;
+    const pal_crypto_alloc_leak_t    *leak;
+    const char                       *name;
+    uint64_t                          allocs = 0, bytes = 0;
+    uint32_t                          i;
+
+    if (profile == NULL)
+        return;
+
+    stats = suite ? profile->suite : profile->test;
+    for (i = 0; i < PAL_CRYPTO_ALLOC_FUNCTIONS; i++)
+        allocs += stats[i].allocs;
+
+    if (!allocs)
+        return;
+
+    val_print(ALWAYS, suite ? "\nAllocations in PSA calls, whole suite\n" :
+                              "\nAllocations in PSA calls\n", 0);
+    for (i = 0; i < PAL_CRYPTO_ALLOC_FUNCTIONS; i++)
+    {
+        if (!stats[i].allocs)
+            continue;
+
+        name = pal_crypto_function_name(i);
+        val_print(ALWAYS, name ? name : "unknown", 0);
+        val_print(ALWAYS, " | Calls=%d", stats[i].calls);
+        val_print(ALWAYS, " | Allocs=%d", stats[i].allocs);
+        val_print(ALWAYS, " | Bytes=%d", (int32_t)stats[i].bytes);
+        val_print(ALWAYS, " | Peak=%d\n", (int32_t)stats[i].peak);
+        bytes += stats[i].bytes;
+    }
+    val_print(ALWAYS, "TOTAL | Allocs=%d", (int32_t)allocs);
+    val_print(ALWAYS, " | Bytes=%d\n", (int32_t)bytes);
+
+    if (suite)
+    {
+        if (profile->suite_leak_count)
+            val_print(ALWAYS, "Operations leaking memory: %d\n", profile->suite_leak_count);
+        return;
+    }
+
+    for (i = 0; i < profile->leak_count; i++)
+    {
+        leak = &profile->leaks[i];
+        val_print(ALWAYS, "Leak: %d bytes allocated from ", (int32_t)leak->bytes);
+        name = pal_crypto_function_name(leak->setup);
+        val_print(ALWAYS, name ? name : "unknown", 0);
+        val_print(ALWAYS, " to ", 0);
+        name = pal_crypto_function_name(leak->end);
+        val_print(ALWAYS, name ? name : "unknown", 0);
+        val_print(ALWAYS, "\n", 0);
+    }
+#else
+    (void)suite;
+#endif
+}
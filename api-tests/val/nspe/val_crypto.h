@@ -19,6 +19,10 @@
 #define _VAL_CRYPTO_H_
 
 #include "val.h"
+#ifdef CRYPTO
+/* Typed crypto API, called through val->crypto */
+#include "pal_crypto_api.h"
+#endif
 
 #define BYTES_TO_BITS(byte)             (byte * 8)
 #define BITS_TO_BYTES(bits)             (((bits) + 7) / 8)
@@ -155,9 +159,30 @@ enum crypto_function_code {
     VAL_CRYPTO_PAKE_INPUT,
     VAL_CRYPTO_PAKE_GET_SHARED_KEY,
     VAL_CRYPTO_PAKE_ABORT,
+    VAL_CRYPTO_INTERRUPTIBLE_GET_MAX_OPS,
+    VAL_CRYPTO_INTERRUPTIBLE_SET_MAX_OPS,
+    VAL_CRYPTO_SIGN_HASH_INTERRUPTIBLE_OPERATION_INIT,
+    VAL_CRYPTO_SIGN_HASH_START,
+    VAL_CRYPTO_SIGN_HASH_COMPLETE,
+    VAL_CRYPTO_SIGN_HASH_GET_NUM_OPS,
+    VAL_CRYPTO_SIGN_HASH_ABORT,
+    VAL_CRYPTO_VERIFY_HASH_INTERRUPTIBLE_OPERATION_INIT,
+    VAL_CRYPTO_VERIFY_HASH_START,
+    VAL_CRYPTO_VERIFY_HASH_COMPLETE,
+    VAL_CRYPTO_VERIFY_HASH_GET_NUM_OPS,
+    VAL_CRYPTO_VERIFY_HASH_ABORT,
+    VAL_CRYPTO_KEY_AGREEMENT_IOP_INIT,
+    VAL_CRYPTO_KEY_AGREEMENT_IOP_SETUP,
+    VAL_CRYPTO_KEY_AGREEMENT_IOP_COMPLETE,
+    VAL_CRYPTO_KEY_AGREEMENT_IOP_GET_NUM_OPS,
+    VAL_CRYPTO_KEY_AGREEMENT_IOP_ABORT,
     VAL_CRYPTO_RESET                            = 0xF0,
+    /* Handled by the VAL, imports of the calling test bypass the key cache */
+    VAL_CRYPTO_KEY_CACHE_DISABLE                = 0xF1,
     VAL_CRYPTO_FREE                             = 0xFE,
 };
 
 int32_t val_crypto_function(int type, ...);
+void val_crypto_print_context_sizes(void);
+void val_crypto_print_alloc_profile(int suite);
 #endif /* _VAL_CRYPTO_H_ */
@@ -20,6 +20,12 @@
 #include "val_dispatcher.h"
 #include "val_interfaces.h"
 #include "val_peripherals.h"
+#include "val_test_select.h"
+#include "val_results.h"
+#include "val_progress.h"
+#include "val_log.h"
+#include "val_crypto.h"
+#include "pal_trace.h"
 
 extern val_api_t val_api;
 extern psa_api_t psa_api;
@@ -66,6 +72,10 @@ static val_test_info_t g_test_list[] = {
 
 const uint32_t total_tests = sizeof(g_test_list)/sizeof(g_test_list[0]) - 1;
 
+/* Results of the tests run since the last boot, for the timing report */
+static val_test_result_t g_test_results[sizeof(g_test_list)/sizeof(g_test_list[0])];
+static uint32_t          g_test_result_count;
+
 /**
     @brief        - This function returns the IDs list of available tests
     @param        - test_id_list : Buffer allocated by caller
@@ -122,7 +132,8 @@ val_status_t val_test_load(test_id_t *test_id, test_id_t test_id_prev)
 
     for (; test_info->test_id != VAL_INVALID_TEST_ID; test_info++)
     {
-        if (pal_is_test_enabled(test_info->test_id))
+        if (pal_is_test_enabled(test_info->test_id) &&
+            val_is_test_selected(test_info->test_id))
         {
             *test_id = test_info->test_id;
             g_test_info_addr = (addr_t) test_info->entry_addr;
@@ -130,7 +141,7 @@ val_status_t val_test_load(test_id_t *test_id, test_id_t test_id_prev)
         }
     }
 
-    val_print(DBG, "\n\nNo more valid tests found. Exiting.", 0);
+    VAL_PRINT(DBG, "\n\nNo more valid tests found. Exiting.", 0);
     *test_id = VAL_INVALID_TEST_ID;
     return VAL_STATUS_SUCCESS;
 }
@@ -162,6 +173,128 @@ void val_execute_test_fn(void)
     return;
 }
 
+/**
+    @brief    - Initialises the result record of a test which could not run
+    @param    - test_id : Test ID
+                result  : Test result record
+    @return   - void
+**/
+static void val_init_test_result(test_id_t test_id, val_test_result_t *result)
+{
+    result->test_id           = test_id;
+    result->test_result       = TEST_ERROR;
+    result->status_code       = val_get_status() & TEST_STATUS_CODE_MASK;
+    result->failed_check      = 0;
+    result->failed_checkpoint = 0;
+    result->desc              = NULL;
+    result->time_us           = 0;
+    result->check_num         = 0;
+    result->check_time_us     = 0;
+    result->scratch_bytes     = 0;
+    result->stack_bytes       = 0;
+    result->heap_bytes        = 0;
+    result->perf.count        = 0;
+}
+
+/**
+    @brief    - Executes the loaded test and measures its execution time and, when the
+                platform supports it, its peak stack and heap use
+    @param    - test_id : Test ID
+                result  : Returns the test details, timing and memory use
+    @return   - void
+**/
+static void val_run_test(test_id_t test_id, val_test_result_t *result)
+{
+    pal_mem_usage_t usage;
+    uint64_t        start = val_get_time_ns();
+    int             ret;
+
+    ret = pal_mem_watch_run(val_execute_test_fn, &usage);
+
+    result->test_id     = test_id;
+    result->time_us     = (uint32_t)((val_get_time_ns() - start) / 1000);
+    val_get_test_details(result);
+    result->stack_bytes = usage.stack_bytes;
+    result->heap_bytes  = usage.heap_bytes;
+
+    if (ret == PAL_STATUS_SUCCESS)
+    {
+        val_print(TEST, "\nMemory: Stack=%d bytes", usage.stack_bytes);
+        val_print(TEST, " | Heap=%d bytes", usage.heap_bytes);
+    }
+}
+
+/**
+    @brief    - Prints the tests run since the last boot, slowest first, and the run
+                time of all the tests of the suite
+    @param    - test_total : Number of tests accounted in the suite summary
+    @return   - None
+**/
+static void val_print_timing_report(uint32_t test_total)
+{
+    val_test_result_t    entry;
+    uint32_t             i, j;
+
+    /* Nothing to report if the platform has no timestamp counter */
+    if (!test_total || !val_get_time_ns())
+        return;
+
+    for (i = 1; i < g_test_result_count; i++)
+    {
+        entry = g_test_results[i];
+        for (j = i; j > 0 && g_test_results[j - 1].time_us < entry.time_us; j--)
+            g_test_results[j] = g_test_results[j - 1];
+        g_test_results[j] = entry;
+    }
+
+    val_print(ALWAYS, "\n************ Timing Report ***************\n", 0);
+    for (i = 0; i < g_test_result_count; i++)
+    {
+        val_print(ALWAYS, "TEST: %d", g_test_results[i].test_id);
+        val_print(ALWAYS, " | Time=%d us", g_test_results[i].time_us);
+        if (g_test_results[i].check_num)
+        {
+            val_print(ALWAYS, " | Slowest check=%d", g_test_results[i].check_num);
+            val_print(ALWAYS, " (%d us)", g_test_results[i].check_time_us);
+        }
+        val_print(ALWAYS, "\n", 0);
+    }
+    if (g_test_result_count < test_total)
+    {
+        val_print(ALWAYS, "Tests run before the last reset : %d, see the result records\n",
+                  test_total - g_test_result_count);
+    }
+    val_print(ALWAYS, "TOTAL TIME      : %d ms\n", val_progress_get()->time_ms);
+    val_print(ALWAYS, "******************************************\n", 0);
+}
+
+/**
+    @brief    - Prints the tests of the suite with the deepest stack and the largest
+                heap use, the operation context sizes of the crypto implementation and
+                the heap allocations made in its calls, when profiled
+    @param    - None
+    @return   - None
+**/
+static void val_print_memory_report(void)
+{
+    const val_progress_t *progress = val_progress_get();
+
+    val_print(ALWAYS, "\n************ Memory Report ***************\n", 0);
+    if (progress->stack_bytes)
+    {
+        val_print(ALWAYS, "PEAK STACK      : %d bytes", progress->stack_bytes);
+        val_print(ALWAYS, " (TEST: %d)\n", progress->stack_test_id);
+    }
+    if (progress->heap_bytes)
+    {
+        val_print(ALWAYS, "PEAK HEAP       : %d bytes", progress->heap_bytes);
+        val_print(ALWAYS, " (TEST: %d)\n", progress->heap_test_id);
+    }
+    val_crypto_print_context_sizes();
+    val_crypto_print_alloc_profile(1);
+    val_print(ALWAYS, "******************************************\n", 0);
+}
+
 /*
     @brief    - Reads the pre-defined component name against given test_id
     @param    - test_id  : Current Test ID
@@ -179,11 +312,169 @@ char *val_get_comp_name(test_id_t test_id)
             return "Storage Suite";
         case VAL_INITIAL_ATTESTATION_BASE:
             return "Attestation Suite";
+        case VAL_CRYPTO_BENCH_BASE:
+            return "Crypto Benchmark Suite";
         default:
             return "Unknown Suite";
     }
 }
 
+/**
+    @brief    - Accounts the result of a test into the suite summary and emits its
+                result record. The summary is written to NVM together with the next
+                test ID, see val_progress_begin_test.
+    @param    - result : Result record of the completed test
+    @return   - void
+**/
+static void val_update_suite_report(const val_test_result_t *result)
+{
+    if (g_test_result_count < sizeof(g_test_results)/sizeof(g_test_results[0]))
+        g_test_results[g_test_result_count++] = *result;
+
+    val_report_test_record(result);
+    val_progress_account(result);
+}
+
+/**
+    @brief    - Writes the suite summary to NVM and prints it
+    @param    - test_id_prev : ID of the last run test
+    @return   - VAL_STATUS_TEST_FAILED if any test failed, else error code
+**/
+static int32_t val_print_suite_report(test_id_t test_id_prev)
+{
+    val_status_t         status;
+    regre_report_t       test_count;
+
+    /* Persist the results accounted since the last test was started */
+    status = val_progress_commit();
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
+
+    test_count = val_progress_get()->test_count;
+
+#ifdef BESPOKE_PRINT_NS
+    val_print(ALWAYS, "\n************ ", 0);
+    val_print(ALWAYS, val_get_comp_name(test_id_prev), 0);
+    val_print(ALWAYS, " Report ************\n", 0);
+    val_print(ALWAYS, "TOTAL TESTS     : %d\n", (uint32_t)test_count.total_pass +
+             test_count.total_fail + test_count.total_skip + test_count.total_error);
+    val_print(ALWAYS, "TOTAL PASSED    : %d\n", test_count.total_pass);
+    val_print(ALWAYS, "TOTAL SIM ERROR : %d\n", test_count.total_error);
+    val_print(ALWAYS, "TOTAL FAILED    : %d\n", test_count.total_fail);
+    val_print(ALWAYS, "TOTAL SKIPPED   : %d\n", test_count.total_skip);
+    val_print(ALWAYS, "******************************************\n", 0);
+#else
+    (void)test_id_prev;
+    val_print_regression_report(&test_count);
+#endif
+
+    val_report_suite_records(&test_count);
+    val_print_timing_report(test_count.total_pass + test_count.total_fail +
+                            test_count.total_skip + test_count.total_error);
+    val_print_memory_report();
+
+    return (test_count.total_fail > 0) ? VAL_STATUS_TEST_FAILED : VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Runs the remaining tests concurrently, each in its own worker provided
+                by the platform. The worker runs the test and reports its status, the
+                dispatcher collects the test results as the workers complete and keeps
+                the suite summary. A worker which crashes or times out is accounted as
+                a SIM ERROR for the test it was running.
+    @param    - test_id_prev : Previous test ID
+                worker_count : Number of tests to run concurrently
+    @return   - 0 if success Or error code for the failure.
+**/
+static int32_t val_dispatcher_parallel(test_id_t test_id_prev, uint32_t worker_count)
+{
+    test_id_t            test_id;
+    test_id_t            worker_test_id[VAL_MAX_WORKERS];
+    val_test_result_t    result;
+    val_status_t         status;
+    int32_t              worker;
+    int                  ret;
+    uint32_t             running = 0;
+    bool_t               done = 0;
+
+    if (worker_count > VAL_MAX_WORKERS)
+        worker_count = VAL_MAX_WORKERS;
+
+    val_print(ALWAYS, "\nRunning tests on %d workers\n", worker_count);
+    val_print(ALWAYS, "\n******************************************\n", 0);
+
+    while (!done || running)
+    {
+        /* Fill all the idle workers */
+        while (!done && running < worker_count)
+        {
+            status = val_test_load(&test_id, test_id_prev);
+            if (VAL_ERROR(status))
+            {
+                return status;
+            }
+            else if (test_id == VAL_INVALID_TEST_ID)
+            {
+                done = 1;
+                break;
+            }
+            test_id_prev = test_id;
+
+            ret = pal_worker_start(&worker);
+            if (ret == 0)
+            {
+                /* Worker context, the NVM and boot flag are private from here on */
+                val_progress_begin_test(test_id);
+                val_set_boot_flag(BOOT_NOT_EXPECTED);
+                val_run_test(test_id, &result);
+
+#ifdef BESPOKE_PRINT_NS
+                result.test_result = val_report_status_bespoke();
+#else
+                result.test_result = val_report_status();
+#endif
+                val_log_flush();
+                pal_worker_exit(&result, sizeof(result));
+            }
+            else if (ret != 1 || worker < 0 || worker >= VAL_MAX_WORKERS)
+            {
+                val_print(ERROR, "\n\tUnable to start worker, error=%d", ret);
+                return VAL_STATUS_ERROR;
+            }
+
+            worker_test_id[worker] = test_id;
+            running++;
+        }
+
+        if (!running)
+            break;
+
+        /* Collect the result of the first worker to complete */
+        worker = -1;
+        ret = pal_worker_wait(&worker, &result, sizeof(result));
+        if (worker < 0 || worker >= VAL_MAX_WORKERS)
+        {
+            val_print(ERROR, "\n\tUnable to wait for workers, error=%d", ret);
+            return VAL_STATUS_ERROR;
+        }
+        running--;
+
+        if (ret != PAL_STATUS_SUCCESS || result.test_id != worker_test_id[worker])
+        {
+            val_init_test_result(worker_test_id[worker], &result);
+            result.status_code = VAL_STATUS_ERROR;
+            val_print(ALWAYS, "\nTEST: %d", result.test_id);
+            val_print(ALWAYS, " | Result=Sim Error (worker crashed or timed out)\n", 0);
+        }
+
+        val_update_suite_report(&result);
+    }
+
+    return val_print_suite_report(test_id_prev);
+}
+
 /**
     @brief    - This function is responsible for setting up VAL infrastructure.
                 Loads test one by one from combine binary and calls test_entry
@@ -196,30 +487,40 @@ int32_t val_dispatcher(test_id_t test_id_prev)
     test_id_t            test_id;
     val_status_t         status;
     boot_t               boot;
-    regre_report_t       test_count;
-    uint32_t             test_result;
+    uint32_t             worker_count;
+    val_test_result_t    result;
 
-    do
+    /* Tests can only be spread over workers on a clean boot, a boot that follows
+       a test reset has to resume that test first */
+    status = val_get_boot_flag(&boot.state);
+    if (VAL_ERROR(status))
     {
-        status = val_get_boot_flag(&boot.state);
-        if (VAL_ERROR(status))
-        {
-            return status;
-        }
+        return status;
+    }
 
+    /* Start a new result stream and call trace unless resuming a run */
+    if (boot.state == BOOT_UNKNOWN && test_id_prev == VAL_INVALID_TEST_ID)
+    {
+        val_report_run_record(val_get_comp_name(g_test_list[0].test_id));
+        pal_trace_start();
+    }
+
+    worker_count = pal_get_worker_count();
+    if (worker_count > 1 && boot.state == BOOT_UNKNOWN)
+    {
+        return val_dispatcher_parallel(test_id_prev, worker_count);
+    }
+
+    do
+    {
         /* Did last run test hang and system re-booted due to watchdog timeout and
            boot.state was set to BOOT_NOT_EXPECTED ? If yes, set the test status
            to SIM ERROR and go to next test. */
         if (boot.state == BOOT_NOT_EXPECTED)
         {
             val_set_status(RESULT_ERROR(VAL_STATUS_ERROR));
-            status = val_nvm_read(VAL_NVM_OFFSET(NVM_CUR_TEST_NUM_INDEX),
-                                    &test_id, sizeof(test_id_t));
-            if (VAL_ERROR(status))
-            {
-                val_print(ERROR, "\n\tNVMEM read error", 0);
-                return status;
-            }
+            test_id = val_progress_get()->cur_test_id;
+            val_init_test_result(test_id, &result);
         }
         /* Did last run test hang and system reset due to watchdog timeout but
            boot.state was set to BOOT_EXPECTED_BUT_FAILED ? If yes, set the test status
@@ -229,13 +530,8 @@ int32_t val_dispatcher(test_id_t test_id_prev)
         else if (boot.state == BOOT_EXPECTED_BUT_FAILED)
         {
             val_set_status(RESULT_FAIL(VAL_STATUS_BOOT_EXPECTED_BUT_FAILED));
-            status = val_nvm_read(VAL_NVM_OFFSET(NVM_CUR_TEST_NUM_INDEX),
-                                    &test_id, sizeof(test_id_t));
-            if (VAL_ERROR(status))
-            {
-                val_print(ERROR, "\n\tNVMEM read error", 0);
-                return status;
-            }
+            test_id = val_progress_get()->cur_test_id;
+            val_init_test_result(test_id, &result);
         }
         else
         {
@@ -250,11 +546,10 @@ int32_t val_dispatcher(test_id_t test_id_prev)
                 break;
             }
 
-            status = val_nvm_write(VAL_NVM_OFFSET(NVM_CUR_TEST_NUM_INDEX),
-                                     &test_id, sizeof(test_id_t));
+            /* Single NVM write per test, along with the result of the previous one */
+            status = val_progress_begin_test(test_id);
             if (VAL_ERROR(status))
             {
-                val_print(ERROR, "\n\tNVMEM write error", 0);
                 return status;
             }
 
@@ -280,13 +575,13 @@ build. For PSA functional API certification, all tests must be run.\n", 0);
                     return status;
                 }
             }
-            val_execute_test_fn();
+            val_run_test(test_id, &result);
         }
 
 #ifdef BESPOKE_PRINT_NS
-        test_result = val_report_status_bespoke();
+        result.test_result = val_report_status_bespoke();
 #else
-        test_result = val_report_status();
+        result.test_result = val_report_status();
 #endif
 
         /* Reset boot.state to UNKNOWN before launching next test */
@@ -295,80 +590,13 @@ build. For PSA functional API certification, all tests must be run.\n", 0);
         {
             return status;
         }
+        boot.state = BOOT_UNKNOWN;
 
-        /* Prepare suite summary data structure */
-        status = (val_nvm_read(VAL_NVM_OFFSET(NVM_TOTAL_PASS_INDEX),
-                        &test_count.total_pass, sizeof(uint32_t)) ||
-                  val_nvm_read(VAL_NVM_OFFSET(NVM_TOTAL_FAIL_INDEX),
-                        &test_count.total_fail, sizeof(uint32_t))  ||
-                  val_nvm_read(VAL_NVM_OFFSET(NVM_TOTAL_SKIP_INDEX),
-                        &test_count.total_skip, sizeof(uint32_t))  ||
-                  val_nvm_read(VAL_NVM_OFFSET(NVM_TOTAL_ERROR_INDEX),
-                        &test_count.total_error, sizeof(uint32_t)));
-
-        if (VAL_ERROR(status))
-        {
-            val_print(ERROR, "\n\tNVMEM read error", 0);
-            return status;
-        }
-
-        val_update_regression_report(test_result, &test_count);
-
-        status = (val_nvm_write(VAL_NVM_OFFSET(NVM_TOTAL_PASS_INDEX),
-                        &test_count.total_pass, sizeof(uint32_t)) ||
-                  val_nvm_write(VAL_NVM_OFFSET(NVM_TOTAL_FAIL_INDEX),
-                       &test_count.total_fail, sizeof(uint32_t))  ||
-                  val_nvm_write(VAL_NVM_OFFSET(NVM_TOTAL_SKIP_INDEX),
-                       &test_count.total_skip, sizeof(uint32_t))  ||
-                  val_nvm_write(VAL_NVM_OFFSET(NVM_TOTAL_ERROR_INDEX),
-                       &test_count.total_error, sizeof(uint32_t)));
-
-        if (VAL_ERROR(status))
-        {
-            val_print(ERROR, "\n\tNVMEM write error", 0);
-            return status;
-        }
+        val_update_suite_report(&result);
 
         test_id_prev = test_id;
-        status = val_nvm_write(VAL_NVM_OFFSET(NVM_PREVIOUS_TEST_ID),
-                                 &test_id, sizeof(test_id_t));
-        if (VAL_ERROR(status))
-        {
-            val_print(ERROR, "\n\tNVMEM write error", 0);
-            return status;
-        }
 
    } while (1);
 
-   status = (val_nvm_read(VAL_NVM_OFFSET(NVM_TOTAL_PASS_INDEX),
-                    &test_count.total_pass, sizeof(uint32_t)) ||
-             val_nvm_read(VAL_NVM_OFFSET(NVM_TOTAL_FAIL_INDEX),
-                    &test_count.total_fail, sizeof(uint32_t))  ||
-             val_nvm_read(VAL_NVM_OFFSET(NVM_TOTAL_SKIP_INDEX),
-                    &test_count.total_skip, sizeof(uint32_t))  ||
-             val_nvm_read(VAL_NVM_OFFSET(NVM_TOTAL_ERROR_INDEX),
-                    &test_count.total_error, sizeof(uint32_t)));
-
-   if (VAL_ERROR(status))
-   {
-       val_print(ERROR, "\n\tNVMEM read error", 0);
-       return status;
-   }
-
-#ifdef BESPOKE_PRINT_NS
-   val_print(ALWAYS, "\n************ ", 0);
-   val_print(ALWAYS, val_get_comp_name(test_id_prev), 0);
-   val_print(ALWAYS, " Report ************\n", 0);
-   val_print(ALWAYS, "TOTAL TESTS     : %d\n", (uint32_t)test_count.total_pass +
-            test_count.total_fail + test_count.total_skip + test_count.total_error);
-   val_print(ALWAYS, "TOTAL PASSED    : %d\n", test_count.total_pass);
-   val_print(ALWAYS, "TOTAL SIM ERROR : %d\n", test_count.total_error);
-   val_print(ALWAYS, "TOTAL FAILED    : %d\n", test_count.total_fail);
-   val_print(ALWAYS, "TOTAL SKIPPED   : %d\n", test_count.total_skip);
-   val_print(ALWAYS, "******************************************\n", 0);
-#else
-    val_print_regression_report(&test_count);
-#endif
-
-   return (test_count.total_fail > 0) ? VAL_STATUS_TEST_FAILED : VAL_STATUS_SUCCESS;
+   return val_print_suite_report(test_id_prev);
 }
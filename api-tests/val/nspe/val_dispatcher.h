@@ -23,5 +23,26 @@
 
 #define VAL_INVALID_TEST_ID 0xffffffff
 
+/* Maximum number of tests run concurrently by the dispatcher */
+#define VAL_MAX_WORKERS     64
+
+/* Result record of a test, handed back by a worker to the dispatcher */
+typedef struct {
+    test_id_t   test_id;
+    uint32_t    test_result;
+    uint32_t    status_code;
+    uint32_t    failed_check;       /* Check which failed or skipped the test */
+    uint32_t    failed_checkpoint;  /* First failing checkpoint reported */
+    const char *desc;               /* Test description, in the test image */
+    uint32_t    time_us;            /* Test execution time */
+    uint32_t    check_num;          /* Slowest check of the test */
+    uint32_t    check_time_us;      /* Execution time of the slowest check */
+    uint32_t    scratch_bytes;      /* High-water mark of the scratch arena */
+    uint32_t    stack_bytes;        /* Peak stack use, 0 if not measured */
+    uint32_t    heap_bytes;         /* Peak heap use, 0 if not measured */
+    pal_perf_counts_t perf;         /* Performance counts of the test, if counted */
+} val_test_result_t;
+
 int32_t val_dispatcher(test_id_t test_id_prev);
+char *val_get_comp_name(test_id_t test_id);
 #endif
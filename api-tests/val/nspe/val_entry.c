@@ -20,6 +20,7 @@
 #include "val_peripherals.h"
 #include "val_dispatcher.h"
 #include "val_platform.h"
+#include "val_log.h"
 
 /**
     @brief    - PSA C main function, does VAL init and calls test dispatcher
@@ -63,6 +64,7 @@ int32_t val_entry(void)
 
 exit:
     val_print(ALWAYS, "\nEntering standby.. \n", 0);
+    val_log_flush();
 
     pal_terminate_simulation();
 
@@ -19,11 +19,23 @@
 #include "val_interfaces.h"
 #include "val_dispatcher.h"
 #include "val_peripherals.h"
+#include "val_results.h"
+#include "val_progress.h"
+#include "val_log.h"
+#include "val_scratch.h"
 #include "pal_interfaces_ns.h"
 
 extern val_api_t val_api;
 extern psa_api_t psa_api;
 
+/* Details of the running test, for the timing report and the result records */
+static const char *g_test_desc;
+static uint32_t    g_slowest_check_num;
+static uint32_t    g_slowest_check_us;
+static uint32_t    g_failed_check;
+static uint32_t    g_failed_checkpoint;
+static pal_perf_counts_t g_test_perf;
+
 #ifdef IPC
 /**
  * @brief Connect to given sid
@@ -86,6 +98,74 @@ void val_ipc_close(psa_handle_t handle)
 }
 #endif
 
+/**
+    @brief    - Records the execution time, the performance counts and the result of
+                a check
+    @param    - test_id    : Test ID
+                check_num  : Check number
+                status     : Status returned by the check
+                start_ns   : Time the check started
+                start_perf : Performance counters when the check started
+    @return   - void
+**/
+static void val_record_check(test_id_t test_id, uint32_t check_num, val_status_t status,
+                             uint64_t start_ns, const pal_perf_counts_t *start_perf)
+{
+    uint32_t          time_us = (uint32_t)((val_get_time_ns() - start_ns) / 1000);
+    pal_perf_counts_t perf;
+    uint32_t          i;
+
+    pal_perf_read(&perf);
+    if (perf.count != start_perf->count)
+        perf.count = 0;
+    for (i = 0; i < perf.count; i++)
+        perf.value[i] -= start_perf->value[i];
+
+    VAL_PRINT(DBG, "[Check %d] ", check_num);
+    VAL_PRINT(DBG, "Time=%d us\n", time_us);
+
+    if (time_us >= g_slowest_check_us)
+    {
+        g_slowest_check_num = check_num;
+        g_slowest_check_us  = time_us;
+    }
+
+    if ((IS_TEST_SKIP(status) || VAL_ERROR(status)) && !g_failed_check)
+        g_failed_check = check_num;
+
+    val_report_check_record(test_id, check_num, status, time_us, &perf);
+}
+
+/**
+    @brief    - Keeps the first failing checkpoint reported by the running test
+    @param    - checkpoint : Checkpoint number
+    @return   - void
+**/
+void val_set_failed_checkpoint(uint32_t checkpoint)
+{
+    if (!g_failed_checkpoint)
+        g_failed_checkpoint = checkpoint;
+}
+
+/**
+    @brief    - Returns the details of the last run test: description, status code,
+                failing check and checkpoint, slowest check, scratch usage and
+                performance counts
+    @param    - result : Test result record to complete
+    @return   - void
+**/
+void val_get_test_details(val_test_result_t *result)
+{
+    result->desc              = g_test_desc;
+    result->status_code       = val_get_status() & TEST_STATUS_CODE_MASK;
+    result->failed_check      = g_failed_check;
+    result->failed_checkpoint = g_failed_checkpoint;
+    result->check_num         = g_slowest_check_num;
+    result->check_time_us     = g_slowest_check_us;
+    result->scratch_bytes     = val_scratch_high_water();
+    result->perf              = g_test_perf;
+}
+
 /**
     @brief    - This function executes given list of tests from non-secure sequentially
                 This covers non-secure to secure IPC API scenario
@@ -101,13 +181,13 @@ val_status_t val_execute_non_secure_tests(uint32_t test_num, const client_test_t
     val_status_t          test_status = VAL_STATUS_SUCCESS;
     boot_t                boot;
     uint32_t              i = 1;
+    uint64_t              check_start;
+    pal_perf_counts_t     check_perf;
 #ifdef IPC
     psa_handle_t          handle;
     test_info_ipc_t       test_info;
 
     test_info.test_num = test_num;
-#else
-   (void)test_num;
 #endif
 
     status = val_get_boot_flag(&boot.state);
@@ -131,14 +211,14 @@ val_status_t val_execute_non_secure_tests(uint32_t test_num, const client_test_t
 
             if ((boot.state ==  BOOT_EXPECTED_REENTER_TEST) && (i == 1))
             {
-                val_print(DBG, "[Check 1] PASSED\n", 0);
+                VAL_PRINT(DBG, "[Check 1] PASSED\n", 0);
                 i++;
                 continue;
             }
 
             if ((boot.state ==  BOOT_EXPECTED_ON_SECOND_CHECK) && (i == 1))
             {
-                val_print(DBG, "[Check 2] PASSED\n", 0);
+                VAL_PRINT(DBG, "[Check 2] PASSED\n", 0);
                 i = i + 2 ;
                 continue;
             }
@@ -170,18 +250,20 @@ val_status_t val_execute_non_secure_tests(uint32_t test_num, const client_test_t
                 if (VAL_ERROR(status))
                 {
                     val_set_status(RESULT_FAIL(status));
-                    val_print(DBG, "[Check %d] START\n", i);
+                    VAL_PRINT(DBG, "[Check %d] START\n", i);
                     return status;
                 }
                 else
                 {
-                    val_print(DBG, "[Check %d] START\n", i);
+                    VAL_PRINT(DBG, "[Check %d] START\n", i);
                 }
             }
 #endif
             /* keep track of the test block numbers, helps when the panic happened */
             status = val_set_test_data(NVM_TEST_DATA2, i);
             /* Execute client tests */
+            pal_perf_read(&check_perf);
+            check_start = val_get_time_ns();
             test_status = tests_list[i](CALLER_NONSECURE);
 #ifdef IPC
             if (server_hs == TRUE)
@@ -191,25 +273,26 @@ val_status_t val_execute_non_secure_tests(uint32_t test_num, const client_test_t
             }
 #endif
             status = test_status ? test_status:status;
+            val_record_check(test_num, i, status, check_start, &check_perf);
             if (IS_TEST_SKIP(status))
             {
                 val_set_status(status);
                 if (server_hs == TRUE)
-                    val_print(DBG, "[Check %d] SKIPPED\n", i);
+                    VAL_PRINT(DBG, "[Check %d] SKIPPED\n", i);
                 return status;
             }
             else if (VAL_ERROR(status))
             {
                 val_set_status(RESULT_FAIL(status));
                 if (server_hs == TRUE)
-                    val_print(DBG, "[Check %d] FAILED\n", i);
+                    VAL_PRINT(DBG, "[Check %d] FAILED\n", i);
 
                 return status;
             }
             else
             {
                 if (server_hs == TRUE)
-                    val_print(DBG, "[Check %d] PASSED\n", i);
+                    VAL_PRINT(DBG, "[Check %d] PASSED\n", i);
             }
 
             i++;
@@ -221,7 +304,7 @@ val_status_t val_execute_non_secure_tests(uint32_t test_num, const client_test_t
        status = VAL_STATUS_SUCCESS;
        if (boot.state != BOOT_EXPECTED_S)
        {
-            val_print(DBG, "[Check 1] PASSED\n", 0);
+            VAL_PRINT(DBG, "[Check 1] PASSED\n", 0);
        }
    }
    return status;
@@ -261,13 +344,13 @@ val_status_t val_switch_to_secure_client(uint32_t test_num)
        if (boot.state ==  BOOT_EXPECTED_REENTER_TEST)
        {
             test_info.block_num++;
-            val_print(DBG, "[Check 1] PASSED\n", 0);
+            VAL_PRINT(DBG, "[Check 1] PASSED\n", 0);
        }
 
        if (boot.state ==  BOOT_EXPECTED_ON_SECOND_CHECK)
        {
             test_info.block_num = test_info.block_num + 2;
-            val_print(DBG, "[Check 2] PASSED\n", 0);
+            VAL_PRINT(DBG, "[Check 2] PASSED\n", 0);
        }
        status = val_set_boot_flag(BOOT_NOT_EXPECTED);
        if (VAL_ERROR(status))
@@ -309,7 +392,7 @@ val_status_t val_switch_to_secure_client(uint32_t test_num)
 		   return VAL_STATUS_ERROR;
 	   }
 	   test_info.block_num = test_data + 1;
-	   val_print(DBG, "[Check %d] PASSED\n", test_data);
+	   VAL_PRINT(DBG, "[Check %d] PASSED\n", test_data);
 	   status = val_set_boot_flag(BOOT_NOT_EXPECTED);
 	   if (VAL_ERROR(status))
 	   {
@@ -345,7 +428,7 @@ val_status_t val_switch_to_secure_client(uint32_t test_num)
     else
     {
         /* If we are here means, we are in third run of this test */
-        val_print(DBG, "[Check 1] PASSED\n", 0);
+        VAL_PRINT(DBG, "[Check 1] PASSED\n", 0);
         return VAL_STATUS_SUCCESS;
     }
 
@@ -522,7 +605,7 @@ val_status_t val_err_check_set(uint32_t checkpoint, val_status_t status)
         }
         else
         {
-            val_print(DBG, "\tCheckpoint %d \n", checkpoint);
+            VAL_PRINT(DBG, "\tCheckpoint %d \n", checkpoint);
         }
     }
     return status;
@@ -561,15 +644,30 @@ void val_test_init(uint32_t test_num, uint32_t comp_num, char8_t *desc, uint32_t
         case VAL_INITIAL_ATTESTATION_BASE:
             suite = "Attestation";
             break;
+        case VAL_CRYPTO_BENCH_BASE:
+            suite = "Crypto Benchmark";
+            break;
         default:
             suite = "Unknown";
             break;
     }
 
    /*global init*/
+   g_test_desc                 = desc;
+   g_slowest_check_num         = 0;
+   g_slowest_check_us          = 0;
+   g_failed_check              = 0;
+   g_failed_checkpoint         = 0;
+   g_test_perf.count           = 0;
    status_buffer->state        = TEST_FAIL;
    status_buffer->status_code  = VAL_STATUS_INVALID;
 
+   /* The scratch buffers of the previous test are released */
+   val_scratch_reset();
+
+   /* Cycles, instructions and cache misses of the test, when the platform counts them */
+   pal_perf_start();
+
    val_print(ALWAYS, "\rSuite=", 0);
    val_print(ALWAYS, suite, 0);
    val_print(ALWAYS, " : Test=", 0);
@@ -616,6 +714,13 @@ void val_test_exit(void)
 {
     val_status_t         status = VAL_STATUS_SUCCESS;
 
+    pal_perf_read(&g_test_perf);
+
+    VAL_PRINT(DBG, "\tScratch high-water=%d bytes\n", val_scratch_high_water());
+
+    /* Prints are held in the log buffer while the test runs */
+    val_log_flush();
+
 #ifdef WATCHDOG_AVAILABLE
     status = val_watchdog_disable();
     if (VAL_ERROR(status))
@@ -647,7 +752,6 @@ void val_test_exit(void)
 val_status_t val_get_last_run_test_id(test_id_t *test_id)
 {
     val_status_t    status;
-    regre_report_t  test_count;
     boot_t          boot;
     int             intermediate_boot = 0;
     uint8_t         boot_state[] = {BOOT_NOT_EXPECTED,
@@ -665,7 +769,7 @@ val_status_t val_get_last_run_test_id(test_id_t *test_id)
         return status;
     }
 
-    val_print(INFO, "\n\tboot.state=0x%x", boot.state);
+    VAL_PRINT(INFO, "\n\tboot.state=0x%x", boot.state);
 
     intermediate_boot = is_reboot_run(boot.state, boot_state,
                                     sizeof(boot_state)/sizeof(boot_state[0]));
@@ -678,40 +782,18 @@ val_status_t val_get_last_run_test_id(test_id_t *test_id)
          {
              return status;
          }
-
-         *test_id = VAL_INVALID_TEST_ID;
-         status = val_nvm_write(VAL_NVM_OFFSET(NVM_PREVIOUS_TEST_ID),
-                                  test_id, sizeof(test_id_t));
-         if (VAL_ERROR(status))
-         {
-             val_print(ALWAYS, "\n\tNVMEM write error", 0);
-             return status;
-         }
-
-         val_reset_regression_report(&test_count);
-         status = (val_nvm_write(VAL_NVM_OFFSET(NVM_TOTAL_PASS_INDEX),
-                        &test_count.total_pass, sizeof(uint32_t)) ||
-                   val_nvm_write(VAL_NVM_OFFSET(NVM_TOTAL_FAIL_INDEX),
-                        &test_count.total_fail, sizeof(uint32_t))  ||
-                   val_nvm_write(VAL_NVM_OFFSET(NVM_TOTAL_SKIP_INDEX),
-                        &test_count.total_skip, sizeof(uint32_t))  ||
-                   val_nvm_write(VAL_NVM_OFFSET(NVM_TOTAL_ERROR_INDEX),
-                        &test_count.total_error, sizeof(uint32_t)));
-
-         if (VAL_ERROR(status))
-         {
-             val_print(ERROR, "\n\tNVMEM write error", 0);
-             return status;
-         }
     }
 
-    status = val_nvm_read(VAL_NVM_OFFSET(NVM_PREVIOUS_TEST_ID), test_id, sizeof(test_id_t));
+    /* Suite summary and test IDs are kept in a single progress record */
+    status = val_progress_load(!intermediate_boot);
     if (VAL_ERROR(status))
     {
-        val_print(ERROR, "\n\tNVMEM read error", 0);
+        return status;
     }
 
-    val_print(INFO, "In val_get_last_run_test_id, test_id=%x\n", *test_id);
+    *test_id = val_progress_get()->prev_test_id;
+
+    VAL_PRINT(INFO, "In val_get_last_run_test_id, test_id=%x\n", *test_id);
     return status;
 }
 
@@ -726,6 +808,9 @@ val_status_t val_set_boot_flag(boot_state_t state)
    boot_t           boot;
    val_status_t     status;
 
+   /* The test may be about to reset the system, or to panic */
+   val_log_flush();
+
    boot.state = state;
    status = val_nvm_write(VAL_NVM_OFFSET(NVM_BOOT), &boot, sizeof(boot_t));
    if (VAL_ERROR(status))
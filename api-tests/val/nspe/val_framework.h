@@ -22,6 +22,7 @@
 #include "val.h"
 #include "val_client_defs.h"
 #include "val_interfaces.h"
+#include "val_dispatcher.h"
 
 /* prototypes */
 uint32_t     val_report_status_bespoke(void);
@@ -50,5 +51,7 @@ val_status_t val_set_boot_flag(boot_state_t state);
 val_status_t val_get_boot_flag(boot_state_t *state);
 val_status_t val_set_test_data(int32_t nvm_index, int32_t test_data);
 val_status_t val_get_test_data(int32_t nvm_index, int32_t *test_data);
+void         val_get_test_details(val_test_result_t *result);
+void         val_set_failed_checkpoint(uint32_t checkpoint);
 
 #endif
@@ -31,6 +31,7 @@ const val_api_t val_api = {
     .test_init                 = val_test_init,
     .test_exit                 = val_test_exit,
     .err_check_set             = val_err_check_set,
+    .set_failed_checkpoint     = val_set_failed_checkpoint,
     .execute_non_secure_tests  = val_execute_non_secure_tests,
 #ifdef IPC
     .switch_to_secure_client   = val_switch_to_secure_client,
@@ -60,6 +61,17 @@ const val_api_t val_api = {
     .crypto_function           = val_crypto_function,
     .storage_function          = val_storage_function,
     .attestation_function      = val_attestation_function,
+    .get_time_ns               = val_get_time_ns,
+    .get_cpu_count             = val_get_cpu_count,
+    .thread_run                = val_thread_run,
+    .vector_open               = val_vector_open,
+    .vector_next               = val_vector_next,
+    .scratch_alloc             = val_scratch_alloc,
+#ifdef CRYPTO
+    .crypto                    = &pal_crypto_api,
+#else
+    .crypto                    = NULL,
+#endif
 };
 
 const psa_api_t psa_api = {
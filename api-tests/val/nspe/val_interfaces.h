@@ -20,6 +20,8 @@
 
 #include "val.h"
 #include "val_client_defs.h"
+#include "val_vectors.h"
+#include "val_scratch.h"
 #include "pal_interfaces_ns.h"
 
 /* typedef's */
@@ -32,6 +34,7 @@ typedef struct {
                                                    char8_t *desc, uint32_t test_bitfield);
     void             (*test_exit)                 (void);
     val_status_t     (*err_check_set)             (uint32_t checkpoint, val_status_t status);
+    void             (*set_failed_checkpoint)     (uint32_t checkpoint);
     val_status_t     (*execute_non_secure_tests)  (uint32_t test_num,
                                                    const client_test_t *tests_list,
                                                    bool_t server_hs);
@@ -61,6 +64,18 @@ typedef struct {
     int32_t          (*crypto_function)           (int type, ...);
     int32_t          (*storage_function)          (int type, ...);
     int32_t          (*attestation_function)      (int type, ...);
+    uint64_t         (*get_time_ns)               (void);
+    uint32_t         (*get_cpu_count)             (void);
+    val_status_t     (*thread_run)                (uint32_t count, pal_thread_fn_t fn,
+                                                   void *arg);
+    val_status_t     (*vector_open)               (const char *name,
+                                                   const val_vector_field_t *fields,
+                                                   uint32_t field_count,
+                                                   val_vector_file_t *file);
+    val_status_t     (*vector_next)               (val_vector_file_t *file, void *vector,
+                                                   const void *defaults, size_t size);
+    void            *(*scratch_alloc)             (size_t size);
+    const pal_crypto_api_t *crypto;
 } val_api_t;
 
 typedef struct {
@@ -0,0 +1,220 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_log.h"
+#include "val_peripherals.h"
+#include "pal_interfaces_ns.h"
+
+/* Buffered entry: verbosity, data and the null terminated string */
+#define VAL_LOG_ENTRY_HEADER         (1 + sizeof(int32_t))
+
+#if PLATFORM_LOG_BUFFER_SIZE
+static uint8_t  g_log_buffer[PLATFORM_LOG_BUFFER_SIZE];
+static uint32_t g_log_length;
+#endif
+
+#ifdef TOKENIZED_LOG
+/* FNV-1a hashes of the string literals of the suite, sorted */
+static const uint32_t g_log_tokens[] = {
+#include "val_log_tokens.inc"
+};
+
+/**
+    @brief    - Computes the FNV-1a hash of a string, as gen_log_tokens.py does
+    @param    - string : Null terminated string
+    @return   - Hash
+**/
+static uint32_t val_log_hash(const char *string)
+{
+    uint32_t hash = 0x811C9DC5;
+
+    while (*string)
+    {
+        hash ^= (uint8_t)*string++;
+        hash *= 0x01000193;
+    }
+
+    return hash;
+}
+
+/**
+    @brief    - Looks up the token of a format string
+    @param    - string : Format string
+    @return   - Token, 0 if the string is not in the token table
+**/
+static uint32_t val_log_token(const char *string)
+{
+    uint32_t hash = val_log_hash(string);
+    uint32_t low = 0;
+    uint32_t high = sizeof(g_log_tokens)/sizeof(g_log_tokens[0]);
+    uint32_t mid;
+
+    while (low < high)
+    {
+        mid = low + (high - low) / 2;
+        if (g_log_tokens[mid] == hash)
+            return mid + 1;
+        else if (g_log_tokens[mid] < hash)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+
+    return 0;
+}
+
+/**
+    @brief    - Sends a value as a LEB128 varint
+    @param    - value : Value
+    @return   - Number of bytes which could not be sent
+**/
+static uint32_t val_log_varint(uint32_t value)
+{
+    uint32_t errors = 0;
+
+    while (value >= 0x80)
+    {
+        errors += (pal_uart_putc((uint8_t)(value | 0x80)) != PAL_STATUS_SUCCESS);
+        value >>= 7;
+    }
+    errors += (pal_uart_putc((uint8_t)value) != PAL_STATUS_SUCCESS);
+
+    return errors;
+}
+
+/**
+    @brief    - Sends a print as a tokenized log frame. The format string is replaced
+                by its index in the token table generated by gen_log_tokens.py.
+    @param    - string : Format string
+                data   : Value for format specifier
+    @return   - val_status_t
+**/
+static val_status_t val_log_tokenized(const char *string, int32_t data)
+{
+    uint32_t token = val_log_token(string);
+    uint32_t errors;
+
+    errors = (pal_uart_putc(VAL_LOG_FRAME) != PAL_STATUS_SUCCESS);
+    errors += val_log_varint(token);
+    if (!token)
+    {
+        do
+        {
+            errors += (pal_uart_putc((uint8_t)*string) != PAL_STATUS_SUCCESS);
+        } while (*string++);
+    }
+
+    /* Zigzag encoding, small negative values are as short as small positive ones */
+    errors += val_log_varint((data < 0) ? ~((uint32_t)data << 1) : ((uint32_t)data << 1));
+
+    return errors ? VAL_STATUS_ERROR : VAL_STATUS_SUCCESS;
+}
+#endif
+
+/**
+    @brief    - Sends a print to the console
+    @param    - verbosity : Print verbosity level
+                string    : Format string
+                data      : Value for format specifier
+    @return   - val_status_t
+**/
+static val_status_t val_log_send(print_verbosity_t verbosity, const char *string, int32_t data)
+{
+#if defined(TOKENIZED_LOG)
+    (void)verbosity;
+    return val_log_tokenized(string, data);
+#elif defined(BESPOKE_PRINT_NS)
+    (void)verbosity;
+    return pal_print_ns(string, data);
+#else
+    return val_printf(verbosity, string, data);
+#endif
+}
+
+/**
+    @brief    - Appends a print to the log buffer. The buffer is flushed when it is
+                full and on error prints, which go out with the prints leading to them.
+    @param    - verbosity : Print verbosity level
+                string    : Format string
+                data      : Value for format specifier
+    @return   - val_status_t
+**/
+val_status_t val_log_write(print_verbosity_t verbosity, const char *string, int32_t data)
+{
+#if PLATFORM_LOG_BUFFER_SIZE
+    size_t          length = VAL_LOG_ENTRY_HEADER + strlen(string) + 1;
+    val_status_t    status = VAL_STATUS_SUCCESS;
+
+    if (g_log_length + length > PLATFORM_LOG_BUFFER_SIZE)
+    {
+        status = val_log_flush();
+
+        /* Too large to be buffered at all */
+        if (length > PLATFORM_LOG_BUFFER_SIZE)
+        {
+            return VAL_ERROR(status) ? status : val_log_send(verbosity, string, data);
+        }
+    }
+
+    g_log_buffer[g_log_length] = (uint8_t)verbosity;
+    memcpy(&g_log_buffer[g_log_length + 1], &data, sizeof(data));
+    memcpy(&g_log_buffer[g_log_length + VAL_LOG_ENTRY_HEADER], string,
+           length - VAL_LOG_ENTRY_HEADER);
+    g_log_length += length;
+
+    if (verbosity == ERROR)
+    {
+        return val_log_flush();
+    }
+
+    return status;
+#else
+    return val_log_send(verbosity, string, data);
+#endif
+}
+
+/**
+    @brief    - Sends the buffered prints to the console
+    @param    - None
+    @return   - val_status_t
+**/
+val_status_t val_log_flush(void)
+{
+    val_status_t    status = VAL_STATUS_SUCCESS;
+#if PLATFORM_LOG_BUFFER_SIZE
+    val_status_t    ret;
+    const char      *string;
+    int32_t         data;
+    uint32_t        offset = 0;
+
+    while (offset < g_log_length)
+    {
+        string = (const char *)&g_log_buffer[offset + VAL_LOG_ENTRY_HEADER];
+        memcpy(&data, &g_log_buffer[offset + 1], sizeof(data));
+
+        ret = val_log_send((print_verbosity_t)g_log_buffer[offset], string, data);
+        if (VAL_ERROR(ret))
+        {
+            status = ret;
+        }
+        offset += VAL_LOG_ENTRY_HEADER + strlen(string) + 1;
+    }
+    g_log_length = 0;
+#endif
+
+    return status;
+}
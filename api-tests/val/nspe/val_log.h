@@ -0,0 +1,52 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _VAL_LOG_H_
+#define _VAL_LOG_H_
+
+#include "val.h"
+
+/* Size of the buffer which holds the prints between two flushes, 0 to send each
+   print to the console as it is made. Buffering is opted in by the platform, the
+   prints held when a test hangs or faults are lost unless its fault handler calls
+   val_log_flush(). */
+#ifndef PLATFORM_LOG_BUFFER_SIZE
+#define PLATFORM_LOG_BUFFER_SIZE     0
+#endif
+
+/* Start of a tokenized log frame, followed by the token and the data as varints.
+   Token 0 is followed by the null terminated format string, for the strings which
+   are not in the token table. */
+#define VAL_LOG_FRAME                0x1F
+
+/**
+    @brief    - Appends a print to the log buffer. The buffer is flushed when it is
+                full and on error prints, which go out with the prints leading to them.
+    @param    - verbosity : Print verbosity level
+                string    : Format string
+                data      : Value for format specifier
+    @return   - val_status_t
+**/
+val_status_t val_log_write(print_verbosity_t verbosity, const char *string, int32_t data);
+
+/**
+    @brief    - Sends the buffered prints to the console
+    @param    - None
+    @return   - val_status_t
+**/
+val_status_t val_log_flush(void);
+#endif
@@ -19,6 +19,7 @@
 #include "pal_interfaces_ns.h"
 #include "val_framework.h"
 #include "val_client_defs.h"
+#include "val_log.h"
 
 /* Global */
 uint32_t   is_uart_init_done = 0;
@@ -49,11 +50,7 @@ val_status_t val_print(print_verbosity_t verbosity, const char *string, int32_t
     {
        return VAL_STATUS_SUCCESS;
     }
-#ifdef BESPOKE_PRINT_NS
-    return pal_print_ns(string, data);
-#else
-    return val_printf(verbosity, string, data);
-#endif
+    return val_log_write(verbosity, string, data);
 }
 
 /* Watchdog APIs */
@@ -91,6 +88,10 @@ val_status_t val_wd_timer_init(wd_timeout_type_t timeout_type)
 val_status_t val_wd_reprogram_timer(wd_timeout_type_t timeout_type)
 {
     val_status_t    status = VAL_STATUS_SUCCESS;
+
+    /* The prints leading to a hang are out before the watchdog resets the system */
+    val_log_flush();
+
 #ifdef WATCHDOG_AVAILABLE
     /* Disable watchdog Timer */
     val_watchdog_disable();
@@ -114,3 +115,44 @@ val_status_t val_wd_reprogram_timer(wd_timeout_type_t timeout_type)
 
     return status;
 }
+
+/**
+    @brief    - Reads the platform timestamp counter
+    @param    - None
+    @return   - Time in nano seconds, 0 if the platform has no timestamp counter
+**/
+uint64_t val_get_time_ns(void)
+{
+    uint64_t ticks = pal_timestamp();
+
+    return (ticks / PLATFORM_TIMESTAMP_TICKS_PER_US) * 1000 +
+           ((ticks % PLATFORM_TIMESTAMP_TICKS_PER_US) * 1000) / PLATFORM_TIMESTAMP_TICKS_PER_US;
+}
+
+/**
+    @brief    - Returns the number of CPUs available to the threads of val_thread_run
+    @param    - None
+    @return   - Number of CPUs, 1 if the platform has no thread support
+**/
+uint32_t val_get_cpu_count(void)
+{
+    return pal_get_cpu_count();
+}
+
+/**
+    @brief    - Runs a function on several concurrent threads and waits for all of them
+    @param    - count : Number of threads
+                fn    : Function run by each thread, with its thread index
+                arg   : Argument passed to each thread
+    @return   - VAL_STATUS_SUCCESS, VAL_STATUS_UNSUPPORTED if the platform cannot run
+                count threads, VAL_STATUS_ERROR otherwise
+**/
+val_status_t val_thread_run(uint32_t count, pal_thread_fn_t fn, void *arg)
+{
+    int status = pal_thread_run(count, fn, arg);
+
+    if (status == PAL_STATUS_UNSUPPORTED_FUNC)
+        return VAL_STATUS_UNSUPPORTED;
+
+    return (status == PAL_STATUS_SUCCESS) ? VAL_STATUS_SUCCESS : VAL_STATUS_ERROR;
+}
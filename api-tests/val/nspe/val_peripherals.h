@@ -21,8 +21,20 @@
 #include "val.h"
 #include "val_common_peripherals.h"
 
+/* val_print of the VAL, compiled out below the VERBOSITY of the build */
+#define VAL_PRINT(level, string, data)                                              \
+    do {                                                                            \
+        if (VAL_PRINT_ENABLED(level))                                               \
+        {                                                                           \
+            val_print(level, string, data);                                         \
+        }                                                                           \
+    } while (0)
+
 val_status_t val_uart_init(void);
 val_status_t val_print(print_verbosity_t verbosity, const char *string, int32_t data);
 val_status_t val_wd_timer_init(wd_timeout_type_t timeout_type);
 val_status_t val_wd_reprogram_timer(wd_timeout_type_t timeout_type);
+uint64_t     val_get_time_ns(void);
+uint32_t     val_get_cpu_count(void);
+val_status_t val_thread_run(uint32_t count, pal_thread_fn_t fn, void *arg);
 #endif
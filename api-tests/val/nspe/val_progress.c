@@ -0,0 +1,180 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include <stddef.h>
+#include "val_progress.h"
+#include "val_peripherals.h"
+
+#define VAL_PROGRESS_SLOTS           2
+#define VAL_PROGRESS_SLOT_OFFSET(n)  (VAL_NVM_PROGRESS_OFFSET + (n) * sizeof(val_progress_t))
+
+/* The reads of the dispatcher are served from this shadow, NVM is only read at boot */
+static val_progress_t g_progress;
+
+/**
+    @brief    - Computes the CRC-32 (IEEE 802.3) of a progress record, excluding
+                its crc field
+    @param    - progress : Progress record
+    @return   - CRC-32
+**/
+static uint32_t val_progress_crc(const val_progress_t *progress)
+{
+    const uint8_t *data = (const uint8_t *)progress;
+    uint32_t       crc = 0xFFFFFFFF;
+    size_t         i;
+    int            bit;
+
+    for (i = 0; i < offsetof(val_progress_t, crc); i++)
+    {
+        crc ^= data[i];
+        for (bit = 0; bit < 8; bit++)
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+
+    return ~crc;
+}
+
+/**
+    @brief    - Loads the most recent valid progress record from NVM into its RAM
+                shadow, or starts a new one
+    @param    - first_boot : Non zero to discard the NVM content and start a new
+                             suite summary
+    @return   - Error code, VAL_STATUS_ERROR if no valid record is found on an
+                intermediate boot
+**/
+val_status_t val_progress_load(int first_boot)
+{
+    val_progress_t  slot;
+    val_status_t    status;
+    int             found = 0;
+    int             i;
+
+    if (first_boot)
+    {
+        g_progress.seq = 0;
+        g_progress.cur_test_id = VAL_INVALID_TEST_ID;
+        g_progress.prev_test_id = VAL_INVALID_TEST_ID;
+        val_reset_regression_report(&g_progress.test_count);
+        g_progress.time_ms = 0;
+        g_progress.stack_bytes = 0;
+        g_progress.stack_test_id = VAL_INVALID_TEST_ID;
+        g_progress.heap_bytes = 0;
+        g_progress.heap_test_id = VAL_INVALID_TEST_ID;
+        return val_progress_commit();
+    }
+
+    for (i = 0; i < VAL_PROGRESS_SLOTS; i++)
+    {
+        status = val_nvm_read(VAL_PROGRESS_SLOT_OFFSET(i), &slot, sizeof(slot));
+        if (VAL_ERROR(status))
+        {
+            val_print(ERROR, "\n\tNVMEM read error", 0);
+            return status;
+        }
+
+        if (slot.crc != val_progress_crc(&slot))
+        {
+            /* Torn by a reset during its write, the other slot holds the previous record */
+            VAL_PRINT(INFO, "\n\tDiscarding torn progress record in slot %d", i);
+            continue;
+        }
+
+        if (!found || (int32_t)(slot.seq - g_progress.seq) > 0)
+        {
+            g_progress = slot;
+            found = 1;
+        }
+    }
+
+    if (!found)
+    {
+        val_print(ERROR, "\n\tNo valid progress record in NVMEM", 0);
+        return VAL_STATUS_ERROR;
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Returns the RAM shadow of the progress record
+    @param    - None
+    @return   - Progress record
+**/
+const val_progress_t *val_progress_get(void)
+{
+    return &g_progress;
+}
+
+/**
+    @brief    - Records the test about to run, together with the results accounted
+                since the last write, in a single NVM write
+    @param    - test_id : Test ID
+    @return   - Error code
+**/
+val_status_t val_progress_begin_test(test_id_t test_id)
+{
+    g_progress.cur_test_id = test_id;
+    return val_progress_commit();
+}
+
+/**
+    @brief    - Accounts the result of a test in the RAM shadow. It is written to
+                NVM by the next val_progress_begin_test or val_progress_commit.
+    @param    - result : Result record of the completed test
+    @return   - void
+**/
+void val_progress_account(const val_test_result_t *result)
+{
+    val_update_regression_report(result->test_result, &g_progress.test_count);
+    g_progress.prev_test_id = result->test_id;
+
+    /* Kept for the timing and memory reports, the tests run before a reset included */
+    g_progress.time_ms += (result->time_us + 500) / 1000;
+    if (result->stack_bytes > g_progress.stack_bytes)
+    {
+        g_progress.stack_bytes   = result->stack_bytes;
+        g_progress.stack_test_id = result->test_id;
+    }
+    if (result->heap_bytes > g_progress.heap_bytes)
+    {
+        g_progress.heap_bytes   = result->heap_bytes;
+        g_progress.heap_test_id = result->test_id;
+    }
+}
+
+/**
+    @brief    - Writes the RAM shadow of the progress record to NVM
+    @param    - None
+    @return   - Error code
+**/
+val_status_t val_progress_commit(void)
+{
+    val_status_t    status;
+
+    g_progress.seq++;
+    g_progress.crc = val_progress_crc(&g_progress);
+
+    status = val_nvm_write(VAL_PROGRESS_SLOT_OFFSET(g_progress.seq % VAL_PROGRESS_SLOTS),
+                           &g_progress, sizeof(g_progress));
+    if (VAL_ERROR(status))
+    {
+        val_print(ERROR, "\n\tNVMEM write error", 0);
+        return status;
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
@@ -0,0 +1,85 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _VAL_PROGRESS_H_
+#define _VAL_PROGRESS_H_
+
+#include "val.h"
+#include "val_dispatcher.h"
+
+/* NVM offset of the two slots of the progress record. They follow the indexes of the
+ * common VAL, a platform with a different NVM layout can move them.
+ */
+#ifndef VAL_NVM_PROGRESS_OFFSET
+#define VAL_NVM_PROGRESS_OFFSET      VAL_NVM_OFFSET(NVM_PREVIOUS_TEST_ID + 1)
+#endif
+
+/* Progress of the suite across resets, written as a single NVM record. The slots
+   are written alternately so that a torn write leaves the previous record intact. */
+typedef struct {
+    uint32_t        seq;            /* Incremented by each write */
+    test_id_t       cur_test_id;    /* Test being run */
+    test_id_t       prev_test_id;   /* Last accounted test */
+    regre_report_t  test_count;     /* Suite summary */
+    uint32_t        time_ms;        /* Run time of the accounted tests */
+    uint32_t        stack_bytes;    /* Peak stack use of the accounted tests */
+    test_id_t       stack_test_id;  /* Test with the peak stack use */
+    uint32_t        heap_bytes;     /* Peak heap use of the accounted tests */
+    test_id_t       heap_test_id;   /* Test with the peak heap use */
+    uint32_t        crc;            /* CRC-32 of the above fields */
+} val_progress_t;
+
+/**
+    @brief    - Loads the most recent valid progress record from NVM into its RAM
+                shadow, or starts a new one
+    @param    - first_boot : Non zero to discard the NVM content and start a new
+                             suite summary
+    @return   - Error code, VAL_STATUS_ERROR if no valid record is found on an
+                intermediate boot
+**/
+val_status_t val_progress_load(int first_boot);
+
+/**
+    @brief    - Returns the RAM shadow of the progress record
+    @param    - None
+    @return   - Progress record
+**/
+const val_progress_t *val_progress_get(void);
+
+/**
+    @brief    - Records the test about to run, together with the results accounted
+                since the last write, in a single NVM write
+    @param    - test_id : Test ID
+    @return   - Error code
+**/
+val_status_t val_progress_begin_test(test_id_t test_id);
+
+/**
+    @brief    - Accounts the result of a test in the RAM shadow. It is written to
+                NVM by the next val_progress_begin_test or val_progress_commit.
+    @param    - result : Result record of the completed test
+    @return   - void
+**/
+void val_progress_account(const val_test_result_t *result);
+
+/**
+    @brief    - Writes the RAM shadow of the progress record to NVM
+    @param    - None
+    @return   - Error code
+**/
+val_status_t val_progress_commit(void);
+#endif
@@ -0,0 +1,435 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_results.h"
+#include "val_entry.h"
+#include "val_peripherals.h"
+#include "val_test_select.h"
+#include "pal_interfaces_ns.h"
+
+/* Result records are JSON texts, one per line. Platforms with a file system write
+ * them, and the JUnit XML report, through pal_result_write(). Other platforms
+ * print the JSON records on the console when built with RESULT_RECORDS, each one
+ * preceded by an ASCII record separator as in RFC 7464, so that they can be
+ * extracted from the test log by tools/utils/extract_results.py.
+ */
+#define VAL_RESULT_RS                "\x1e"
+
+/* Maximum number of description characters kept in a record */
+#define VAL_RESULT_DESC_LEN          200
+
+typedef struct {
+    char     buf[VAL_RESULT_RECORD_SIZE];
+    uint32_t len;
+} val_record_t;
+
+/**
+    @brief    - Appends a string to a record
+    @param    - rec : Record
+                str : String to append
+                len : Number of characters to append
+    @return   - void
+**/
+static void val_rec_append(val_record_t *rec, const char *str, uint32_t len)
+{
+    while (len-- && *str && rec->len < sizeof(rec->buf) - 1)
+        rec->buf[rec->len++] = *str++;
+    rec->buf[rec->len] = '\0';
+}
+
+/**
+    @brief    - Appends a null terminated string to a record
+    @param    - rec : Record
+                str : String to append
+    @return   - void
+**/
+static void val_rec_str(val_record_t *rec, const char *str)
+{
+    val_rec_append(rec, str, (uint32_t)-1);
+}
+
+/**
+    @brief    - Appends a number to a record
+    @param    - rec    : Record
+                value  : Number to append
+                base   : 10 or 16
+                digits : Minimum number of digits
+    @return   - void
+**/
+static void val_rec_num(val_record_t *rec, uint64_t value, uint32_t base, uint32_t digits)
+{
+    char     tmp[24];
+    uint32_t i = 0;
+
+    do {
+        tmp[i++] = "0123456789abcdef"[value % base];
+        value /= base;
+    } while (value || i < digits);
+
+    while (i--)
+        val_rec_append(rec, &tmp[i], 1);
+}
+
+/**
+    @brief    - Appends a duration in seconds to a record, e.g 0.001250
+    @param    - rec     : Record
+                time_us : Duration in micro seconds
+    @return   - void
+**/
+static void val_rec_seconds(val_record_t *rec, uint64_t time_us)
+{
+    val_rec_num(rec, (uint32_t)(time_us / 1000000), 10, 1);
+    val_rec_str(rec, ".");
+    val_rec_num(rec, (uint32_t)(time_us % 1000000), 10, 6);
+}
+
+/**
+    @brief    - Returns the length of a test description without its trailing
+                separators, e.g "psa_aead_encrypt : Desc=crypto AEAD APIs : "
+    @param    - desc : Test description
+    @return   - Number of characters to keep
+**/
+static uint32_t val_desc_len(const char *desc)
+{
+    uint32_t len = 0;
+
+    if (!desc)
+        return 0;
+
+    while (desc[len] && len < VAL_RESULT_DESC_LEN)
+        len++;
+
+    while (len && (desc[len - 1] == ' ' || desc[len - 1] == ':' ||
+                   desc[len - 1] == '\n' || desc[len - 1] == '\r'))
+        len--;
+
+    return len;
+}
+
+/**
+    @brief    - Appends a quoted JSON string to a record. The % character is escaped
+                as well since the record may go through val_print.
+    @param    - rec : Record
+                str : String to append
+                len : Number of characters to append
+    @return   - void
+**/
+static void val_rec_json_str(val_record_t *rec, const char *str, uint32_t len)
+{
+    val_rec_str(rec, "\"");
+    for (; len && *str; len--, str++)
+    {
+        if (*str == '"' || *str == '\\')
+        {
+            val_rec_str(rec, "\\");
+            val_rec_append(rec, str, 1);
+        }
+        else if ((uint8_t)*str < 0x20 || *str == '%')
+        {
+            val_rec_str(rec, "\\u00");
+            val_rec_num(rec, (uint8_t)*str, 16, 2);
+        }
+        else
+        {
+            val_rec_append(rec, str, 1);
+        }
+    }
+    val_rec_str(rec, "\"");
+}
+
+/**
+    @brief    - Appends an XML attribute value to a record
+    @param    - rec : Record
+                str : String to append
+                len : Number of characters to append
+    @return   - void
+**/
+static void val_rec_xml_str(val_record_t *rec, const char *str, uint32_t len)
+{
+    for (; len && *str; len--, str++)
+    {
+        if (*str == '&')
+            val_rec_str(rec, "&amp;");
+        else if (*str == '<')
+            val_rec_str(rec, "&lt;");
+        else if (*str == '>')
+            val_rec_str(rec, "&gt;");
+        else if (*str == '"')
+            val_rec_str(rec, "&quot;");
+        else if ((uint8_t)*str >= 0x20)
+            val_rec_append(rec, str, 1);
+    }
+}
+
+/**
+    @brief    - Appends a key followed by a number to a record
+    @param    - rec   : Record
+                key   : Key, including its punctuation, e.g ,"id":
+                value : Value
+    @return   - void
+**/
+static void val_rec_key_num(val_record_t *rec, const char *key, uint32_t value)
+{
+    val_rec_str(rec, key);
+    val_rec_num(rec, value, 10, 1);
+}
+
+/**
+    @brief    - Appends the performance counts to a record, e.g ,"perf":{"cycles":1200}
+    @param    - rec  : Record
+                perf : Performance counts, nothing is appended if there is none
+    @return   - void
+**/
+static void val_rec_perf(val_record_t *rec, const pal_perf_counts_t *perf)
+{
+    uint32_t i;
+
+    if (!perf->count)
+        return;
+
+    val_rec_str(rec, ",\"perf\":{");
+    for (i = 0; i < perf->count; i++)
+    {
+        val_rec_str(rec, i ? ",\"" : "\"");
+        val_rec_str(rec, perf->name[i]);
+        val_rec_str(rec, "\":");
+        val_rec_num(rec, perf->value[i], 10, 1);
+    }
+    val_rec_str(rec, "}");
+}
+
+/**
+    @brief    - Returns the name of a test state
+    @param    - state : Test state returned by val_report_status
+    @return   - State name
+**/
+static const char *val_result_state_name(uint32_t state)
+{
+    switch (state)
+    {
+        case TEST_PASS:
+            return "PASS";
+        case TEST_SKIP:
+            return "SKIP";
+        case TEST_ERROR:
+            return "ERROR";
+        default:
+            return "FAIL";
+    }
+}
+
+/**
+    @brief    - Writes a record to the platform result file or, failing that, to
+                the console
+    @param    - format : Record format
+                rec    : Record, NULL to start a new result file
+    @return   - SUCCESS/ERROR, UNSUPPORTED_FUNC if not written
+**/
+static int val_emit_record(pal_result_format_t format, const val_record_t *rec)
+{
+    int status;
+
+    status = pal_result_write(format, rec ? rec->buf : NULL);
+    if (status != PAL_STATUS_UNSUPPORTED_FUNC)
+        return status;
+
+#ifdef RESULT_RECORDS
+    if (format == PAL_RESULT_JSONL && rec)
+    {
+        val_print(ALWAYS, VAL_RESULT_RS, 0);
+        val_print(ALWAYS, rec->buf, 0);
+        return PAL_STATUS_SUCCESS;
+    }
+#endif
+
+    return status;
+}
+
+/**
+    @brief    - Starts the JUnit XML report. The test cases are appended as the tests
+                complete, so that the tests run before a reset are part of the report.
+                Not all the platforms can write a file, the JUnit report is then
+                produced from the JSON records by tools/utils/extract_results.py.
+    @param    - suite : Name of the suite
+    @return   - void
+**/
+static void val_report_junit_start(const char *suite)
+{
+    val_record_t rec = { .len = 0 };
+
+    if (val_emit_record(PAL_RESULT_JUNIT, NULL) != PAL_STATUS_SUCCESS)
+        return;
+
+    val_rec_str(&rec, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<testsuites>\n");
+    val_rec_str(&rec, "<testsuite name=\"");
+    val_rec_xml_str(&rec, suite, VAL_RESULT_DESC_LEN);
+    val_rec_str(&rec, "\">\n");
+    val_emit_record(PAL_RESULT_JUNIT, &rec);
+}
+
+/**
+    @brief    - Starts a new result stream and emits the record of the run
+    @param    - suite : Name of the suite
+    @return   - void
+**/
+void val_report_run_record(const char *suite)
+{
+    val_record_t rec = { .len = 0 };
+
+    val_report_junit_start(suite);
+
+    if (val_emit_record(PAL_RESULT_JSONL, NULL) == PAL_STATUS_ERROR)
+        return;
+
+    val_rec_str(&rec, "{\"type\":\"run\",\"version\":\"");
+    val_rec_num(&rec, PSA_ACS_MAJOR_VER, 10, 1);
+    val_rec_str(&rec, ".");
+    val_rec_num(&rec, PSA_ACS_MINOR_VER, 10, 1);
+    val_rec_str(&rec, "\"}\n");
+    val_emit_record(PAL_RESULT_JSONL, &rec);
+}
+
+/**
+    @brief    - Emits the record of a completed check, as a JSON line
+    @param    - test_id   : Test ID
+                check_num : Check number
+                status    : Status returned by the check
+                time_us   : Check execution time
+                perf      : Performance counts of the check
+    @return   - void
+**/
+void val_report_check_record(test_id_t test_id, uint32_t check_num,
+                             uint32_t status, uint32_t time_us,
+                             const pal_perf_counts_t *perf)
+{
+    val_record_t rec = { .len = 0 };
+
+    val_rec_key_num(&rec, "{\"type\":\"check\",\"id\":", test_id);
+    val_rec_key_num(&rec, ",\"check\":", check_num);
+    val_rec_str(&rec, ",\"state\":\"");
+    if (IS_TEST_SKIP(status))
+        val_rec_str(&rec, "SKIP");
+    else
+        val_rec_str(&rec, VAL_ERROR(status) ? "FAIL" : "PASS");
+    val_rec_key_num(&rec, "\",\"status\":", status & TEST_STATUS_CODE_MASK);
+    val_rec_key_num(&rec, ",\"duration_us\":", time_us);
+    val_rec_perf(&rec, perf);
+    val_rec_str(&rec, "}\n");
+    val_emit_record(PAL_RESULT_JSONL, &rec);
+}
+
+/**
+    @brief    - Appends the test case of a completed test to the JUnit XML report
+    @param    - result : Test result record
+    @return   - void
+**/
+static void val_report_junit_test(const val_test_result_t *result)
+{
+    val_record_t  rec = { .len = 0 };
+    char          name[VAL_TEST_NAME_LEN];
+    const char   *suite = val_get_comp_name(result->test_id);
+
+    val_get_test_name(result->test_id, name);
+
+    val_rec_str(&rec, "  <testcase classname=\"");
+    val_rec_xml_str(&rec, suite, VAL_RESULT_DESC_LEN);
+    val_rec_str(&rec, "\" name=\"");
+    val_rec_str(&rec, name);
+    val_rec_str(&rec, " ");
+    val_rec_xml_str(&rec, result->desc ? result->desc : "", val_desc_len(result->desc));
+    val_rec_str(&rec, "\" time=\"");
+    val_rec_seconds(&rec, result->time_us);
+    val_rec_str(&rec, "\"");
+
+    if (result->test_result == TEST_PASS)
+    {
+        val_rec_str(&rec, "/>\n");
+    }
+    else
+    {
+        val_rec_str(&rec, ">\n    <");
+        val_rec_str(&rec, (result->test_result == TEST_SKIP) ? "skipped" :
+                          (result->test_result == TEST_ERROR) ? "error" : "failure");
+        val_rec_str(&rec, " message=\"status=0x");
+        val_rec_num(&rec, result->status_code, 16, 1);
+        val_rec_key_num(&rec, " check=", result->failed_check);
+        val_rec_key_num(&rec, " checkpoint=", result->failed_checkpoint);
+        val_rec_str(&rec, "\"/>\n  </testcase>\n");
+    }
+    val_emit_record(PAL_RESULT_JUNIT, &rec);
+}
+
+/**
+    @brief    - Emits the record of a completed test, as a JSON line, and its JUnit
+                test case
+    @param    - result : Test result record
+    @return   - void
+**/
+void val_report_test_record(const val_test_result_t *result)
+{
+    val_record_t rec = { .len = 0 };
+    char         name[VAL_TEST_NAME_LEN];
+    const char  *suite = val_get_comp_name(result->test_id);
+
+    val_get_test_name(result->test_id, name);
+
+    val_rec_key_num(&rec, "{\"type\":\"test\",\"id\":", result->test_id);
+    val_rec_str(&rec, ",\"name\":");
+    val_rec_json_str(&rec, name, VAL_TEST_NAME_LEN);
+    val_rec_str(&rec, ",\"suite\":");
+    val_rec_json_str(&rec, suite, VAL_RESULT_DESC_LEN);
+    val_rec_str(&rec, ",\"desc\":");
+    val_rec_json_str(&rec, result->desc ? result->desc : "", val_desc_len(result->desc));
+    val_rec_str(&rec, ",\"state\":\"");
+    val_rec_str(&rec, val_result_state_name(result->test_result));
+    val_rec_key_num(&rec, "\",\"status\":", result->status_code);
+    val_rec_key_num(&rec, ",\"check\":", result->failed_check);
+    val_rec_key_num(&rec, ",\"checkpoint\":", result->failed_checkpoint);
+    val_rec_key_num(&rec, ",\"duration_us\":", result->time_us);
+    val_rec_key_num(&rec, ",\"scratch_bytes\":", result->scratch_bytes);
+    val_rec_key_num(&rec, ",\"stack_bytes\":", result->stack_bytes);
+    val_rec_key_num(&rec, ",\"heap_bytes\":", result->heap_bytes);
+    val_rec_perf(&rec, &result->perf);
+    val_rec_str(&rec, "}\n");
+    val_emit_record(PAL_RESULT_JSONL, &rec);
+
+    val_report_junit_test(result);
+}
+
+/**
+    @brief    - Emits the suite summary as a JSON line and ends the JUnit XML report
+    @param    - test_count : Suite summary
+    @return   - void
+**/
+void val_report_suite_records(const regre_report_t *test_count)
+{
+    val_record_t rec = { .len = 0 };
+
+    val_rec_key_num(&rec, "{\"type\":\"summary\",\"total\":",
+                     test_count->total_pass + test_count->total_fail +
+                     test_count->total_skip + test_count->total_error);
+    val_rec_key_num(&rec, ",\"pass\":", test_count->total_pass);
+    val_rec_key_num(&rec, ",\"fail\":", test_count->total_fail);
+    val_rec_key_num(&rec, ",\"skip\":", test_count->total_skip);
+    val_rec_key_num(&rec, ",\"error\":", test_count->total_error);
+    val_rec_str(&rec, "}\n");
+    val_emit_record(PAL_RESULT_JSONL, &rec);
+
+    rec.len = 0;
+    val_rec_str(&rec, "</testsuite>\n</testsuites>\n");
+    val_emit_record(PAL_RESULT_JUNIT, &rec);
+}
@@ -0,0 +1,61 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _VAL_RESULTS_H_
+#define _VAL_RESULTS_H_
+
+#include "val.h"
+#include "val_dispatcher.h"
+
+/* Maximum size of a result record, descriptions are truncated to fit */
+#define VAL_RESULT_RECORD_SIZE       768
+
+/**
+    @brief    - Starts a new result stream and emits the record of the run
+    @param    - suite : Name of the suite
+    @return   - void
+**/
+void val_report_run_record(const char *suite);
+
+/**
+    @brief    - Emits the record of a completed check, as a JSON line
+    @param    - test_id   : Test ID
+                check_num : Check number
+                status    : Status returned by the check
+                time_us   : Check execution time
+                perf      : Performance counts of the check
+    @return   - void
+**/
+void val_report_check_record(test_id_t test_id, uint32_t check_num,
+                             uint32_t status, uint32_t time_us,
+                             const pal_perf_counts_t *perf);
+
+/**
+    @brief    - Emits the record of a completed test, as a JSON line, and its JUnit
+                test case
+    @param    - result : Test result record
+    @return   - void
+**/
+void val_report_test_record(const val_test_result_t *result);
+
+/**
+    @brief    - Emits the suite summary as a JSON line and ends the JUnit XML report
+    @param    - test_count : Suite summary
+    @return   - void
+**/
+void val_report_suite_records(const regre_report_t *test_count);
+#endif
@@ -0,0 +1,77 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_scratch.h"
+#include "val_peripherals.h"
+
+/* Scratch arena, allocations are carved from it in order and released together */
+static union {
+    uint64_t    align;
+    uint8_t     bytes[PLATFORM_SCRATCH_SIZE];
+} g_scratch;
+static size_t      g_scratch_used;
+static size_t      g_scratch_high_water;
+
+/**
+    @brief    - Allocates a zeroed buffer from the scratch arena. The buffers are
+                released together when the next test starts. Not thread safe, the
+                threads of val->thread_run must be given buffers allocated before.
+    @param    - size : Size of the buffer
+    @return   - Buffer, NULL if the arena is exhausted
+**/
+void *val_scratch_alloc(size_t size)
+{
+    void    *buffer;
+    size_t   start = (g_scratch_used + VAL_SCRATCH_ALIGN - 1) & ~(size_t)(VAL_SCRATCH_ALIGN - 1);
+
+    if (start > PLATFORM_SCRATCH_SIZE || size > PLATFORM_SCRATCH_SIZE - start)
+    {
+        val_print(ERROR, "\tScratch arena exhausted, %d bytes requested\n", (int32_t)size);
+        return NULL;
+    }
+
+    buffer = &g_scratch.bytes[start];
+    memset(buffer, 0, size);
+
+    g_scratch_used = start + size;
+    if (g_scratch_used > g_scratch_high_water)
+        g_scratch_high_water = g_scratch_used;
+
+    return buffer;
+}
+
+/**
+    @brief    - Releases all the scratch buffers and clears the high-water mark
+    @param    - None
+    @return   - void
+**/
+void val_scratch_reset(void)
+{
+    g_scratch_used       = 0;
+    g_scratch_high_water = 0;
+}
+
+/**
+    @brief    - Returns the largest number of bytes allocated from the scratch arena
+                since the last reset
+    @param    - None
+    @return   - High-water mark in bytes
+**/
+uint32_t val_scratch_high_water(void)
+{
+    return (uint32_t)g_scratch_high_water;
+}
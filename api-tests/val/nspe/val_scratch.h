@@ -0,0 +1,55 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _VAL_SCRATCH_H_
+#define _VAL_SCRATCH_H_
+
+#include "val.h"
+
+/* Size of the scratch arena from which the tests allocate their working buffers,
+   instead of declaring them on the stack */
+#ifndef PLATFORM_SCRATCH_SIZE
+#define PLATFORM_SCRATCH_SIZE        8192
+#endif
+
+/* Alignment of the scratch allocations */
+#define VAL_SCRATCH_ALIGN            8
+
+/**
+    @brief    - Allocates a zeroed buffer from the scratch arena. The buffers are
+                released together when the next test starts. Not thread safe, the
+                threads of val->thread_run must be given buffers allocated before.
+    @param    - size : Size of the buffer
+    @return   - Buffer, NULL if the arena is exhausted
+**/
+void *val_scratch_alloc(size_t size);
+
+/**
+    @brief    - Releases all the scratch buffers and clears the high-water mark
+    @param    - None
+    @return   - void
+**/
+void val_scratch_reset(void);
+
+/**
+    @brief    - Returns the largest number of bytes allocated from the scratch arena
+                since the last reset
+    @param    - None
+    @return   - High-water mark in bytes
+**/
+uint32_t val_scratch_high_water(void);
+#endif
@@ -0,0 +1,331 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_test_select.h"
+#include "val_peripherals.h"
+
+/* The selection is a pair of bitmaps indexed by test ID, so that checking a test
+ * against any number of command line options is a single lookup.
+ */
+#define VAL_MAX_SELECT_ID            (VAL_MAX_COMP * VAL_MAX_TEST_PER_COMP)
+#define VAL_SELECT_MAP_WORDS         ((VAL_MAX_SELECT_ID + 31) / 32)
+
+#define VAL_SELECT_SET(map, id)      ((map)[(id) / 32] |= (1u << ((id) % 32)))
+#define VAL_SELECT_GET(map, id)      (((map)[(id) / 32] >> ((id) % 32)) & 1)
+
+static uint32_t g_include_map[VAL_SELECT_MAP_WORDS];
+static uint32_t g_exclude_map[VAL_SELECT_MAP_WORDS];
+static bool_t   g_include_active;
+
+/* Letter used in the test names of each component, indexed by component number */
+static const char g_comp_letter[VAL_MAX_COMP] = {'i', 'c', 's', 'a', 'b'};
+
+/**
+    @brief    - Prints the command line usage
+    @param    - prog : Program name
+    @return   - void
+**/
+static void val_print_select_usage(const char *prog)
+{
+    val_print(ALWAYS, "\nUsage: ", 0);
+    val_print(ALWAYS, prog ? prog : "psa-arch-tests", 0);
+    val_print(ALWAYS, " [-t LIST] [-n LIST] [-x LIST]\n", 0);
+    val_print(ALWAYS, "  -t, --test LIST     Run the tests of the comma separated list of\n", 0);
+    val_print(ALWAYS, "                      test IDs and ID ranges, e.g 201,205-210\n", 0);
+    val_print(ALWAYS, "  -n, --name LIST     Run the tests whose name matches one of the comma\n", 0);
+    val_print(ALWAYS, "                      separated glob patterns, e.g 'test_c0[0-4]?'\n", 0);
+    val_print(ALWAYS, "  -x, --exclude LIST  Skip the tests given by ID, ID range or glob pattern\n", 0);
+    val_print(ALWAYS, "  -h, --help          Print this help\n", 0);
+    val_print(ALWAYS, "Options can be repeated. Without -t or -n, all the tests are run.\n", 0);
+}
+
+/**
+    @brief    - Compares two strings
+    @param    - a, b : Null terminated strings
+    @return   - 1 if equal, 0 otherwise
+**/
+static bool_t val_str_equal(const char *a, const char *b)
+{
+    while (*a && *a == *b)
+    {
+        a++;
+        b++;
+    }
+    return (*a == *b);
+}
+
+/**
+    @brief    - Matches a character against a glob bracket expression, e.g [0-4]
+    @param    - pattern : Points to the opening bracket, advanced past the closing one
+                c       : Character to match
+    @return   - 1 on match, 0 otherwise
+**/
+static bool_t val_glob_match_class(const char **pattern, char c)
+{
+    const char *p = *pattern + 1;
+    bool_t      negate = 0;
+    bool_t      match = 0;
+
+    if (*p == '!' || *p == '^')
+    {
+        negate = 1;
+        p++;
+    }
+
+    do {
+        if (p[1] == '-' && p[2] && p[2] != ']')
+        {
+            if (c >= p[0] && c <= p[2])
+                match = 1;
+            p += 3;
+        }
+        else
+        {
+            if (c == *p)
+                match = 1;
+            p++;
+        }
+    } while (*p && *p != ']');
+
+    *pattern = *p ? p + 1 : p;
+    return match ^ negate;
+}
+
+/**
+    @brief    - Matches a string against a glob pattern supporting *, ? and [...]
+    @param    - pattern : Glob pattern, terminated by a null or a comma
+                str     : Null terminated string
+    @return   - 1 on match, 0 otherwise
+**/
+static bool_t val_glob_match(const char *pattern, const char *str)
+{
+    const char *star = NULL;
+    const char *retry = NULL;
+    const char *next;
+
+    while (*str)
+    {
+        if (*pattern == '*')
+        {
+            star = ++pattern;
+            retry = str;
+            continue;
+        }
+
+        next = pattern;
+        if (*pattern == '[' && val_glob_match_class(&next, *str))
+        {
+            pattern = next;
+            str++;
+            continue;
+        }
+
+        if (*pattern && *pattern != ',' && *pattern != '[' &&
+            (*pattern == '?' || *pattern == *str))
+        {
+            pattern++;
+            str++;
+            continue;
+        }
+
+        /* Mismatch, let the last star absorb one more character */
+        if (!star)
+            return 0;
+        pattern = star;
+        str = ++retry;
+    }
+
+    while (*pattern == '*')
+        pattern++;
+
+    return (*pattern == '\0' || *pattern == ',');
+}
+
+/**
+    @brief    - Parses a decimal number
+    @param    - str   : Points to the number, advanced past it
+                value : Returns the number
+    @return   - 1 if a number was parsed, 0 otherwise
+**/
+static bool_t val_parse_number(const char **str, uint32_t *value)
+{
+    const char *p = *str;
+    uint32_t    v = 0;
+
+    if (*p < '0' || *p > '9')
+        return 0;
+
+    while (*p >= '0' && *p <= '9')
+    {
+        v = v * 10 + (uint32_t)(*p - '0');
+        if (v >= VAL_MAX_SELECT_ID)
+            return 0;
+        p++;
+    }
+
+    *str = p;
+    *value = v;
+    return 1;
+}
+
+/**
+    @brief    - Adds the tests of a comma separated list of IDs, ID ranges and glob
+                patterns to a selection map
+    @param    - list : Option value
+                map  : Selection map to update
+    @return   - 0 on success, -1 on invalid list
+**/
+static int32_t val_select_add_list(const char *list, uint32_t *map)
+{
+    const char *p = list;
+    char        name[VAL_TEST_NAME_LEN];
+    uint32_t    first, last, id;
+
+    while (*p)
+    {
+        if (*p >= '0' && *p <= '9')
+        {
+            if (!val_parse_number(&p, &first))
+                return -1;
+
+            last = first;
+            if (*p == '-')
+            {
+                p++;
+                if (!val_parse_number(&p, &last) || last < first)
+                    return -1;
+            }
+
+            if (*p != ',' && *p != '\0')
+                return -1;
+
+            for (id = first; id <= last; id++)
+                VAL_SELECT_SET(map, id);
+        }
+        else
+        {
+            for (id = 0; id < VAL_MAX_SELECT_ID; id++)
+            {
+                val_get_test_name(id, name);
+                if (val_glob_match(p, name))
+                    VAL_SELECT_SET(map, id);
+            }
+
+            while (*p && *p != ',')
+                p++;
+        }
+
+        if (*p == ',')
+            p++;
+    }
+
+    return 0;
+}
+
+/**
+    @brief    - Writes the name of a test, e.g test_c001
+    @param    - test_id : Test ID
+                name    : Buffer of VAL_TEST_NAME_LEN bytes
+    @return   - void
+**/
+void val_get_test_name(test_id_t test_id, char *name)
+{
+    uint32_t comp = VAL_GET_COMP_NUM(test_id);
+    uint32_t num  = VAL_GET_TEST_NUM(test_id);
+    const char *prefix = "test_";
+
+    while (*prefix)
+        *name++ = *prefix++;
+
+    *name++ = (comp < VAL_MAX_COMP && g_comp_letter[comp]) ? g_comp_letter[comp] : 'x';
+    *name++ = (char)('0' + (num / 100) % 10);
+    *name++ = (char)('0' + (num / 10) % 10);
+    *name++ = (char)('0' + num % 10);
+    *name = '\0';
+}
+
+/**
+    @brief    - Parses the test selection options of the command line
+    @param    - argc : Number of command line arguments
+                argv : Command line arguments
+    @return   - 0 to run the selected tests, 1 when nothing has to be run (help),
+                -1 on an invalid command line
+**/
+int32_t val_select_tests(int argc, char **argv)
+{
+    const char *opt;
+    int         i;
+    uint32_t   *map;
+
+    /* Runs ahead of val_entry, open the console for the usage and error messages */
+    if (val_uart_init())
+        return -1;
+
+    for (i = 1; i < argc; i++)
+    {
+        opt = argv[i];
+
+        if (val_str_equal(opt, "-h") || val_str_equal(opt, "--help"))
+        {
+            val_print_select_usage(argv[0]);
+            return 1;
+        }
+        else if (val_str_equal(opt, "-t") || val_str_equal(opt, "--test") ||
+                 val_str_equal(opt, "-n") || val_str_equal(opt, "--name"))
+        {
+            map = g_include_map;
+            g_include_active = 1;
+        }
+        else if (val_str_equal(opt, "-x") || val_str_equal(opt, "--exclude"))
+        {
+            map = g_exclude_map;
+        }
+        else
+        {
+            val_print(ERROR, "\nUnknown option: ", 0);
+            val_print(ERROR, opt, 0);
+            val_print_select_usage(argv[0]);
+            return -1;
+        }
+
+        if (i + 1 >= argc || val_select_add_list(argv[++i], map))
+        {
+            val_print(ERROR, "\nInvalid value for option: ", 0);
+            val_print(ERROR, opt, 0);
+            val_print_select_usage(argv[0]);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+    @brief    - Tells if a test is part of the command line selection
+    @param    - test_id : Test ID
+    @return   - 1 if the test is selected, 0 otherwise
+**/
+bool_t val_is_test_selected(test_id_t test_id)
+{
+    if (test_id >= VAL_MAX_SELECT_ID)
+        return !g_include_active;
+
+    if (g_include_active && !VAL_SELECT_GET(g_include_map, test_id))
+        return 0;
+
+    return !VAL_SELECT_GET(g_exclude_map, test_id);
+}
@@ -0,0 +1,53 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _VAL_TEST_SELECT_H_
+#define _VAL_TEST_SELECT_H_
+
+#include "val.h"
+#include "val_common_framework.h"
+
+/* Number of test components covered by the test selection */
+#define VAL_MAX_COMP                 8
+
+/* Maximum length of a test name, e.g test_c001 */
+#define VAL_TEST_NAME_LEN            16
+
+/**
+    @brief    - Parses the test selection options of the command line
+    @param    - argc : Number of command line arguments
+                argv : Command line arguments
+    @return   - 0 to run the selected tests, 1 when nothing has to be run (help),
+                -1 on an invalid command line
+**/
+int32_t val_select_tests(int argc, char **argv);
+
+/**
+    @brief    - Tells if a test is part of the command line selection
+    @param    - test_id : Test ID
+    @return   - 1 if the test is selected, 0 otherwise
+**/
+bool_t val_is_test_selected(test_id_t test_id);
+
+/**
+    @brief    - Writes the name of a test, e.g test_c001
+    @param    - test_id : Test ID
+                name    : Buffer of VAL_TEST_NAME_LEN bytes
+    @return   - void
+**/
+void val_get_test_name(test_id_t test_id, char *name);
+#endif
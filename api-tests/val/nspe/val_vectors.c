@@ -0,0 +1,280 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_vectors.h"
+#include "val_peripherals.h"
+#include "pal_interfaces_ns.h"
+
+#define VAL_VECTOR_ALIGN(n)          (((n) + 3) & ~(size_t)3)
+#define VAL_VECTOR_HEADER_SIZE       12
+#define VAL_VECTOR_ITEM_HEADER_SIZE  8
+
+static uint16_t val_vector_u16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t val_vector_u32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+           ((uint32_t)p[3] << 24);
+}
+
+/**
+    @brief    - Stores an integer in a member of the given size
+    @param    - member : Member of the test data structure
+                size   : Size of the member
+                value  : Value, truncated to the member size
+    @return   - void
+**/
+static void val_vector_store(uint8_t *member, uint8_t size, uint64_t value)
+{
+    uint8_t     value8 = (uint8_t)value;
+    uint16_t    value16 = (uint16_t)value;
+    uint32_t    value32 = (uint32_t)value;
+
+    switch (size)
+    {
+        case 1:
+            memcpy(member, &value8, size);
+            break;
+        case 2:
+            memcpy(member, &value16, size);
+            break;
+        case 4:
+            memcpy(member, &value32, size);
+            break;
+        default:
+            memcpy(member, &value, sizeof(value));
+            break;
+    }
+}
+
+/**
+    @brief    - Looks up a vector file in the vector archive of the platform, a flash
+                partition mapped at PLATFORM_VECTOR_ARCHIVE_BASE
+    @param    - name : Name of the vector file
+                data : Returns the start of the file
+                size : Returns the size of the file
+    @return   - VAL_STATUS_SUCCESS, VAL_STATUS_NOT_FOUND
+**/
+static val_status_t val_vector_find(const char *name, const uint8_t **data, size_t *size)
+{
+#ifdef PLATFORM_VECTOR_ARCHIVE_BASE
+    const uint8_t   *archive = (const uint8_t *)PLATFORM_VECTOR_ARCHIVE_BASE;
+    const uint8_t   *entry;
+    uint32_t         count, i;
+
+    if (val_vector_u32(archive) != VAL_VECTOR_ARCHIVE_MAGIC)
+    {
+        return VAL_STATUS_NOT_FOUND;
+    }
+
+    count = val_vector_u32(archive + 4);
+    for (i = 0; i < count; i++)
+    {
+        entry = archive + 8 + i * (VAL_VECTOR_NAME_SIZE + 8);
+        if (!strncmp((const char *)entry, name, VAL_VECTOR_NAME_SIZE))
+        {
+            *data = archive + val_vector_u32(entry + VAL_VECTOR_NAME_SIZE);
+            *size = val_vector_u32(entry + VAL_VECTOR_NAME_SIZE + 4);
+            return VAL_STATUS_SUCCESS;
+        }
+    }
+#else
+    (void)name;
+    (void)data;
+    (void)size;
+#endif
+
+    return VAL_STATUS_NOT_FOUND;
+}
+
+/**
+    @brief    - Opens the vector file of a test, mapped by the platform or found in the
+                vector archive of the platform
+    @param    - name        : Name of the vector file, e.g "test_c006"
+                fields      : Members of the test data structure filled by the vectors
+                field_count : Number of fields
+                file        : Returns the open vector file
+    @return   - VAL_STATUS_SUCCESS, VAL_STATUS_NOT_FOUND if there is no vector file for
+                the test, VAL_STATUS_LOAD_ERROR if it is malformed
+**/
+val_status_t val_vector_open(const char *name, const val_vector_field_t *fields,
+                             uint32_t field_count, val_vector_file_t *file)
+{
+    const void      *mapping;
+    const uint8_t   *data;
+    size_t           size, offset;
+    uint32_t         i, j;
+    uint8_t          length;
+
+    memset(file, 0, sizeof(*file));
+
+    if (pal_vector_map(name, &mapping, &size) == PAL_STATUS_SUCCESS)
+    {
+        data = mapping;
+    }
+    else if (val_vector_find(name, &data, &size) != VAL_STATUS_SUCCESS)
+    {
+        return VAL_STATUS_NOT_FOUND;
+    }
+
+    if (size < VAL_VECTOR_HEADER_SIZE ||
+        val_vector_u32(data) != VAL_VECTOR_MAGIC ||
+        val_vector_u16(data + 4) != VAL_VECTOR_VERSION ||
+        val_vector_u16(data + 6) > VAL_VECTOR_MAX_FIELDS)
+    {
+        val_print(ERROR, "\tInvalid vector file header\n", 0);
+        return VAL_STATUS_LOAD_ERROR;
+    }
+
+    file->field_count = val_vector_u16(data + 6);
+    file->count = val_vector_u32(data + 8);
+
+    /* Map the fields of the file to the members of the test data structure */
+    offset = VAL_VECTOR_HEADER_SIZE;
+    for (i = 0; i < file->field_count; i++)
+    {
+        if (offset >= size || data[offset] > size - offset - 1)
+        {
+            val_print(ERROR, "\tTruncated vector file\n", 0);
+            return VAL_STATUS_LOAD_ERROR;
+        }
+
+        length = data[offset];
+        for (j = 0; j < field_count; j++)
+        {
+            if (strlen(fields[j].name) == length &&
+                !memcmp(fields[j].name, data + offset + 1, length))
+            {
+                break;
+            }
+        }
+
+        if (j == field_count)
+        {
+            val_print(ERROR, "\tField %d of the vector file is not used by the test\n", i);
+            return VAL_STATUS_LOAD_ERROR;
+        }
+
+        file->map[i] = (uint8_t)j;
+        offset += 1 + length;
+    }
+
+    file->data = data;
+    file->size = size;
+    file->offset = VAL_VECTOR_ALIGN(offset);
+    file->fields = fields;
+
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Reads the next vector of a file into a test data structure. The byte
+                strings point into the file, which stays mapped for the whole run.
+    @param    - file     : Open vector file
+                vector   : Test data structure to fill
+                defaults : Values of the members which the vector does not set
+                size     : Size of the test data structure
+    @return   - VAL_STATUS_SUCCESS, VAL_STATUS_NO_TESTS after the last vector,
+                VAL_STATUS_LOAD_ERROR if the vector is malformed
+**/
+val_status_t val_vector_next(val_vector_file_t *file, void *vector, const void *defaults,
+                             size_t size)
+{
+    const val_vector_field_t    *field;
+    const uint8_t               *item, *end;
+    uint8_t                     *member;
+    uint64_t                     value;
+    uint32_t                     length;
+    uint8_t                      index;
+
+    if (file->index >= file->count)
+    {
+        return VAL_STATUS_NO_TESTS;
+    }
+
+    if (file->offset > file->size - 4 ||
+        val_vector_u32(file->data + file->offset) > file->size - file->offset - 4)
+    {
+        val_print(ERROR, "\tTruncated vector %d\n", file->index);
+        return VAL_STATUS_LOAD_ERROR;
+    }
+
+    if (defaults)
+        memcpy(vector, defaults, size);
+    else
+        memset(vector, 0, size);
+
+    item = file->data + file->offset + 4;
+    end = item + val_vector_u32(file->data + file->offset);
+
+    while (item < end)
+    {
+        if ((size_t)(end - item) < VAL_VECTOR_ITEM_HEADER_SIZE ||
+            item[0] >= file->field_count ||
+            val_vector_u32(item + 4) > (size_t)(end - item) - VAL_VECTOR_ITEM_HEADER_SIZE)
+        {
+            val_print(ERROR, "\tMalformed vector %d\n", file->index);
+            return VAL_STATUS_LOAD_ERROR;
+        }
+
+        index = item[0];
+        field = &file->fields[file->map[index]];
+        length = val_vector_u32(item + 4);
+        member = (uint8_t *)vector + field->offset;
+        if (item[1] != field->type)
+        {
+            val_print(ERROR, "\tUnexpected type of field %d\n", index);
+            return VAL_STATUS_LOAD_ERROR;
+        }
+        item += VAL_VECTOR_ITEM_HEADER_SIZE;
+
+        switch (field->type)
+        {
+            case VAL_VECTOR_INT:
+                if (length != sizeof(value))
+                {
+                    val_print(ERROR, "\tUnexpected size of field %d\n", index);
+                    return VAL_STATUS_LOAD_ERROR;
+                }
+                value = (uint64_t)val_vector_u32(item) |
+                        ((uint64_t)val_vector_u32(item + 4) << 32);
+                val_vector_store(member, field->size, value);
+                break;
+            case VAL_VECTOR_BYTES:
+                /* The byte strings are used in place */
+                memcpy(member, &item, sizeof(item));
+                val_vector_store((uint8_t *)vector + field->length_offset, field->size, length);
+                break;
+            default:
+                if (length >= field->size)
+                    length = field->size - 1;
+                memcpy(member, item, length);
+                member[length] = '\0';
+                break;
+        }
+
+        item += VAL_VECTOR_ALIGN(val_vector_u32(item - 4));
+    }
+
+    file->offset += 4 + VAL_VECTOR_ALIGN(val_vector_u32(file->data + file->offset));
+    file->index++;
+
+    return VAL_STATUS_SUCCESS;
+}
@@ -0,0 +1,105 @@
+/** @file
+ * Copyright (c) 2026, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _VAL_VECTORS_H_
+#define _VAL_VECTORS_H_
+
+#include <stddef.h>
+#include "val.h"
+
+/* Test vector files, written by tools/scripts/gen_test_vectors.py. All the values are
+ * little endian and every item starts on a 4 byte boundary.
+ *
+ * File    : magic, version, field count, vector count, field names, vectors
+ * Name    : length (1 byte) and characters of the name of a field
+ * Vector  : size of its items (4 bytes), items
+ * Item    : field index (1 byte), type (1 byte), reserved (2 bytes), value length
+ *           (4 bytes), value
+ *
+ * Boards without a file system store the files in a flash partition as an archive:
+ * magic, file count, then for each file its name (32 bytes), offset and size.
+ */
+#define VAL_VECTOR_MAGIC             0x56415350  /* "PSAV" */
+#define VAL_VECTOR_ARCHIVE_MAGIC     0x41415350  /* "PSAA" */
+#define VAL_VECTOR_VERSION           1
+#define VAL_VECTOR_NAME_SIZE         32
+#define VAL_VECTOR_MAX_FIELDS        32
+
+/* Types of the vector items */
+typedef enum {
+    VAL_VECTOR_INT   = 1,  /* 8 byte signed integer */
+    VAL_VECTOR_BYTES = 2,  /* Byte string */
+    VAL_VECTOR_TEXT  = 3,  /* Character string, without null terminator */
+} val_vector_type_t;
+
+/* Member of the test data structure filled by a vector field */
+typedef struct {
+    const char         *name;
+    uint8_t             type;
+    uint8_t             size;           /* Size of the member, or of its length member */
+    uint16_t            offset;         /* Offset of the member */
+    uint16_t            length_offset;  /* Offset of the length member of a byte string */
+} val_vector_field_t;
+
+#define VAL_VECTOR_INT_FIELD(type, member)                                          \
+    {#member, VAL_VECTOR_INT, sizeof(((type *)0)->member), offsetof(type, member), 0}
+
+#define VAL_VECTOR_BYTES_FIELD(type, member, length)                                \
+    {#member, VAL_VECTOR_BYTES, sizeof(((type *)0)->length), offsetof(type, member), \
+     offsetof(type, length)}
+
+#define VAL_VECTOR_TEXT_FIELD(type, member)                                         \
+    {#member, VAL_VECTOR_TEXT, sizeof(((type *)0)->member), offsetof(type, member), 0}
+
+/* Open vector file */
+typedef struct {
+    const uint8_t               *data;
+    size_t                       size;
+    size_t                       offset;  /* Offset of the next vector */
+    uint32_t                     count;   /* Number of vectors */
+    uint32_t                     index;   /* Index of the next vector */
+    const val_vector_field_t    *fields;
+    uint32_t                     field_count; /* Number of fields in the file */
+    uint8_t                      map[VAL_VECTOR_MAX_FIELDS]; /* File field to member */
+} val_vector_file_t;
+
+/**
+    @brief    - Opens the vector file of a test, mapped by the platform or found in the
+                vector archive of the platform
+    @param    - name        : Name of the vector file, e.g "test_c006"
+                fields      : Members of the test data structure filled by the vectors
+                field_count : Number of fields
+                file        : Returns the open vector file
+    @return   - VAL_STATUS_SUCCESS, VAL_STATUS_NOT_FOUND if there is no vector file for
+                the test, VAL_STATUS_LOAD_ERROR if it is malformed
+**/
+val_status_t val_vector_open(const char *name, const val_vector_field_t *fields,
+                             uint32_t field_count, val_vector_file_t *file);
+
+/**
+    @brief    - Reads the next vector of a file into a test data structure. The byte
+                strings point into the file, which stays mapped for the whole run.
+    @param    - file     : Open vector file
+                vector   : Test data structure to fill
+                defaults : Values of the members which the vector does not set
+                size     : Size of the test data structure
+    @return   - VAL_STATUS_SUCCESS, VAL_STATUS_NO_TESTS after the last vector,
+                VAL_STATUS_LOAD_ERROR if the vector is malformed
+**/
+val_status_t val_vector_next(val_vector_file_t *file, void *vector, const void *defaults,
+                             size_t size);
+#endif
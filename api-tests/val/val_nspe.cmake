@@ -20,6 +20,12 @@ list(APPEND VAL_SRC_C_NSPE
 	${PSA_ROOT_DIR}/val/nspe/val_platform.c
 	${PSA_ROOT_DIR}/val/nspe/val_entry.c
 	${PSA_ROOT_DIR}/val/nspe/val_dispatcher.c
+	${PSA_ROOT_DIR}/val/nspe/val_test_select.c
+	${PSA_ROOT_DIR}/val/nspe/val_results.c
+	${PSA_ROOT_DIR}/val/nspe/val_progress.c
+	${PSA_ROOT_DIR}/val/nspe/val_log.c
+	${PSA_ROOT_DIR}/val/nspe/val_vectors.c
+	${PSA_ROOT_DIR}/val/nspe/val_scratch.c
 	${PSA_ROOT_DIR}/val/nspe/val_framework.c
 	${PSA_ROOT_DIR}/val/nspe/val_crypto.c
 	${PSA_ROOT_DIR}/val/nspe/val_interfaces.c